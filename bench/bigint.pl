@@ -0,0 +1,42 @@
+% bignum workloads: a factorial by a product tree, a fibonacci number by fast doubling,
+% the division of the factorial by the fibonacci number, and the decimal text of both.
+% the products are balanced, so they are large enough for the subquadratic algorithms.
+% run it with: consult('bench/bigint.pl'), bench(100000, 1000000).
+% make bench-bigint runs it with and without the subquadratic algorithms (PQ_BIGINT_NAIVE).
+
+prod(N, N, N) :- !.
+prod(L, H, P) :-
+    M is (L + H) >> 1,
+    M1 is M + 1,
+    prod(L, M, A),
+    prod(M1, H, B),
+    P is A * B.
+
+% fib(N, F(N), F(N + 1)).
+fib(0, 0, 1) :- !.
+fib(N, F, G) :-
+    N2 is N >> 1,
+    fib(N2, A, B),
+    C is A * (2 * B - A),
+    D is A * A + B * B,
+    (N /\ 1 =:= 0 -> F = C, G = D ; F = D, G is C + D).
+
+lap(Name, T0, T1) :-
+    T is T1 - T0,
+    write(Name), write(' '), write(T), write(' seconds'), nl.
+
+bench(N, M) :-
+    statistics(cputime, T0),
+    prod(1, N, F),
+    statistics(cputime, T1),
+    fib(M, G, _),
+    statistics(cputime, T2),
+    Q is F // G,
+    R is F mod G,
+    statistics(cputime, T3),
+    write(F), nl, write(G), nl, write(Q), nl, write(R), nl,
+    statistics(cputime, T4),
+    lap(factorial(N), T0, T1),
+    lap(fibonacci(M), T1, T2),
+    lap(division, T2, T3),
+    lap(decimal_text, T3, T4).
@@ -0,0 +1,23 @@
+% naive reverse of a 30 element list, the classic LIPS benchmark.
+% each reverse is 496 logical inferences, run it with: consult('bench/nrev.pl'), bench(100000).
+
+app([], L, L).
+app([H|T], L, [H|R]) :- app(T, L, R).
+
+nrev([], []).
+nrev([H|T], R) :- nrev(T, RT), app(RT, [H], R).
+
+range(N, N, [N]) :- !.
+range(I, N, [I|T]) :- I < N, I1 is I + 1, range(I1, N, T).
+
+loop(N, L) :- between(1, N, _), nrev(L, _), fail.
+loop(_, _).
+
+bench(N) :-
+    range(1, 30, L),
+    statistics(cputime, T0),
+    loop(N, L),
+    statistics(cputime, T1),
+    T is T1 - T0,
+    LIPS is N * 496 / T,
+    write(nrev30(N)), write(' '), write(T), write(' seconds '), write(LIPS), write(' LIPS'), nl.
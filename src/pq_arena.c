@@ -0,0 +1,75 @@
+/**
+ * @file pq_arena.c
+ * @author Brandon Foster
+ * @brief poqer-lang arena implementation.
+ *
+ * @version 0.001
+ * @date 10-16-2026
+ * @copyright Brandon Foster (c) 2020-2021
+ */
+
+#include "pq_arena.h"
+
+/**
+ * @brief Allocates a chunk for an arena.
+ *
+ * @param cap The number of bytes in the chunk.
+ * @return A pointer to the allocated chunk, NULL if there is not enough memory.
+ */
+static pq_arena_chunk* pq_new_arena_chunk(const size_t cap)
+{
+    pq_arena_chunk* chunk = (pq_arena_chunk*)malloc(sizeof(pq_arena_chunk) + cap);
+    if(!chunk) return NULL;
+    chunk->next = NULL;
+    chunk->cap = cap;
+    return chunk;
+}
+
+pq_arena* pq_new_arena(const size_t chunk_sz)
+{
+    pq_arena* arena = (pq_arena*)malloc(sizeof(pq_arena));
+    if(!arena) return NULL;
+
+    arena->chunk_sz = chunk_sz ? chunk_sz : PQ_ARENA_CHUNK_SIZE;
+    arena->head = pq_new_arena_chunk(arena->chunk_sz);
+    if(!arena->head)
+    {
+        free(arena);
+        return NULL;
+    }
+    pq_arena_reset(arena);
+    return arena;
+}
+
+void pq_del_arena(pq_arena* arena)
+{
+    if(!arena) return;
+
+    pq_arena_chunk* chunk = arena->head;
+    while(chunk)
+    {
+        pq_arena_chunk* next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    free(arena);
+}
+
+void* pq_arena_alloc_slow(pq_arena* arena, const size_t size)
+{
+    //reuses the next chunk from before the last reset if it is large enough,
+    //else a new chunk is inserted after the current one so the remaining chunks are still reused.
+    pq_arena_chunk* chunk = arena->curr->next;
+    if(!chunk || chunk->cap < size)
+    {
+        chunk = pq_new_arena_chunk(size > arena->chunk_sz ? size : arena->chunk_sz);
+        if(!chunk) return NULL;
+        chunk->next = arena->curr->next;
+        arena->curr->next = chunk;
+    }
+
+    arena->curr = chunk;
+    arena->ptr = chunk->data + size;
+    arena->end = chunk->data + chunk->cap;
+    return chunk->data;
+}
@@ -0,0 +1,102 @@
+/**
+ * @file pq_arena.h
+ * @author Brandon Foster
+ * @brief poqer-lang arena header.
+ * the pq_arena struct is a bump pointer allocator, its allocations are deallocated all at once.
+ * create/destroy the arena with the pq_new_* and pq_del_* functions.
+ * allocate with pq_arena_alloc function, deallocate everything with pq_arena_reset function.
+ *
+ * @version 0.001
+ * @date 10-16-2026
+ * @copyright Brandon Foster (c) 2020-2021
+ */
+
+#ifndef _PQ_ARENA_H
+#define _PQ_ARENA_H
+#include "pq_globals.h"
+#include <stdlib.h>
+
+//the default number of bytes in each chunk of an arena.
+#define PQ_ARENA_CHUNK_SIZE 65536
+
+//the alignment of every allocation, enough for pointers, PQint, and PQflt.
+#define PQ_ARENA_ALIGN 8
+
+/**
+ * @brief A block of memory that the allocations are carved from.
+ */
+typedef struct pq_arena_chunk
+{
+    struct pq_arena_chunk* next; //the following chunk, chunks are kept after a reset to be reused.
+    size_t cap; //the number of bytes in data.
+    char data[]; //the allocations.
+} pq_arena_chunk;
+
+/**
+ * @brief The structure of a poqer-lang arena.
+ */
+typedef struct pq_arena
+{   //these variables should only be read externally, not modified.
+
+    pq_arena_chunk* head; //the first chunk.
+    pq_arena_chunk* curr; //the chunk that is being allocated from.
+    char* ptr; //the next free byte in the current chunk.
+    char* end; //the end of the current chunk.
+    size_t chunk_sz; //the number of bytes in a new chunk, larger allocations get a chunk of their own size.
+} pq_arena;
+
+/**
+ * @brief Safe allocation for a pq_arena struct, initializes the arena with its first chunk, then returns the pointer.
+ *
+ * @param chunk_sz The number of bytes in each chunk, 0 for PQ_ARENA_CHUNK_SIZE.
+ * @return A pointer to the allocated pq_arena struct.
+ */
+pq_arena* pq_new_arena(const size_t chunk_sz);
+
+/**
+ * @brief Safe deallocation of a pq_arena struct, every allocation of the arena is deallocated.
+ *
+ * @param arena The arena that will be deallocated.
+ */
+void pq_del_arena(pq_arena* arena);
+
+/**
+ * @brief Allocates from the next chunk of the arena, it is used when the current chunk is full.
+ *
+ * @param arena The arena that will be used.
+ * @param size The number of bytes, a multiple of PQ_ARENA_ALIGN.
+ * @return A pointer to the allocated bytes, NULL if there is not enough memory.
+ */
+void* pq_arena_alloc_slow(pq_arena* arena, const size_t size);
+
+/**
+ * @brief Allocates bytes from the arena, they are deallocated by pq_arena_reset or pq_del_arena functions.
+ *
+ * @param arena The arena that will be used.
+ * @param size The number of bytes.
+ * @return A pointer to the allocated bytes aligned to PQ_ARENA_ALIGN, NULL if there is not enough memory.
+ */
+static inline void* pq_arena_alloc(pq_arena* arena, size_t size)
+{
+    size = (size + PQ_ARENA_ALIGN - 1) & ~(size_t)(PQ_ARENA_ALIGN - 1);
+    if(size > (size_t)(arena->end - arena->ptr)) return pq_arena_alloc_slow(arena, size);
+
+    void* mem = arena->ptr;
+    arena->ptr += size;
+    return mem;
+}
+
+/**
+ * @brief Deallocates every allocation of the arena in constant time.
+ * The chunks are kept and reused by the following allocations, so the memory of the arena stays at its highest use.
+ *
+ * @param arena The arena that will be reset.
+ */
+static inline void pq_arena_reset(pq_arena* arena)
+{
+    arena->curr = arena->head;
+    arena->ptr = arena->head->data;
+    arena->end = arena->head->data + arena->head->cap;
+}
+
+#endif
@@ -0,0 +1,191 @@
+/**
+ * @file pq_atom.c
+ * @author Brandon Foster
+ * @brief poqer-lang atom table implementation.
+ * 
+ * @version 0.001
+ * @date 10-16-2026
+ * @copyright Brandon Foster (c) 2020-2021
+ */
+
+#include "pq_atom.h"
+#include <stdlib.h>
+
+#define PQ_ATOM_INIT_CAP 256
+#define PQ_ATOM_BLOCK_SIZE 65536
+
+//the predefined atoms are usable before the table is initialized, their entries are copied into the table upon initialization.
+static pq_atom_entry pq_atom_predefined_entries[] = {
+#define PQ_ATOM_ENTRY(id, name) { name, sizeof(name) - 1, 0 },
+    PQ_ATOM_PREDEFINED(PQ_ATOM_ENTRY)
+#undef PQ_ATOM_ENTRY
+};
+
+pq_atom_table pq_atoms = { pq_atom_predefined_entries, PQ_ATOM_PREDEFINED_COUNT, 0, NULL, 0, NULL, 0, 0 };
+
+/**
+ * @brief Finds the slot of an atom name, it either holds the atom id or is the empty slot where the name belongs.
+ * 
+ * @param name The utf8 name of the atom.
+ * @param hash The hash of the name.
+ * @return The index of the slot.
+ */
+static inline uint32_t pq_atom_find_slot(const pq_lexeme name, const uint32_t hash)
+{
+    uint32_t i = hash & pq_atoms.slot_mask;
+    for(;;)
+    {   //linear probing, the table is never more than half full so an empty slot is always found.
+        pq_atom atom = pq_atoms.slots[i];
+        if(atom == PQ_ATOM_NONE) return i;
+
+        const pq_atom_entry* entry = &pq_atoms.entries[atom];
+        if(entry->hash == hash && entry->len == name.len && memcmp(entry->name, name.str, name.len) == 0)
+            return i;
+        i = (i + 1) & pq_atoms.slot_mask;
+    }
+}
+
+/**
+ * @brief Doubles the number of slots and reinserts every atom.
+ * 
+ * @return PQ_SUCCESS if the slots were reallocated else PQ_FAILURE.
+ */
+static int pq_atom_grow_slots(void)
+{
+    uint32_t slot_cnt = (pq_atoms.slot_mask + 1) << 1;
+    pq_atom* slots = malloc(slot_cnt * sizeof(pq_atom));
+    if(!slots) return PQ_FAILURE;
+    memset(slots, 0xFF, slot_cnt * sizeof(pq_atom)); //every slot is PQ_ATOM_NONE.
+
+    free(pq_atoms.slots);
+    pq_atoms.slots = slots;
+    pq_atoms.slot_mask = slot_cnt - 1;
+    for(pq_atom atom = 0; atom < pq_atoms.count; ++atom)
+    {   //the stored hashes avoid rehashing the names.
+        uint32_t i = pq_atoms.entries[atom].hash & pq_atoms.slot_mask;
+        while(slots[i] != PQ_ATOM_NONE) i = (i + 1) & pq_atoms.slot_mask;
+        slots[i] = atom;
+    }
+    return PQ_SUCCESS;
+}
+
+/**
+ * @brief Initializes the table with the predefined atoms if it is not already initialized.
+ * 
+ * @return PQ_SUCCESS if the table is initialized else PQ_FAILURE.
+ */
+static int pq_atom_table_init(void)
+{
+    if(pq_atoms.slots) return PQ_SUCCESS;
+
+    pq_atom_entry* entries = malloc(PQ_ATOM_INIT_CAP * sizeof(pq_atom_entry));
+    if(!entries) return PQ_FAILURE;
+    for(pq_atom atom = 0; atom < PQ_ATOM_PREDEFINED_COUNT; ++atom)
+    {
+        entries[atom] = pq_atom_predefined_entries[atom];
+        entries[atom].hash = pq_atom_hash(pq_make_lexeme(entries[atom].name, entries[atom].len));
+    }
+    pq_atoms.entries = entries;
+    pq_atoms.count = PQ_ATOM_PREDEFINED_COUNT;
+    pq_atoms.cap = PQ_ATOM_INIT_CAP;
+
+    pq_atoms.slot_mask = PQ_ATOM_INIT_CAP - 1; //grown to twice the entries.
+    if(pq_atom_grow_slots() != PQ_SUCCESS)
+    {
+        pq_atom_table_free();
+        return PQ_FAILURE;
+    }
+    return PQ_SUCCESS;
+}
+
+/**
+ * @brief Copies an atom name into the current block, a new block is allocated if it does not fit.
+ * 
+ * @param name The utf8 name of the atom.
+ * @return The null-terminated copy of the name, NULL if there is not enough memory.
+ */
+static char* pq_atom_store_name(const pq_lexeme name)
+{
+    size_t name_sz = name.len + 1; //+1 for the null character.
+    if(!pq_atoms.block || pq_atoms.block_used + name_sz > pq_atoms.block_sz)
+    {   //long names get a block of their own.
+        size_t block_sz = sizeof(char*) + name_sz > PQ_ATOM_BLOCK_SIZE ? sizeof(char*) + name_sz : PQ_ATOM_BLOCK_SIZE;
+        char* block = malloc(block_sz);
+        if(!block) return NULL;
+        memcpy(block, &pq_atoms.block, sizeof(char*));
+        pq_atoms.block = block;
+        pq_atoms.block_used = sizeof(char*);
+        pq_atoms.block_sz = block_sz;
+    }
+
+    char* str = pq_atoms.block + pq_atoms.block_used;
+    memcpy(str, name.str, name.len);
+    str[name.len] = '\0';
+    pq_atoms.block_used += name_sz;
+    return str;
+}
+
+pq_atom pq_atom_intern(const pq_lexeme name)
+{
+    if(pq_atom_table_init() != PQ_SUCCESS) return PQ_ATOM_NONE;
+
+    uint32_t hash = pq_atom_hash(name);
+    uint32_t i = pq_atom_find_slot(name, hash);
+    if(pq_atoms.slots[i] != PQ_ATOM_NONE) return pq_atoms.slots[i];
+
+    //a new atom, makes room for its entry.
+    if(pq_atoms.count == pq_atoms.cap)
+    {
+        if(pq_atoms.cap >= PQ_ATOM_NONE >> 1) return PQ_ATOM_NONE;
+        pq_atom_entry* entries = realloc(pq_atoms.entries, (size_t)(pq_atoms.cap << 1) * sizeof(pq_atom_entry));
+        if(!entries) return PQ_ATOM_NONE;
+        pq_atoms.entries = entries;
+        pq_atoms.cap <<= 1;
+    }
+
+    char* str = pq_atom_store_name(name);
+    if(!str) return PQ_ATOM_NONE;
+
+    pq_atom atom = pq_atoms.count++;
+    pq_atoms.entries[atom].name = str;
+    pq_atoms.entries[atom].len = (uint32_t)name.len;
+    pq_atoms.entries[atom].hash = hash;
+    pq_atoms.slots[i] = atom;
+
+    //keeps the slots at most half full.
+    if(pq_atoms.count > (pq_atoms.slot_mask + 1) >> 1 && pq_atom_grow_slots() != PQ_SUCCESS)
+    {   //the atom was inserted, but probing needs an empty slot, so it is undone.
+        pq_atoms.slots[i] = PQ_ATOM_NONE;
+        pq_atoms.count--;
+        return PQ_ATOM_NONE;
+    }
+    return atom;
+}
+
+pq_atom pq_atom_lookup(const pq_lexeme name)
+{
+    if(pq_atom_table_init() != PQ_SUCCESS) return PQ_ATOM_NONE;
+    return pq_atoms.slots[pq_atom_find_slot(name, pq_atom_hash(name))];
+}
+
+void pq_atom_table_free(void)
+{
+    while(pq_atoms.block)
+    {
+        char* prev;
+        memcpy(&prev, pq_atoms.block, sizeof(char*));
+        free(pq_atoms.block);
+        pq_atoms.block = prev;
+    }
+    if(pq_atoms.cap > 0) free(pq_atoms.entries);
+    free(pq_atoms.slots);
+
+    //resets back to the predefined atoms.
+    pq_atoms.entries = pq_atom_predefined_entries;
+    pq_atoms.count = PQ_ATOM_PREDEFINED_COUNT;
+    pq_atoms.cap = 0;
+    pq_atoms.slots = NULL;
+    pq_atoms.slot_mask = 0;
+    pq_atoms.block_used = 0;
+    pq_atoms.block_sz = 0;
+}
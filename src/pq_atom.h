@@ -0,0 +1,233 @@
+/**
+ * @file pq_atom.h
+ * @author Brandon Foster
+ * @brief poqer-lang atom table header.
+ * atoms are interned into a global table that maps each distinct utf8 name to a stable 32-bit id,
+ * so atoms are compared as integers and each name is stored once.
+ * intern a name with pq_atom_intern function and get it back with pq_atom_get_name function.
+ * the atoms of the PQ_ATOM_PREDEFINED list have constant ids.
+ * release the table with pq_atom_table_free function.
+ * 
+ * @version 0.001
+ * @date 10-16-2026
+ * @copyright Brandon Foster (c) 2020-2021
+ */
+
+#ifndef _PQ_ATOM_H
+#define _PQ_ATOM_H
+#include "pq_globals.h"
+
+typedef uint32_t pq_atom;
+
+//an id that is never given to an atom.
+#define PQ_ATOM_NONE ((pq_atom)UINT32_MAX)
+
+//the atoms that are interned before any other, in the order of their ids.
+#define PQ_ATOM_PREDEFINED(X) \
+    X(PQ_ATOM_EMPTY, "") \
+    X(PQ_ATOM_NIL, "[]") \
+    X(PQ_ATOM_CURLY, "{}") \
+    X(PQ_ATOM_DOT, ".") \
+    X(PQ_ATOM_COMMA, ",") \
+    X(PQ_ATOM_BAR, "|") \
+    X(PQ_ATOM_SEMICOLON, ";") \
+    X(PQ_ATOM_CUT, "!") \
+    X(PQ_ATOM_NECK, ":-") \
+    X(PQ_ATOM_QUERY, "?-") \
+    X(PQ_ATOM_DCG_ARROW, "-->") \
+    X(PQ_ATOM_IF_THEN, "->") \
+    X(PQ_ATOM_UNIFY, "=") \
+    X(PQ_ATOM_NOT_UNIFY, "\\=") \
+    X(PQ_ATOM_EQ, "==") \
+    X(PQ_ATOM_NOT_EQ, "\\==") \
+    X(PQ_ATOM_STD_LT, "@<") \
+    X(PQ_ATOM_STD_LE, "@=<") \
+    X(PQ_ATOM_STD_GT, "@>") \
+    X(PQ_ATOM_STD_GE, "@>=") \
+    X(PQ_ATOM_UNIV, "=..") \
+    X(PQ_ATOM_IS, "is") \
+    X(PQ_ATOM_ARITH_EQ, "=:=") \
+    X(PQ_ATOM_ARITH_NE, "=\\=") \
+    X(PQ_ATOM_LT, "<") \
+    X(PQ_ATOM_LE, "=<") \
+    X(PQ_ATOM_GT, ">") \
+    X(PQ_ATOM_GE, ">=") \
+    X(PQ_ATOM_PLUS, "+") \
+    X(PQ_ATOM_MINUS, "-") \
+    X(PQ_ATOM_BIT_AND, "/\\") \
+    X(PQ_ATOM_BIT_OR, "\\/") \
+    X(PQ_ATOM_TIMES, "*") \
+    X(PQ_ATOM_DIVIDE, "/") \
+    X(PQ_ATOM_INT_DIVIDE, "//") \
+    X(PQ_ATOM_REM, "rem") \
+    X(PQ_ATOM_MOD, "mod") \
+    X(PQ_ATOM_SHIFT_LEFT, "<<") \
+    X(PQ_ATOM_SHIFT_RIGHT, ">>") \
+    X(PQ_ATOM_POWER, "**") \
+    X(PQ_ATOM_CARET, "^") \
+    X(PQ_ATOM_NOT_PROVABLE, "\\+") \
+    X(PQ_ATOM_BIT_NOT, "\\") \
+    X(PQ_ATOM_TRUE, "true") \
+    X(PQ_ATOM_FAIL, "fail") \
+    X(PQ_ATOM_END_OF_FILE, "end_of_file") \
+    X(PQ_ATOM_OP, "op") \
+    X(PQ_ATOM_XFX, "xfx") \
+    X(PQ_ATOM_XFY, "xfy") \
+    X(PQ_ATOM_YFX, "yfx") \
+    X(PQ_ATOM_FX, "fx") \
+    X(PQ_ATOM_FY, "fy") \
+    X(PQ_ATOM_XF, "xf") \
+    X(PQ_ATOM_YF, "yf") \
+    X(PQ_ATOM_FALSE, "false") \
+    X(PQ_ATOM_CALL, "call") \
+    X(PQ_ATOM_LOCAL_CUT, "$local_cut") \
+    X(PQ_ATOM_QUERY_PRED, "$query") \
+    X(PQ_ATOM_DIV, "div") \
+    X(PQ_ATOM_XOR, "xor") \
+    X(PQ_ATOM_MIN, "min") \
+    X(PQ_ATOM_MAX, "max") \
+    X(PQ_ATOM_ABS, "abs") \
+    X(PQ_ATOM_SIGN, "sign") \
+    X(PQ_ATOM_SQRT, "sqrt") \
+    X(PQ_ATOM_SIN, "sin") \
+    X(PQ_ATOM_COS, "cos") \
+    X(PQ_ATOM_TAN, "tan") \
+    X(PQ_ATOM_ATAN, "atan") \
+    X(PQ_ATOM_EXP, "exp") \
+    X(PQ_ATOM_LOG, "log") \
+    X(PQ_ATOM_FLOAT, "float") \
+    X(PQ_ATOM_INTEGER, "integer") \
+    X(PQ_ATOM_FLOAT_INTEGER_PART, "float_integer_part") \
+    X(PQ_ATOM_FLOAT_FRACTIONAL_PART, "float_fractional_part") \
+    X(PQ_ATOM_TRUNCATE, "truncate") \
+    X(PQ_ATOM_ROUND, "round") \
+    X(PQ_ATOM_CEILING, "ceiling") \
+    X(PQ_ATOM_FLOOR, "floor") \
+    X(PQ_ATOM_PI, "pi") \
+    X(PQ_ATOM_E, "e") \
+    X(PQ_ATOM_RUNTIME, "runtime") \
+    X(PQ_ATOM_CPUTIME, "cputime") \
+    X(PQ_ATOM_WALLTIME, "walltime") \
+    X(PQ_ATOM_INFERENCES, "inferences") \
+    X(PQ_ATOM_GARBAGE_COLLECTION, "garbage_collection") \
+    X(PQ_ATOM_OCCURS_CHECK, "occurs_check") \
+    X(PQ_ATOM_ERROR, "error") \
+    X(PQ_ATOM_TABLE, "table") \
+    X(PQ_ATOM_TABLED_CALL, "$tbl") \
+    X(PQ_ATOM_COMPLETE, "complete") \
+    X(PQ_ATOM_CONSUME, "consume") \
+    X(PQ_ATOM_EVALUATE, "evaluate")
+
+//the ids of the predefined atoms.
+typedef enum pq_predefined_atom
+{
+#define PQ_ATOM_ENUM(id, name) id,
+    PQ_ATOM_PREDEFINED(PQ_ATOM_ENUM)
+#undef PQ_ATOM_ENUM
+    PQ_ATOM_PREDEFINED_COUNT
+} pq_predefined_atom;
+
+/**
+ * @brief An interned atom name.
+ */
+typedef struct pq_atom_entry
+{
+    PQstr name; //the null-terminated utf8 name, it is never moved or deallocated while the table is alive.
+    uint32_t len; //the number of bytes in the name, excluding the null character.
+    uint32_t hash; //the hash of the name, kept for rehashing.
+} pq_atom_entry;
+
+/**
+ * @brief The structure of the global atom table.
+ */
+typedef struct pq_atom_table
+{   //these variables should only be read externally, not modified.
+
+    pq_atom_entry* entries; //the names indexed by atom id.
+    uint32_t count; //the number of interned atoms.
+    uint32_t cap; //the number of entries allocated.
+
+    //open addressing hash set of atom ids, an empty slot is PQ_ATOM_NONE.
+    pq_atom* slots;
+    uint32_t slot_mask; //the number of slots minus 1, the number of slots is a power of 2.
+
+    //the names are bump allocated from blocks, each block starts with a pointer to the previous block.
+    char* block;
+    size_t block_used;
+    size_t block_sz;
+} pq_atom_table;
+
+extern pq_atom_table pq_atoms;
+
+/**
+ * @brief Interns an atom name into the global table.
+ * The name is copied the first time it is interned, after that the same id is returned for it.
+ * 
+ * @param name The utf8 name of the atom, it does not need to outlive the call.
+ * @return The id of the atom, PQ_ATOM_NONE if there is not enough memory.
+ */
+pq_atom pq_atom_intern(const pq_lexeme name);
+
+/**
+ * @brief Finds the id of an atom name without interning it.
+ * 
+ * @param name The utf8 name of the atom.
+ * @return The id of the atom, PQ_ATOM_NONE if the name was never interned.
+ */
+pq_atom pq_atom_lookup(const pq_lexeme name);
+
+/**
+ * @brief Deallocates the global table, every atom id except the predefined ones becomes invalid.
+ */
+void pq_atom_table_free(void);
+
+/**
+ * @brief Hashes an atom name (or any other lexeme) with 32-bit FNV-1a.
+ * 
+ * @param name The utf8 name of the atom.
+ * @return The hash of the name.
+ */
+static inline uint32_t pq_atom_hash(const pq_lexeme name)
+{
+    uint32_t hash = 2166136261u;
+    for(size_t i = 0; i < name.len; ++i)
+    {
+        hash ^= (uint8_t)name.str[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * @brief Gets the name of an interned atom.
+ * 
+ * @param atom The id of the atom.
+ * @return The name of the atom, it is null-terminated and valid while the table is alive.
+ */
+static inline pq_lexeme pq_atom_get_name(const pq_atom atom)
+{
+    return pq_make_lexeme(pq_atoms.entries[atom].name, pq_atoms.entries[atom].len);
+}
+
+/**
+ * @brief Gets the name of an interned atom as a c-string.
+ * 
+ * @param atom The id of the atom.
+ * @return The null-terminated utf8 name of the atom.
+ */
+static inline PQstr pq_atom_get_cstr(const pq_atom atom)
+{
+    return pq_atoms.entries[atom].name;
+}
+
+/**
+ * @brief Gets the number of interned atoms, which is also the next atom id.
+ * 
+ * @return The number of interned atoms.
+ */
+static inline uint32_t pq_atom_get_count(void)
+{
+    return pq_atoms.count;
+}
+
+#endif
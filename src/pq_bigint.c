@@ -0,0 +1,906 @@
+/**
+ * @file pq_bigint.c
+ * @author Brandon Foster
+ * @brief poqer-lang arbitrary-precision integer implementation.
+ * the limb quotients use the 128-bit integers of the compiler if it has them, else they are split in 32-bit halves.
+ * the products of large magnitudes use Karatsuba's algorithm, and their quotients use the recursive division of Burnikel and Ziegler.
+ * the decimal conversions split the digits in halves by powers of 10, so they cost a few products instead of a quadratic loop.
+ *
+ * @version 0.001
+ * @date 10-16-2026
+ * @copyright Brandon Foster (c) 2020-2021
+ */
+
+#include "pq_bigint.h"
+#include <math.h>
+
+//the largest power of 10 in a limb, a chunk of decimal digits.
+#define PQ_BIGINT_DEC_CHUNK 10000000000000000000ull
+#define PQ_BIGINT_DEC_CHUNK_DIGITS 19
+
+//the sizes in limbs from which the subquadratic algorithms are used, PQ_BIGINT_NAIVE keeps the quadratic ones (see bench/bigint.pl).
+#ifndef PQ_BIGINT_NAIVE
+#define PQ_BIGINT_KARATSUBA_THRESHOLD 40
+#define PQ_BIGINT_DIV_THRESHOLD 64
+#define PQ_BIGINT_CONVERT_THRESHOLD 32
+#else
+#define PQ_BIGINT_KARATSUBA_THRESHOLD SIZE_MAX
+#define PQ_BIGINT_DIV_THRESHOLD SIZE_MAX
+#define PQ_BIGINT_CONVERT_THRESHOLD SIZE_MAX
+#endif
+
+//the number of powers 10^(19 * 2^k) of a conversion, the last one is above every magnitude that fits in memory.
+#define PQ_BIGINT_POWERS_MAX 64
+
+//the powers of 10 that split the digits of a decimal conversion in halves.
+typedef struct pq_bigint_powers
+{
+    pq_limb* limbs[PQ_BIGINT_POWERS_MAX]; //the power 10^(19 * 2^k) is at k.
+    size_t sizes[PQ_BIGINT_POWERS_MAX];
+    size_t count;
+} pq_bigint_powers;
+
+/**
+ * @brief Divides two limbs by a limb.
+ *
+ * @param hi The high limb of the dividend, hi < d.
+ * @param lo The low limb of the dividend.
+ * @param d The divisor.
+ * @param rem Receives the remainder.
+ * @return The quotient.
+ */
+static inline pq_limb pq_bigint_div_wide(const pq_limb hi, const pq_limb lo, const pq_limb d, pq_limb* rem)
+{
+#ifdef PQ_BIGINT_WIDE
+    const pq_wide_limb n = (pq_wide_limb)hi << 64 | lo;
+    *rem = (pq_limb)(n % d);
+    return (pq_limb)(n / d);
+#else
+    //the divisor is normalized, then each 32-bit half of the quotient is estimated by the high half of the divisor (Hacker's Delight).
+    const pq_limb b = (pq_limb)1 << 32;
+    const unsigned s = pq_bigint_clz(d);
+    const pq_limb v = d << s;
+    const pq_limb vn1 = v >> 32, vn0 = v & 0xFFFFFFFFu;
+    const pq_limb un32 = hi << s | (s ? lo >> (64 - s) : 0);
+    const pq_limb un10 = lo << s;
+    const pq_limb un1 = un10 >> 32, un0 = un10 & 0xFFFFFFFFu;
+
+    pq_limb q1 = un32 / vn1;
+    pq_limb rhat = un32 - q1 * vn1;
+    while(q1 >= b || q1 * vn0 > b * rhat + un1)
+    {
+        --q1;
+        rhat += vn1;
+        if(rhat >= b) break;
+    }
+    const pq_limb un21 = un32 * b + un1 - q1 * v;
+    pq_limb q0 = un21 / vn1;
+    rhat = un21 - q0 * vn1;
+    while(q0 >= b || q0 * vn0 > b * rhat + un0)
+    {
+        --q0;
+        rhat += vn1;
+        if(rhat >= b) break;
+    }
+    *rem = (un21 * b + un0 - q0 * v) >> s;
+    return q1 * b + q0;
+#endif
+}
+
+int pq_bigint_compare(const pq_limb* a, const size_t an, const pq_limb* b, const size_t bn)
+{
+    if(an != bn) return an < bn ? -1 : 1;
+    for(size_t i = an; i-- > 0;)
+        if(a[i] != b[i]) return a[i] < b[i] ? -1 : 1;
+    return 0;
+}
+
+size_t pq_bigint_add(pq_limb* r, const pq_limb* a, const size_t an, const pq_limb* b, const size_t bn)
+{
+    if(an < bn) return pq_bigint_add(r, b, bn, a, an);
+
+    pq_limb carry = 0;
+    size_t i = 0;
+    for(; i < bn; ++i)
+    {
+        const pq_limb x = a[i];
+        const pq_limb sum = x + b[i];
+        r[i] = sum + carry;
+        carry = (sum < x) | (r[i] < sum);
+    }
+    for(; i < an; ++i)
+    {
+        r[i] = a[i] + carry;
+        carry = r[i] < carry;
+    }
+    r[an] = carry;
+    return an + carry;
+}
+
+size_t pq_bigint_sub(pq_limb* r, const pq_limb* a, const size_t an, const pq_limb* b, const size_t bn)
+{
+    pq_limb borrow = 0;
+    size_t i = 0;
+    for(; i < bn; ++i)
+    {
+        const pq_limb x = a[i];
+        const pq_limb diff = x - b[i];
+        r[i] = diff - borrow;
+        borrow = (diff > x) | (borrow > diff);
+    }
+    for(; i < an; ++i)
+    {
+        const pq_limb x = a[i];
+        r[i] = x - borrow;
+        borrow = borrow > x;
+    }
+    return pq_bigint_normalize(r, an);
+}
+
+/**
+ * @brief Adds a magnitude to a magnitude in place, both have a fixed number of limbs.
+ *
+ * @param r The first magnitude, it receives the sum.
+ * @param rn The number of limbs of the first magnitude.
+ * @param a The second magnitude.
+ * @param an The number of limbs of the second magnitude, an <= rn.
+ * @return The carry out of the sum.
+ */
+static inline pq_limb pq_bigint_add_in(pq_limb* r, const size_t rn, const pq_limb* a, const size_t an)
+{
+    pq_limb carry = 0;
+    size_t i = 0;
+    for(; i < an; ++i)
+    {
+        const pq_limb sum = r[i] + a[i];
+        const pq_limb carry_out = sum < a[i];
+        r[i] = sum + carry;
+        carry = carry_out | (r[i] < sum);
+    }
+    for(; carry && i < rn; ++i) carry = !++r[i];
+    return carry;
+}
+
+/**
+ * @brief Subtracts a magnitude from a magnitude in place, both have a fixed number of limbs.
+ *
+ * @param r The first magnitude, it receives the difference.
+ * @param rn The number of limbs of the first magnitude.
+ * @param a The second magnitude.
+ * @param an The number of limbs of the second magnitude, an <= rn.
+ * @return The borrow out of the difference.
+ */
+static inline pq_limb pq_bigint_sub_in(pq_limb* r, const size_t rn, const pq_limb* a, const size_t an)
+{
+    pq_limb borrow = 0;
+    size_t i = 0;
+    for(; i < an; ++i)
+    {
+        const pq_limb x = r[i];
+        const pq_limb diff = x - a[i];
+        r[i] = diff - borrow;
+        borrow = (diff > x) | (borrow > diff);
+    }
+    for(; borrow && i < rn; ++i) borrow = !r[i]--;
+    return borrow;
+}
+
+/**
+ * @brief Subtracts 1 from a magnitude in place.
+ *
+ * @param r The magnitude.
+ * @param rn The number of limbs of the magnitude.
+ * @return The borrow out of the difference.
+ */
+static inline pq_limb pq_bigint_decrement(pq_limb* r, const size_t rn)
+{
+    for(size_t i = 0; i < rn; ++i)
+        if(r[i]--) return 0;
+    return 1;
+}
+
+/**
+ * @brief Multiplies two magnitudes with the schoolbook algorithm.
+ *
+ * @param r The product, all the an + bn limbs are written, it is neither a nor b.
+ * @param a The first magnitude.
+ * @param an The number of limbs of the first magnitude.
+ * @param b The second magnitude.
+ * @param bn The number of limbs of the second magnitude.
+ */
+static void pq_bigint_mul_basecase(pq_limb* r, const pq_limb* a, const size_t an, const pq_limb* b, const size_t bn)
+{
+    //the first row is stored, the next rows are added to it.
+    pq_limb carry = 0;
+    for(size_t j = 0; j < bn; ++j)
+    {
+        pq_limb hi;
+        const pq_limb lo = pq_bigint_mul_wide(a[0], b[j], &hi);
+        r[j] = lo + carry;
+        carry = hi + (r[j] < lo);
+    }
+    r[bn] = carry;
+
+    for(size_t i = 1; i < an; ++i)
+    {
+        carry = 0;
+        for(size_t j = 0; j < bn; ++j)
+        {
+            pq_limb hi;
+            pq_limb lo = pq_bigint_mul_wide(a[i], b[j], &hi);
+            lo += carry;
+            hi += lo < carry;
+            r[i + j] += lo;
+            hi += r[i + j] < lo;
+            carry = hi;
+        }
+        r[i + bn] = carry;
+    }
+}
+
+/**
+ * @brief Gets the number of scratch limbs of pq_bigint_mul_karatsuba.
+ *
+ * @param an The number of limbs of the longer magnitude.
+ * @return The number of scratch limbs.
+ */
+static inline size_t pq_bigint_karatsuba_scratch(const size_t an)
+{
+    //each level takes about twice the limbs of its operand plus 16 limbs, and there are fewer than 64 levels.
+    return 4 * an + 16 * 64;
+}
+
+/**
+ * @brief Multiplies two magnitudes with Karatsuba's algorithm, 3 half-size products instead of 4.
+ *
+ * @param r The product, all the an + bn limbs are written, it is neither a nor b.
+ * @param a The first magnitude.
+ * @param an The number of limbs of the first magnitude, an >= bn.
+ * @param b The second magnitude.
+ * @param bn The number of limbs of the second magnitude.
+ * @param scratch The scratch memory, it has room for pq_bigint_karatsuba_scratch(an) limbs.
+ */
+static void pq_bigint_mul_karatsuba(pq_limb* r, const pq_limb* a, const size_t an, const pq_limb* b, const size_t bn, pq_limb* scratch)
+{
+    if(bn < PQ_BIGINT_KARATSUBA_THRESHOLD)
+    {
+        pq_bigint_mul_basecase(r, a, an, b, bn);
+        return;
+    }
+
+    if(an >= 2 * bn)
+    {   //the longer magnitude is cut in pieces of the size of the shorter one, the products of the pieces are balanced.
+        pq_limb* t = scratch;
+        pq_bigint_mul_karatsuba(r, a, bn, b, bn, scratch);
+        memset(r + 2 * bn, 0, (an - bn) * sizeof(pq_limb));
+        for(size_t i = bn; i < an; i += bn)
+        {
+            const size_t len = an - i < bn ? an - i : bn;
+            pq_bigint_mul_karatsuba(t, b, bn, a + i, len, scratch + 2 * bn);
+            pq_bigint_add_in(r + i, an + bn - i, t, bn + len);
+        }
+        return;
+    }
+
+    //a = a1 * B^m + a0 and b = b1 * B^m + b0, then the middle product is (a0 + a1)(b0 + b1) - a0 * b0 - a1 * b1.
+    const size_t m = an / 2;
+    const size_t a1n = an - m;
+    const size_t b1n = bn - m;
+    pq_bigint_mul_karatsuba(r, a, m, b, m, scratch);
+    pq_bigint_mul_karatsuba(r + 2 * m, a + m, a1n, b + m, b1n, scratch);
+
+    pq_limb* sa = scratch;
+    const size_t san = a1n + 1;
+    memcpy(sa, a + m, a1n * sizeof(pq_limb));
+    sa[a1n] = pq_bigint_add_in(sa, a1n, a, m);
+
+    pq_limb* sb = sa + san;
+    const size_t sbn = (m > b1n ? m : b1n) + 1;
+    memset(sb, 0, sbn * sizeof(pq_limb));
+    memcpy(sb, b, m * sizeof(pq_limb));
+    pq_bigint_add_in(sb, sbn, b + m, b1n);
+
+    pq_limb* p = sb + sbn;
+    const size_t pn = san + sbn;
+    pq_bigint_mul_karatsuba(p, sa, san, sb, sbn, p + pn);
+    pq_bigint_sub_in(p, pn, r, 2 * m);
+    pq_bigint_sub_in(p, pn, r + 2 * m, an + bn - 2 * m);
+    pq_bigint_add_in(r + m, an + bn - m, p, pq_bigint_normalize(p, pn));
+}
+
+/**
+ * @brief Multiplies two magnitudes with the algorithm that suits their sizes.
+ *
+ * @param r The product, all the an + bn limbs are written, it is neither a nor b.
+ * @param a The first magnitude.
+ * @param an The number of limbs of the first magnitude.
+ * @param b The second magnitude.
+ * @param bn The number of limbs of the second magnitude.
+ * @param scratch The scratch memory of pq_bigint_mul_karatsuba for the longer magnitude.
+ */
+static inline void pq_bigint_mul_any(pq_limb* r, const pq_limb* a, const size_t an, const pq_limb* b, const size_t bn, pq_limb* scratch)
+{
+    if(an < bn) pq_bigint_mul_karatsuba(r, b, bn, a, an, scratch);
+    else pq_bigint_mul_karatsuba(r, a, an, b, bn, scratch);
+}
+
+size_t pq_bigint_mul(pq_limb* r, const pq_limb* a, const size_t an, const pq_limb* b, const size_t bn)
+{
+    if(!an || !bn) return 0;
+
+    const size_t longest = an > bn ? an : bn;
+    pq_limb* scratch = NULL;
+    if((an < bn ? an : bn) >= PQ_BIGINT_KARATSUBA_THRESHOLD)
+        scratch = (pq_limb*)malloc(pq_bigint_karatsuba_scratch(longest) * sizeof(pq_limb));
+
+    //without the scratch memory, the product is still computed by the schoolbook algorithm.
+    if(scratch) pq_bigint_mul_any(r, a, an, b, bn, scratch);
+    else pq_bigint_mul_basecase(r, a, an, b, bn);
+    free(scratch);
+    return pq_bigint_normalize(r, an + bn);
+}
+
+size_t pq_bigint_mul_limb_add(pq_limb* a, const size_t n, const pq_limb m, const pq_limb add)
+{
+    pq_limb carry = add;
+    for(size_t i = 0; i < n; ++i)
+    {
+        pq_limb hi;
+        const pq_limb lo = pq_bigint_mul_wide(a[i], m, &hi);
+        a[i] = lo + carry;
+        carry = hi + (a[i] < lo);
+    }
+    a[n] = carry;
+    return pq_bigint_normalize(a, n + 1);
+}
+
+pq_limb pq_bigint_div_limb(pq_limb* q, const pq_limb* a, const size_t n, const pq_limb d)
+{
+    pq_limb rem = 0;
+    for(size_t i = n; i-- > 0;) q[i] = pq_bigint_div_wide(rem, a[i], d, &rem);
+    return rem;
+}
+
+/**
+ * @brief Divides a magnitude by a normalized magnitude in place (Knuth's algorithm D).
+ *
+ * @param q The quotient, all the un - vn limbs are written.
+ * @param u The dividend, its top vn limbs are below v, the remainder is left in its low vn limbs.
+ * @param un The number of limbs of the dividend.
+ * @param v The divisor, the top bit of its top limb is set.
+ * @param vn The number of limbs of the divisor, vn >= 2.
+ */
+static void pq_bigint_divrem_basecase(pq_limb* q, pq_limb* u, const size_t un, const pq_limb* v, const size_t vn)
+{
+    //the top bit of the divisor is set, so the estimate of each quotient limb is at most 2 too large.
+    for(size_t j = un - vn; j-- > 0;)
+    {
+        pq_limb rhat;
+        pq_limb qhat;
+        PQbool rhat_overflows = PQ_FALSE;
+        if(u[j + vn] >= v[vn - 1])
+        {
+            qhat = ~(pq_limb)0;
+            rhat = u[j + vn - 1] + v[vn - 1];
+            rhat_overflows = rhat < v[vn - 1];
+        }
+        else qhat = pq_bigint_div_wide(u[j + vn], u[j + vn - 1], v[vn - 1], &rhat);
+
+        while(!rhat_overflows)
+        {   //qhat * v[vn - 2] > rhat * 2^64 + u[j + vn - 2], the estimate is too large.
+            pq_limb hi;
+            const pq_limb lo = pq_bigint_mul_wide(qhat, v[vn - 2], &hi);
+            if(hi < rhat || (hi == rhat && lo <= u[j + vn - 2])) break;
+            --qhat;
+            rhat += v[vn - 1];
+            rhat_overflows = rhat < v[vn - 1];
+        }
+
+        //u[j..j + vn] -= qhat * v.
+        pq_limb carry = 0;
+        pq_limb borrow = 0;
+        for(size_t i = 0; i < vn; ++i)
+        {
+            pq_limb hi;
+            pq_limb lo = pq_bigint_mul_wide(qhat, v[i], &hi);
+            lo += carry;
+            hi += lo < carry;
+            carry = hi;
+            const pq_limb x = u[i + j];
+            const pq_limb diff = x - lo;
+            u[i + j] = diff - borrow;
+            borrow = (diff > x) | (borrow > diff);
+        }
+        const pq_limb top = u[j + vn];
+        u[j + vn] = top - carry - borrow;
+        if(top < carry || top - carry < borrow)
+        {   //the estimate was 1 too large, v is added back.
+            --qhat;
+            u[j + vn] += pq_bigint_add_in(u + j, vn, v, vn);
+        }
+        q[j] = qhat;
+    }
+}
+
+static pq_limb pq_bigint_divrem_part(pq_limb* q, pq_limb* a, const pq_limb* b, const size_t n, const size_t k, pq_limb* scratch);
+
+/**
+ * @brief Divides a magnitude of 2n limbs by a normalized magnitude of n limbs in place, recursively (Burnikel and Ziegler).
+ *
+ * @param q The low n limbs of the quotient.
+ * @param a The dividend, its top n limbs are not above b, the remainder is left in its low n limbs.
+ * @param b The divisor, the top bit of its top limb is set.
+ * @param n The number of limbs of the divisor, n >= 2.
+ * @param scratch The scratch memory, it has room for n + pq_bigint_karatsuba_scratch(n) limbs.
+ * @return The top limb of the quotient, 0 or 1.
+ */
+static pq_limb pq_bigint_divrem_recursive(pq_limb* q, pq_limb* a, const pq_limb* b, const size_t n, pq_limb* scratch)
+{
+    if(n < PQ_BIGINT_DIV_THRESHOLD)
+    {
+        const pq_limb qh = pq_bigint_compare(a + n, n, b, n) >= 0;
+        if(qh) pq_bigint_sub_in(a + n, n, b, n);
+        pq_bigint_divrem_basecase(q, a, 2 * n, b, n);
+        return qh;
+    }
+
+    //the top half of the quotient, then the bottom half from the partial remainder, which is below b.
+    const size_t lo = n / 2;
+    const size_t hi = n - lo;
+    const pq_limb qh = pq_bigint_divrem_part(q + lo, a + lo, b, n, hi, scratch);
+    pq_bigint_divrem_part(q, a, b, n, lo, scratch);
+    return qh;
+}
+
+/**
+ * @brief Divides a magnitude of n + k limbs by a normalized magnitude of n limbs in place, for k limbs of quotient.
+ * the quotient is estimated by dividing by the top k limbs of the divisor, then corrected by the product of the other limbs.
+ *
+ * @param q The low k limbs of the quotient.
+ * @param a The dividend, its top n limbs are not above b, the remainder is left in its low n limbs.
+ * @param b The divisor, the top bit of its top limb is set.
+ * @param n The number of limbs of the divisor.
+ * @param k The number of limbs of the quotient, 2 <= k <= n.
+ * @param scratch The scratch memory, it has room for n + pq_bigint_karatsuba_scratch(n) limbs.
+ * @return The top limb of the quotient, 0 or 1.
+ */
+static pq_limb pq_bigint_divrem_part(pq_limb* q, pq_limb* a, const pq_limb* b, const size_t n, const size_t k, pq_limb* scratch)
+{
+    if(k == n) return pq_bigint_divrem_recursive(q, a, b, n, scratch);
+
+    pq_limb qh = pq_bigint_divrem_recursive(q, a + n - k, b + n - k, k, scratch);
+    pq_limb* t = scratch;
+    pq_bigint_mul_any(t, b, n - k, q, k, scratch + n);
+    pq_limb borrow = pq_bigint_sub_in(a, n, t, n);
+    if(qh) borrow += pq_bigint_sub_in(a + k, n - k, b, n - k);
+    while(borrow)
+    {   //the estimate was too large, b is added back.
+        qh -= pq_bigint_decrement(q, k);
+        borrow -= pq_bigint_add_in(a, n, b, n);
+    }
+    return qh;
+}
+
+/**
+ * @brief Divides a magnitude by a normalized magnitude in place, in blocks of quotient limbs that are divided recursively.
+ *
+ * @param q The quotient, all the un - vn limbs are written.
+ * @param u The dividend, its top vn limbs are below v, the remainder is left in its low vn limbs.
+ * @param un The number of limbs of the dividend.
+ * @param v The divisor, the top bit of its top limb is set.
+ * @param vn The number of limbs of the divisor, vn >= 2.
+ * @return PQ_TRUE if the division was done, PQ_FALSE if there is not enough memory.
+ */
+static PQbool pq_bigint_divrem_blocks(pq_limb* q, pq_limb* u, const size_t un, const pq_limb* v, const size_t vn)
+{
+    pq_limb* scratch = (pq_limb*)malloc((vn + pq_bigint_karatsuba_scratch(vn)) * sizeof(pq_limb));
+    if(!scratch) return PQ_FALSE;
+
+    //the top block takes the remainder of the quotient limbs, the next blocks have vn limbs.
+    const size_t qn = un - vn;
+    const size_t top = qn % vn;
+    if(top == 1) pq_bigint_divrem_basecase(q + qn - 1, u + qn - 1, vn + 1, v, vn);
+    else if(top) pq_bigint_divrem_part(q + qn - top, u + qn - top, v, vn, top, scratch);
+    for(size_t i = qn / vn; i-- > 0;) pq_bigint_divrem_recursive(q + i * vn, u + i * vn, v, vn, scratch);
+    free(scratch);
+    return PQ_TRUE;
+}
+
+void pq_bigint_divmod(pq_limb* q, size_t* qn, pq_limb* r, size_t* rn,
+    const pq_limb* a, const size_t an, const pq_limb* b, const size_t bn, pq_limb* scratch)
+{
+    if(bn == 1)
+    {
+        r[0] = pq_bigint_div_limb(q, a, an, b[0]);
+        *qn = pq_bigint_normalize(q, an);
+        *rn = r[0] != 0;
+        return;
+    }
+
+    //the divisor is shifted until its top bit is set, the top limb of the dividend takes the bits that are shifted out.
+    const unsigned s = pq_bigint_clz(b[bn - 1]);
+    pq_limb* u = scratch;
+    pq_limb* v = scratch + an + 1;
+    pq_bigint_shift_left(v, b, bn, s);
+    u[an] = 0;
+    pq_bigint_shift_left(u, a, an, s);
+
+    //the recursive division needs its own memory, without it the quotient is still computed by algorithm D.
+    const PQbool recursive = bn >= PQ_BIGINT_DIV_THRESHOLD && an - bn + 1 >= PQ_BIGINT_DIV_THRESHOLD;
+    if(!recursive || !pq_bigint_divrem_blocks(q, u, an + 1, v, bn)) pq_bigint_divrem_basecase(q, u, an + 1, v, bn);
+
+    *qn = pq_bigint_normalize(q, an - bn + 1);
+    *rn = pq_bigint_shift_right(r, u, pq_bigint_normalize(u, bn), s);
+}
+
+size_t pq_bigint_shift_left(pq_limb* r, const pq_limb* a, const size_t n, const size_t bits)
+{
+    if(!n) return 0;
+
+    //from the top, so r can be a.
+    const size_t limbs = bits / 64;
+    const unsigned s = (unsigned)(bits % 64);
+    if(!s)
+    {
+        for(size_t i = n; i-- > 0;) r[i + limbs] = a[i];
+    }
+    else
+    {
+        r[n + limbs] = a[n - 1] >> (64 - s);
+        for(size_t i = n - 1; i > 0; --i) r[i + limbs] = a[i] << s | a[i - 1] >> (64 - s);
+        r[limbs] = a[0] << s;
+    }
+    for(size_t i = 0; i < limbs; ++i) r[i] = 0;
+    return pq_bigint_normalize(r, n + limbs + (s != 0));
+}
+
+size_t pq_bigint_shift_right(pq_limb* r, const pq_limb* a, const size_t n, const size_t bits)
+{
+    const size_t limbs = bits / 64;
+    if(limbs >= n) return 0;
+
+    //from the bottom, so r can be a.
+    const unsigned s = (unsigned)(bits % 64);
+    const size_t m = n - limbs;
+    if(!s)
+    {
+        for(size_t i = 0; i < m; ++i) r[i] = a[i + limbs];
+    }
+    else
+    {
+        for(size_t i = 0; i + 1 < m; ++i) r[i] = a[i + limbs] >> s | a[i + limbs + 1] << (64 - s);
+        r[m - 1] = a[n - 1] >> s;
+    }
+    return pq_bigint_normalize(r, m);
+}
+
+/**
+ * @brief Computes the powers of 10 that split the digits of a magnitude in halves.
+ *
+ * @param powers The powers that will be initialized.
+ * @param n The size of the magnitude, the last power is at least the square root of every magnitude of that size.
+ * @return PQ_TRUE if the powers were computed, PQ_FALSE if there is not enough memory.
+ */
+static PQbool pq_bigint_powers_init(pq_bigint_powers* powers, const size_t n)
+{
+    powers->count = 0;
+    pq_limb* power = (pq_limb*)malloc(sizeof(pq_limb));
+    if(!power) return PQ_FALSE;
+    power[0] = PQ_BIGINT_DEC_CHUNK;
+    powers->limbs[0] = power;
+    powers->sizes[0] = 1;
+    powers->count = 1;
+
+    //the square of a power has at least 2 * size - 1 limbs.
+    while(powers->count < PQ_BIGINT_POWERS_MAX && 2 * powers->sizes[powers->count - 1] - 1 <= n)
+    {
+        const pq_limb* last = powers->limbs[powers->count - 1];
+        const size_t last_sz = powers->sizes[powers->count - 1];
+        power = (pq_limb*)malloc(2 * last_sz * sizeof(pq_limb));
+        if(!power)
+        {
+            for(size_t i = 0; i < powers->count; ++i) free(powers->limbs[i]);
+            return PQ_FALSE;
+        }
+        powers->sizes[powers->count] = pq_bigint_mul(power, last, last_sz, last, last_sz);
+        powers->limbs[powers->count++] = power;
+    }
+    return PQ_TRUE;
+}
+
+static void pq_bigint_powers_free(pq_bigint_powers* powers)
+{
+    for(size_t i = 0; i < powers->count; ++i) free(powers->limbs[i]);
+    powers->count = 0;
+}
+
+static inline pq_limb pq_bigint_digit_value(const char c)
+{
+    if(c <= '9') return (pq_limb)(c - '0');
+    if(c <= 'F') return (pq_limb)(c - 'A' + 10);
+    return (pq_limb)(c - 'a' + 10);
+}
+
+/**
+ * @brief Converts decimal digits into a magnitude, a chunk of digits at a time.
+ *
+ * @param r The magnitude, it has room for pq_bigint_digits_limbs(len, 10) limbs.
+ * @param digits The decimal digits.
+ * @param len The number of digits.
+ * @return The size of the magnitude.
+ */
+static size_t pq_bigint_from_decimal_basecase(pq_limb* r, const char* digits, const size_t len)
+{
+    //the first chunk takes the remainder of the digits.
+    size_t n = 0;
+    size_t i = 0;
+    size_t chunk_len = len % PQ_BIGINT_DEC_CHUNK_DIGITS;
+    if(!chunk_len) chunk_len = PQ_BIGINT_DEC_CHUNK_DIGITS;
+    for(; i < len; chunk_len = PQ_BIGINT_DEC_CHUNK_DIGITS)
+    {
+        pq_limb chunk = 0;
+        pq_limb scale = 1;
+        for(size_t end = i + chunk_len; i < end; ++i)
+        {
+            chunk = chunk * 10 + pq_bigint_digit_value(digits[i]);
+            scale *= 10;
+        }
+        n = pq_bigint_mul_limb_add(r, n, scale, chunk);
+    }
+    return n;
+}
+
+/**
+ * @brief Converts decimal digits into a magnitude, the top digits are multiplied by the power of 10 of the bottom digits.
+ *
+ * @param r The magnitude, it has room for pq_bigint_digits_limbs(len, 10) limbs.
+ * @param digits The decimal digits.
+ * @param len The number of digits.
+ * @param powers The powers of 10.
+ * @return The size of the magnitude.
+ */
+static size_t pq_bigint_from_decimal_recursive(pq_limb* r, const char* digits, const size_t len, const pq_bigint_powers* powers)
+{
+    if(len / PQ_BIGINT_DEC_CHUNK_DIGITS < PQ_BIGINT_CONVERT_THRESHOLD) return pq_bigint_from_decimal_basecase(r, digits, len);
+
+    //the bottom digits are the digits of the largest power below the number of digits.
+    size_t k = 0;
+    while(k + 1 < powers->count && ((size_t)PQ_BIGINT_DEC_CHUNK_DIGITS << (k + 1)) < len) ++k;
+    const size_t lo_len = (size_t)PQ_BIGINT_DEC_CHUNK_DIGITS << k;
+    const size_t hi_len = len - lo_len;
+    const size_t hi_room = pq_bigint_digits_limbs(hi_len, 10);
+    pq_limb* hi = (pq_limb*)malloc((hi_room + pq_bigint_digits_limbs(lo_len, 10)) * sizeof(pq_limb));
+    if(!hi) return pq_bigint_from_decimal_basecase(r, digits, len);
+
+    pq_limb* lo = hi + hi_room;
+    const size_t hi_sz = pq_bigint_from_decimal_recursive(hi, digits, hi_len, powers);
+    const size_t lo_sz = pq_bigint_from_decimal_recursive(lo, digits + hi_len, lo_len, powers);
+    size_t n = pq_bigint_mul(r, hi, hi_sz, powers->limbs[k], powers->sizes[k]);
+    n = pq_bigint_add(r, r, n, lo, lo_sz);
+    free(hi);
+    return n;
+}
+
+size_t pq_bigint_from_digits(pq_limb* r, const char* digits, const size_t len, const int base)
+{
+    if(base != 10)
+    {   //the bits of each digit are packed from the least significant digit.
+        const unsigned bits = base == 2 ? 1 : base == 8 ? 3 : 4;
+        const size_t limbs = pq_bigint_digits_limbs(len, base);
+        memset(r, 0, limbs * sizeof(pq_limb));
+        size_t pos = 0;
+        for(size_t i = len; i-- > 0; pos += bits)
+        {
+            const pq_limb val = pq_bigint_digit_value(digits[i]);
+            r[pos / 64] |= val << (pos % 64);
+            if(pos % 64 + bits > 64) r[pos / 64 + 1] |= val >> (64 - pos % 64);
+        }
+        return pq_bigint_normalize(r, limbs);
+    }
+
+    pq_bigint_powers powers;
+    if(len / PQ_BIGINT_DEC_CHUNK_DIGITS < PQ_BIGINT_CONVERT_THRESHOLD || !pq_bigint_powers_init(&powers, len / PQ_BIGINT_DEC_CHUNK_DIGITS + 1))
+        return pq_bigint_from_decimal_basecase(r, digits, len);
+    const size_t n = pq_bigint_from_decimal_recursive(r, digits, len, &powers);
+    pq_bigint_powers_free(&powers);
+    return n;
+}
+
+/**
+ * @brief Writes the decimal digits of a magnitude backward, a chunk of digits at a time.
+ *
+ * @param end The end of the digits.
+ * @param a The magnitude, it is destroyed.
+ * @param n The size of the magnitude.
+ * @param width The number of digits that the digits are padded to with leading zeros, 0 for no padding.
+ * @return The number of digits.
+ */
+static size_t pq_bigint_to_decimal_basecase(char* end, pq_limb* a, size_t n, const size_t width)
+{
+    char* p = end;
+    while(n)
+    {
+        pq_limb chunk = pq_bigint_div_limb(a, a, n, PQ_BIGINT_DEC_CHUNK);
+        n = pq_bigint_normalize(a, n);
+        for(unsigned i = 0; i < PQ_BIGINT_DEC_CHUNK_DIGITS && (n || chunk); ++i)
+        {
+            *--p = (char)('0' + chunk % 10);
+            chunk /= 10;
+        }
+    }
+    while((size_t)(end - p) < width) *--p = '0';
+    return (size_t)(end - p);
+}
+
+/**
+ * @brief Writes the decimal digits of a magnitude backward, the quotient and remainder by a power of 10 are written recursively.
+ *
+ * @param end The end of the digits.
+ * @param a The magnitude, it is below the square of the power at k, it is destroyed.
+ * @param n The size of the magnitude.
+ * @param powers The powers of 10.
+ * @param k The index of the power that splits the magnitude.
+ * @param width The number of digits that the digits are padded to with leading zeros, 0 for no padding.
+ * @return The number of digits.
+ */
+static size_t pq_bigint_to_decimal_recursive(char* end, pq_limb* a, const size_t n, const pq_bigint_powers* powers, const size_t k, const size_t width)
+{
+    if(!k || n < PQ_BIGINT_CONVERT_THRESHOLD) return pq_bigint_to_decimal_basecase(end, a, n, width);
+
+    const pq_limb* power = powers->limbs[k];
+    const size_t power_sz = powers->sizes[k];
+    if(n < power_sz) return pq_bigint_to_decimal_recursive(end, a, n, powers, k - 1, width);
+
+    pq_limb* q = (pq_limb*)malloc((n - power_sz + 1 + power_sz + n + power_sz + 2) * sizeof(pq_limb));
+    if(!q) return pq_bigint_to_decimal_basecase(end, a, n, width);
+
+    //the remainder is padded to the digits of the power, unless the quotient is 0 and nothing is padded.
+    size_t qn;
+    size_t rn;
+    pq_limb* r = q + n - power_sz + 1;
+    pq_bigint_divmod(q, &qn, r, &rn, a, n, power, power_sz, r + power_sz);
+    const size_t lo_width = (size_t)PQ_BIGINT_DEC_CHUNK_DIGITS << k;
+    size_t len;
+    if(!qn && !width) len = pq_bigint_to_decimal_recursive(end, r, rn, powers, k - 1, 0);
+    else
+    {
+        len = pq_bigint_to_decimal_recursive(end, r, rn, powers, k - 1, lo_width);
+        len += pq_bigint_to_decimal_recursive(end - len, q, qn, powers, k - 1, width ? width - lo_width : 0);
+    }
+    free(q);
+    return len;
+}
+
+size_t pq_bigint_to_digits(char* str, pq_limb* a, size_t n)
+{
+    if(!n)
+    {
+        strcpy(str, "0");
+        return 1;
+    }
+
+    //the digits are written from the least significant, from the end of the room.
+    char* end = str + 20 * n + 1;
+    *end = '\0';
+    size_t len;
+    pq_bigint_powers powers;
+    if(n >= PQ_BIGINT_CONVERT_THRESHOLD && pq_bigint_powers_init(&powers, n))
+    {
+        len = pq_bigint_to_decimal_recursive(end, a, n, &powers, powers.count - 1, 0);
+        pq_bigint_powers_free(&powers);
+    }
+    else len = pq_bigint_to_decimal_basecase(end, a, n, 0);
+    memmove(str, end - len, len + 1);
+    return len;
+}
+
+PQflt pq_bigint_to_float(const pq_limb* a, const size_t n)
+{
+    if(!n) return 0;
+    if(n == 1) return (PQflt)a[0];
+    if(n > 17) return HUGE_VAL;
+
+    //the top 64 bits, the lowest bit is set if a bit below them is set, so the conversion rounds to the nearest float.
+    const unsigned s = pq_bigint_clz(a[n - 1]);
+    pq_limb top = a[n - 1] << s;
+    pq_limb below = a[n - 2];
+    if(s)
+    {
+        top |= a[n - 2] >> (64 - s);
+        below = a[n - 2] << s;
+    }
+    for(size_t i = 0; i + 2 < n && !below; ++i) below = a[i];
+    top |= below != 0;
+    return ldexp((PQflt)top, (int)((n - 1) * 64 - s));
+}
+
+size_t pq_bigint_from_float(pq_limb* r, const PQflt val)
+{
+    int exp;
+    const PQflt frac = frexp(fabs(val), &exp);
+    if(exp <= 0) return 0;
+
+    //the 53 bits of the mantissa, then the exponent shifts them.
+    const pq_limb mantissa = (pq_limb)ldexp(frac, 53);
+    if(exp <= 53)
+    {
+        r[0] = mantissa >> (53 - exp);
+        return r[0] != 0;
+    }
+    r[0] = mantissa;
+    return pq_bigint_shift_left(r, r, 1, (size_t)exp - 53);
+}
+
+pq_term pq_new_bigint_term(pq_arena* arena, const pq_lexeme lexeme, const PQbool neg)
+{
+    int base = 10;
+    const char* digits = lexeme.str;
+    size_t len = lexeme.len;
+    if(len > 2 && digits[0] == '0' && (digits[1] == 'b' || digits[1] == 'o' || digits[1] == 'x'))
+    {
+        base = digits[1] == 'b' ? 2 : digits[1] == 'o' ? 8 : 16;
+        digits += 2;
+        len -= 2;
+    }
+
+    const size_t limbs = pq_bigint_digits_limbs(len, base);
+    pq_term* cells = (pq_term*)pq_arena_alloc(arena, (limbs + 2) * sizeof(pq_term));
+    if(!cells) return PQ_TERM_NONE;
+    const size_t n = pq_bigint_from_digits(cells + 2, digits, len, base);
+
+    PQint val;
+    if(pq_bigint_fits_int(cells + 2, n, neg, &val)) return pq_new_integer_term(arena, val);
+    cells[0] = pq_make_box_cell(PQ_BOX_BIGINT, (uint32_t)n + 1);
+    cells[1] = neg;
+    return pq_make_ptr_term(cells, PQ_TAG_BOX);
+}
+
+int pq_bigint_compare_terms(const pq_term a, const pq_term b)
+{
+    const PQbool a_big = pq_term_is_bigint(a);
+    const PQbool b_big = pq_term_is_bigint(b);
+    if(!a_big && !b_big)
+    {
+        const PQint x = pq_term_get_int(a);
+        const PQint y = pq_term_get_int(b);
+        return x < y ? -1 : x > y;
+    }
+
+    //a bignum is beyond every PQint.
+    const pq_term* x = pq_term_get_ptr(a);
+    const pq_term* y = pq_term_get_ptr(b);
+    if(!b_big) return pq_bigint_is_negative(x) ? -1 : 1;
+    if(!a_big) return pq_bigint_is_negative(y) ? 1 : -1;
+    if(pq_bigint_is_negative(x) != pq_bigint_is_negative(y)) return pq_bigint_is_negative(x) ? -1 : 1;
+    const int diff = pq_bigint_compare(pq_bigint_get_limbs(x), pq_bigint_get_size(x), pq_bigint_get_limbs(y), pq_bigint_get_size(y));
+    return pq_bigint_is_negative(x) ? -diff : diff;
+}
+
+PQflt pq_bigint_term_to_float(const pq_term term)
+{
+    if(!pq_term_is_bigint(term)) return (PQflt)pq_term_get_int(term);
+
+    const pq_term* box = pq_term_get_ptr(term);
+    const PQflt val = pq_bigint_to_float(pq_bigint_get_limbs(box), pq_bigint_get_size(box));
+    return pq_bigint_is_negative(box) ? -val : val;
+}
+
+char* pq_bigint_to_cstr(const pq_term term)
+{
+    const pq_term* box = pq_term_get_ptr(term);
+    const size_t n = pq_bigint_get_size(box);
+    char* str = (char*)malloc(20 * n + 3); //+1 for the sign, +2 for the room of pq_bigint_to_digits function.
+    pq_limb* limbs = (pq_limb*)malloc(n * sizeof(pq_limb));
+    if(!str || !limbs)
+    {
+        free(str);
+        free(limbs);
+        return NULL;
+    }
+
+    memcpy(limbs, pq_bigint_get_limbs(box), n * sizeof(pq_limb));
+    str[0] = '-';
+    pq_bigint_to_digits(str + pq_bigint_is_negative(box), limbs, n);
+    free(limbs);
+    return str;
+}
@@ -0,0 +1,361 @@
+/**
+ * @file pq_bigint.h
+ * @author Brandon Foster
+ * @brief poqer-lang arbitrary-precision integer header.
+ * an integer that does not fit in a PQint is a bignum, a box of the kind PQ_BOX_BIGINT.
+ * the data cells of the box are the sign (1 if negative else 0), then the magnitude in 64-bit limbs with the least significant first.
+ * the magnitude has no leading zero limb and never fits in a PQint, so two bignums are equal only if their cells are.
+ *
+ * the pq_bigint_* functions work on magnitudes, arrays of limbs that are owned by the caller.
+ * the size of a magnitude is its number of limbs without the leading zero limbs, 0 is the size of zero.
+ * the algorithms for large magnitudes allocate their own scratch memory, without it they fall back to the quadratic ones.
+ * the pq_int_*_overflow functions are the checked arithmetic of PQint, an overflow promotes the result to a bignum.
+ *
+ * @version 0.001
+ * @date 10-16-2026
+ * @copyright Brandon Foster (c) 2020-2021
+ */
+
+#ifndef _PQ_BIGINT_H
+#define _PQ_BIGINT_H
+#include "pq_globals.h"
+#include "pq_term.h"
+#include "pq_arena.h"
+#include <stdlib.h>
+
+typedef uint64_t pq_limb;
+
+#if defined(__GNUC__) && defined(__SIZEOF_INT128__)
+#define PQ_BIGINT_WIDE 1
+__extension__ typedef unsigned __int128 pq_wide_limb;
+#endif
+
+//the number of limbs of a magnitude that is converted from a float, a finite double is below 2^1024.
+#define PQ_BIGINT_FLOAT_LIMBS 18
+
+/**
+ * @brief Adds two integers with an overflow check.
+ *
+ * @param a The first integer.
+ * @param b The second integer.
+ * @param result The sum, it wraps around on overflow.
+ * @return PQ_TRUE if the sum overflows else PQ_FALSE.
+ */
+static inline PQbool pq_int_add_overflow(const PQint a, const PQint b, PQint* result)
+{
+#if defined(__GNUC__) && (__GNUC__ >= 5 || defined(__clang__))
+    return (PQbool)__builtin_add_overflow(a, b, result);
+#else
+    *result = (PQint)((uint64_t)a + (uint64_t)b);
+    return (PQbool)((a < 0) == (b < 0) && (*result < 0) != (a < 0));
+#endif
+}
+
+static inline PQbool pq_int_sub_overflow(const PQint a, const PQint b, PQint* result)
+{
+#if defined(__GNUC__) && (__GNUC__ >= 5 || defined(__clang__))
+    return (PQbool)__builtin_sub_overflow(a, b, result);
+#else
+    *result = (PQint)((uint64_t)a - (uint64_t)b);
+    return (PQbool)((a < 0) != (b < 0) && (*result < 0) != (a < 0));
+#endif
+}
+
+static inline PQbool pq_int_mul_overflow(const PQint a, const PQint b, PQint* result)
+{
+#if defined(__GNUC__) && (__GNUC__ >= 5 || defined(__clang__))
+    return (PQbool)__builtin_mul_overflow(a, b, result);
+#else
+    *result = (PQint)((uint64_t)a * (uint64_t)b);
+    if(!a || !b) return PQ_FALSE;
+    if((a == -1 && b == INT64_MIN) || (b == -1 && a == INT64_MIN)) return PQ_TRUE;
+    return (PQbool)(*result / b != a);
+#endif
+}
+
+/**
+ * @brief Counts the leading zero bits of a limb.
+ *
+ * @param x The limb, it is not 0.
+ * @return The number of leading zero bits.
+ */
+static inline unsigned pq_bigint_clz(const pq_limb x)
+{
+#if defined(__GNUC__)
+    return (unsigned)__builtin_clzll(x);
+#else
+    unsigned n = 0;
+    for(pq_limb bit = (pq_limb)1 << 63; !(x & bit); bit >>= 1) ++n;
+    return n;
+#endif
+}
+
+/**
+ * @brief Multiplies two limbs, with the 128-bit integers of the compiler if it has them, else in 32-bit halves.
+ *
+ * @param a The first limb.
+ * @param b The second limb.
+ * @param hi Receives the high limb of the product.
+ * @return The low limb of the product.
+ */
+static inline pq_limb pq_bigint_mul_wide(const pq_limb a, const pq_limb b, pq_limb* hi)
+{
+#ifdef PQ_BIGINT_WIDE
+    const pq_wide_limb p = (pq_wide_limb)a * b;
+    *hi = (pq_limb)(p >> 64);
+    return (pq_limb)p;
+#else
+    const pq_limb a0 = a & 0xFFFFFFFFu, a1 = a >> 32;
+    const pq_limb b0 = b & 0xFFFFFFFFu, b1 = b >> 32;
+    const pq_limb p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+    const pq_limb mid = (p00 >> 32) + (p01 & 0xFFFFFFFFu) + (p10 & 0xFFFFFFFFu);
+    *hi = p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+    return mid << 32 | (p00 & 0xFFFFFFFFu);
+#endif
+}
+
+/**
+ * @brief Gets the size of a magnitude without its leading zero limbs.
+ *
+ * @param a The magnitude.
+ * @param n The number of limbs.
+ * @return The size of the magnitude.
+ */
+static inline size_t pq_bigint_normalize(const pq_limb* a, size_t n)
+{
+    while(n && !a[n - 1]) --n;
+    return n;
+}
+
+/**
+ * @brief Checks if a signed magnitude fits in a PQint.
+ *
+ * @param a The magnitude.
+ * @param n The size of the magnitude.
+ * @param neg Whether the integer is negative.
+ * @param val Receives the integer if it fits.
+ * @return PQ_TRUE if the integer fits else PQ_FALSE.
+ */
+static inline PQbool pq_bigint_fits_int(const pq_limb* a, const size_t n, const PQbool neg, PQint* val)
+{
+    if(n > 1) return PQ_FALSE;
+    const pq_limb mag = n ? a[0] : 0;
+    if(mag > (neg ? (pq_limb)INT64_MAX + 1 : (pq_limb)INT64_MAX)) return PQ_FALSE;
+    *val = neg ? (PQint)(0 - mag) : (PQint)mag;
+    return PQ_TRUE;
+}
+
+/*
+    the accessors of a bignum box, box is the header cell.
+*/
+
+static inline PQbool pq_bigint_is_negative(const pq_term* box)
+{
+    return box[1] != 0;
+}
+
+static inline const pq_limb* pq_bigint_get_limbs(const pq_term* box)
+{
+    return (const pq_limb*)box + 2;
+}
+
+static inline size_t pq_bigint_get_size(const pq_term* box)
+{
+    return (size_t)(box[0] >> 32) - 1;
+}
+
+/**
+ * @brief Compares two magnitudes.
+ *
+ * @param a The first magnitude.
+ * @param an The size of the first magnitude.
+ * @param b The second magnitude.
+ * @param bn The size of the second magnitude.
+ * @return -1, 0, or 1.
+ */
+int pq_bigint_compare(const pq_limb* a, const size_t an, const pq_limb* b, const size_t bn);
+
+/**
+ * @brief Adds two magnitudes.
+ *
+ * @param r The sum, it has room for max(an, bn) + 1 limbs, it can be a or b.
+ * @param a The first magnitude.
+ * @param an The size of the first magnitude.
+ * @param b The second magnitude.
+ * @param bn The size of the second magnitude.
+ * @return The size of the sum.
+ */
+size_t pq_bigint_add(pq_limb* r, const pq_limb* a, const size_t an, const pq_limb* b, const size_t bn);
+
+/**
+ * @brief Subtracts a magnitude from a magnitude that is not smaller.
+ *
+ * @param r The difference, it has room for an limbs, it can be a or b.
+ * @param a The first magnitude, a >= b.
+ * @param an The size of the first magnitude.
+ * @param b The second magnitude.
+ * @param bn The size of the second magnitude.
+ * @return The size of the difference.
+ */
+size_t pq_bigint_sub(pq_limb* r, const pq_limb* a, const size_t an, const pq_limb* b, const size_t bn);
+
+/**
+ * @brief Multiplies two magnitudes, with Karatsuba's algorithm if both are large.
+ *
+ * @param r The product, it has room for an + bn limbs, it is neither a nor b.
+ * @param a The first magnitude.
+ * @param an The size of the first magnitude.
+ * @param b The second magnitude.
+ * @param bn The size of the second magnitude.
+ * @return The size of the product.
+ */
+size_t pq_bigint_mul(pq_limb* r, const pq_limb* a, const size_t an, const pq_limb* b, const size_t bn);
+
+/**
+ * @brief Multiplies a magnitude by a limb and adds a limb, in place.
+ *
+ * @param a The magnitude, it has room for n + 1 limbs.
+ * @param n The size of the magnitude.
+ * @param m The multiplier.
+ * @param add The addend.
+ * @return The size of the result.
+ */
+size_t pq_bigint_mul_limb_add(pq_limb* a, const size_t n, const pq_limb m, const pq_limb add);
+
+/**
+ * @brief Divides a magnitude by a limb.
+ *
+ * @param q The quotient, it has room for n limbs, it can be a.
+ * @param a The magnitude.
+ * @param n The size of the magnitude.
+ * @param d The divisor, it is not 0.
+ * @return The remainder.
+ */
+pq_limb pq_bigint_div_limb(pq_limb* q, const pq_limb* a, const size_t n, const pq_limb d);
+
+/**
+ * @brief Divides two magnitudes, the quotient is truncated (Knuth's algorithm D, recursive division if both are large).
+ *
+ * @param q The quotient, it has room for an - bn + 1 limbs.
+ * @param qn Receives the size of the quotient.
+ * @param r The remainder, it has room for bn limbs.
+ * @param rn Receives the size of the remainder.
+ * @param a The dividend.
+ * @param an The size of the dividend, an >= bn.
+ * @param b The divisor.
+ * @param bn The size of the divisor, it is not 0.
+ * @param scratch The scratch memory, it has room for an + bn + 2 limbs.
+ */
+void pq_bigint_divmod(pq_limb* q, size_t* qn, pq_limb* r, size_t* rn,
+    const pq_limb* a, const size_t an, const pq_limb* b, const size_t bn, pq_limb* scratch);
+
+/**
+ * @brief Shifts a magnitude to the left.
+ *
+ * @param r The result, it has room for n + bits / 64 + 1 limbs, it can be a.
+ * @param a The magnitude.
+ * @param n The size of the magnitude.
+ * @param bits The number of bits.
+ * @return The size of the result.
+ */
+size_t pq_bigint_shift_left(pq_limb* r, const pq_limb* a, const size_t n, const size_t bits);
+
+/**
+ * @brief Shifts a magnitude to the right, the bits that are shifted out are dropped.
+ *
+ * @param r The result, it has room for n limbs, it can be a.
+ * @param a The magnitude.
+ * @param n The size of the magnitude.
+ * @param bits The number of bits.
+ * @return The size of the result.
+ */
+size_t pq_bigint_shift_right(pq_limb* r, const pq_limb* a, const size_t n, const size_t bits);
+
+/**
+ * @brief Gets the number of limbs that can hold the value of a number of digits.
+ *
+ * @param len The number of digits.
+ * @param base The base of the digits (2, 8, 10, or 16).
+ * @return The number of limbs.
+ */
+static inline size_t pq_bigint_digits_limbs(const size_t len, const int base)
+{
+    const size_t bits = base == 2 ? 1 : base == 8 ? 3 : 4; //log2(10) < 4.
+    return len * bits / 64 + 2;
+}
+
+/**
+ * @brief Converts digits into a magnitude, a large decimal number is converted by halves.
+ *
+ * @param r The magnitude, it has room for pq_bigint_digits_limbs(len, base) limbs.
+ * @param digits The digits, they were validated (0-9, a-f, or A-F).
+ * @param len The number of digits.
+ * @param base The base of the digits (2, 8, 10, or 16).
+ * @return The size of the magnitude.
+ */
+size_t pq_bigint_from_digits(pq_limb* r, const char* digits, const size_t len, const int base);
+
+/**
+ * @brief Converts a magnitude into decimal digits, a large magnitude is converted by halves.
+ *
+ * @param str The null-terminated digits, it has room for 20 * n + 2 characters.
+ * @param a The magnitude, it is destroyed.
+ * @param n The size of the magnitude.
+ * @return The number of digits.
+ */
+size_t pq_bigint_to_digits(char* str, pq_limb* a, const size_t n);
+
+/**
+ * @brief Converts a magnitude into the nearest float.
+ *
+ * @param a The magnitude.
+ * @param n The size of the magnitude.
+ * @return The float, HUGE_VAL if it is too large.
+ */
+PQflt pq_bigint_to_float(const pq_limb* a, const size_t n);
+
+/**
+ * @brief Converts the absolute value of an integral float into a magnitude.
+ *
+ * @param r The magnitude, it has room for PQ_BIGINT_FLOAT_LIMBS limbs.
+ * @param val The finite integral float.
+ * @return The size of the magnitude.
+ */
+size_t pq_bigint_from_float(pq_limb* r, const PQflt val);
+
+/**
+ * @brief Creates the term of an integer literal, it is a bignum only if it does not fit in a PQint.
+ *
+ * @param arena The arena that the term is allocated from.
+ * @param lexeme The literal, the digits of a decimal integer or the digits after a 0b, 0o, or 0x prefix.
+ * @param neg Whether the literal is negated.
+ * @return The integer term, PQ_TERM_NONE if there is not enough memory.
+ */
+pq_term pq_new_bigint_term(pq_arena* arena, const pq_lexeme lexeme, const PQbool neg);
+
+/**
+ * @brief Compares two integer terms by their value.
+ *
+ * @param a The first integer.
+ * @param b The second integer.
+ * @return -1, 0, or 1.
+ */
+int pq_bigint_compare_terms(const pq_term a, const pq_term b);
+
+/**
+ * @brief Converts an integer term into the nearest float.
+ *
+ * @param term The integer.
+ * @return The float.
+ */
+PQflt pq_bigint_term_to_float(const pq_term term);
+
+/**
+ * @brief Converts a bignum into its decimal text.
+ *
+ * @param term The bignum.
+ * @return The malloc'd null-terminated text, NULL if there is not enough memory.
+ */
+char* pq_bigint_to_cstr(const pq_term term);
+
+#endif
@@ -0,0 +1,1939 @@
+/**
+ * @file pq_builtins.c
+ * @author Brandon Foster
+ * @brief poqer-lang builtin predicates implementation.
+ * the builtins are c functions that run to completion (see pq_builtin_fn), the library predicates are written in poqer-lang
+ * and consulted when the machine is created.
+ *
+ * @version 0.001
+ * @date 10-16-2026
+ * @copyright Brandon Foster (c) 2020-2021
+ */
+
+#include "pq_machine.h"
+#include "pq_bigint.h"
+#include <math.h>
+#include <time.h>
+
+//the predicates that are written in poqer-lang, a consulted clause of the same predicate replaces them.
+static const char* const pq_builtins_library =
+    "append([], L, L).\n"
+    "append([H|T], L, [H|R]) :- append(T, L, R).\n"
+    "member(X, [X|_]).\n"
+    "member(X, [_|T]) :- member(X, T).\n"
+    "memberchk(X, L) :- member(X, L), !.\n"
+    "reverse(L, R) :- '$reverse'(L, [], R).\n"
+    "'$reverse'([], R, R).\n"
+    "'$reverse'([H|T], A, R) :- '$reverse'(T, [H|A], R).\n"
+    "length(L, N) :- var(N), !, '$length'(L, 0, N).\n"
+    "length(L, N) :- integer(N), N >= 0, '$length_make'(N, L).\n"
+    "'$length'([], N, N).\n"
+    "'$length'([_|T], I, N) :- I1 is I + 1, '$length'(T, I1, N).\n"
+    "'$length_make'(0, L) :- !, L = [].\n"
+    "'$length_make'(N, [_|T]) :- N1 is N - 1, '$length_make'(N1, T).\n"
+    "between(L, H, X) :- integer(X), !, X >= L, X =< H.\n"
+    "between(L, H, L) :- L =< H.\n"
+    "between(L, H, X) :- L < H, L1 is L + 1, between(L1, H, X).\n"
+    "once(G) :- call(G), !.\n"
+    "ignore(G) :- (call(G) -> true ; true).\n"
+    "forall(C, A) :- \\+ '$forall_fails'(C, A).\n"
+    "'$forall_fails'(C, A) :- call(C), \\+ call(A).\n"
+    "not(G) :- \\+ call(G).\n"
+    //a tabled predicate evaluates its clauses to a fixpoint, then returns the answers of its table (see pq_table.h).
+    //a consumer also returns the answers that are added while it runs, so an iteration uses them.
+    "'$tbl'(G, I) :- '$tbl_enter'(G, I, T, S), '$tbl_eval'(S, T, G, I).\n"
+    "'$tbl_eval'(complete, T, G, _) :- '$tbl_size'(T, N), '$tbl_answers'(T, G, 0, N).\n"
+    "'$tbl_eval'(consume, T, G, _) :- '$tbl_consume'(T, G, 0).\n"
+    "'$tbl_eval'(evaluate, T, G, I) :- '$tbl_fixpoint'(T, G, I), '$tbl_size'(T, N), '$tbl_answers'(T, G, 0, N).\n"
+    "'$tbl_fixpoint'(T, G, I) :- '$tbl_iterate'(T), (call(I), '$tbl_add'(T, G), fail ; true),\n"
+    "    ('$tbl_again'(T) -> '$tbl_fixpoint'(T, G, I) ; true).\n"
+    "'$tbl_answers'(T, G, I, N) :- I < N, I1 is I + 1, (I1 < N -> ('$tbl_answer'(T, I, G) ; '$tbl_answers'(T, G, I1, N)) ; '$tbl_answer'(T, I, G)).\n"
+    "'$tbl_consume'(T, G, I) :- '$tbl_size'(T, N), I < N, I1 is I + 1, ('$tbl_answer'(T, I, G) ; '$tbl_consume'(T, G, I1)).\n";
+
+/**
+ * @brief Unifies two terms for a builtin.
+ *
+ * @param machine The machine that will be modified.
+ * @param a The first term.
+ * @param b The second term.
+ * @return PQ_BUILTIN_TRUE if the terms were unified else PQ_BUILTIN_FAIL.
+ */
+static inline pq_builtin_result pq_builtins_unify(pq_machine* machine, const pq_term a, const pq_term b)
+{
+    return pq_machine_unify(machine, a, b) ? PQ_BUILTIN_TRUE : PQ_BUILTIN_FAIL;
+}
+
+/**
+ * @brief Checks if two terms unify, the bindings are undone.
+ *
+ * @param machine The machine that will be used.
+ * @param a The first term.
+ * @param b The second term.
+ * @return true if the terms unify else false.
+ */
+static PQbool pq_builtins_unifiable(pq_machine* machine, const pq_term a, const pq_term b)
+{
+    //every binding is trailed while a choice point is above the whole heap.
+    pq_choice probe;
+    pq_choice* b0 = machine->b;
+    const size_t tr = machine->tr;
+    probe.h = machine->h;
+    machine->b = &probe;
+
+    const PQbool unified = pq_machine_unify(machine, a, b);
+    while(machine->tr > tr)
+    {
+        pq_term* cell = machine->trail[--machine->tr];
+        *cell = pq_make_ptr_term(cell, PQ_TAG_REF);
+    }
+    machine->b = b0;
+    return unified;
+}
+
+/**
+ * @brief Creates a compound whose arguments are new variables, a '.'/2 compound is a list cell.
+ *
+ * @param machine The machine that will be modified, upon failure the error is stored here.
+ * @param name The name of the compound.
+ * @param arity The arity of the compound, above 0.
+ * @return The compound, PQ_TERM_NONE if the heap is full.
+ */
+static pq_term pq_builtins_new_compound(pq_machine* machine, const pq_atom name, const uint32_t arity)
+{
+    const PQbool is_list = name == PQ_ATOM_DOT && arity == 2;
+    pq_term* cells = pq_machine_alloc(machine, arity + !is_list);
+    if(!cells) return PQ_TERM_NONE;
+
+    pq_term* args = cells;
+    if(!is_list) *args++ = pq_make_functor_cell(name, arity);
+    for(uint32_t i = 0; i < arity; ++i) args[i] = pq_make_ptr_term(&args[i], PQ_TAG_REF);
+    return pq_make_ptr_term(cells, is_list ? PQ_TAG_LIST : PQ_TAG_STR);
+}
+
+/* control */
+
+static pq_builtin_result pq_builtin_true(pq_machine* machine, pq_term* args)
+{
+    return PQ_BUILTIN_TRUE;
+}
+
+static pq_builtin_result pq_builtin_fail(pq_machine* machine, pq_term* args)
+{
+    return PQ_BUILTIN_FAIL;
+}
+
+static pq_builtin_result pq_builtin_halt(pq_machine* machine, pq_term* args)
+{
+    machine->halted = PQ_TRUE;
+    return PQ_BUILTIN_FAIL;
+}
+
+static pq_builtin_result pq_builtin_call(pq_machine* machine, pq_term* args)
+{
+    return pq_machine_call(machine, args[0], NULL, 0);
+}
+
+//call/N, the extra arguments are appended to the goal.
+#define PQ_BUILTIN_CALL_N(n) \
+    static pq_builtin_result pq_builtin_call##n(pq_machine* machine, pq_term* args) \
+    { \
+        return pq_machine_call(machine, args[0], args + 1, n - 1); \
+    }
+PQ_BUILTIN_CALL_N(2)
+PQ_BUILTIN_CALL_N(3)
+PQ_BUILTIN_CALL_N(4)
+PQ_BUILTIN_CALL_N(5)
+PQ_BUILTIN_CALL_N(6)
+PQ_BUILTIN_CALL_N(7)
+PQ_BUILTIN_CALL_N(8)
+#undef PQ_BUILTIN_CALL_N
+
+/* unification and comparison */
+
+static pq_builtin_result pq_builtin_unify(pq_machine* machine, pq_term* args)
+{
+    return pq_builtins_unify(machine, args[0], args[1]);
+}
+
+static pq_builtin_result pq_builtin_not_unify(pq_machine* machine, pq_term* args)
+{
+    if(pq_builtins_unifiable(machine, args[0], args[1]) || machine->err) return PQ_BUILTIN_FAIL;
+    return PQ_BUILTIN_TRUE;
+}
+
+static pq_builtin_result pq_builtin_eq(pq_machine* machine, pq_term* args)
+{
+    return pq_machine_compare(machine, args[0], args[1]) == 0 ? PQ_BUILTIN_TRUE : PQ_BUILTIN_FAIL;
+}
+
+static pq_builtin_result pq_builtin_not_eq(pq_machine* machine, pq_term* args)
+{
+    return pq_machine_compare(machine, args[0], args[1]) != 0 ? PQ_BUILTIN_TRUE : PQ_BUILTIN_FAIL;
+}
+
+static pq_builtin_result pq_builtin_std_lt(pq_machine* machine, pq_term* args)
+{
+    return pq_machine_compare(machine, args[0], args[1]) < 0 ? PQ_BUILTIN_TRUE : PQ_BUILTIN_FAIL;
+}
+
+static pq_builtin_result pq_builtin_std_le(pq_machine* machine, pq_term* args)
+{
+    return pq_machine_compare(machine, args[0], args[1]) <= 0 ? PQ_BUILTIN_TRUE : PQ_BUILTIN_FAIL;
+}
+
+static pq_builtin_result pq_builtin_std_gt(pq_machine* machine, pq_term* args)
+{
+    return pq_machine_compare(machine, args[0], args[1]) > 0 ? PQ_BUILTIN_TRUE : PQ_BUILTIN_FAIL;
+}
+
+static pq_builtin_result pq_builtin_std_ge(pq_machine* machine, pq_term* args)
+{
+    return pq_machine_compare(machine, args[0], args[1]) >= 0 ? PQ_BUILTIN_TRUE : PQ_BUILTIN_FAIL;
+}
+
+static pq_builtin_result pq_builtin_compare(pq_machine* machine, pq_term* args)
+{
+    const int diff = pq_machine_compare(machine, args[1], args[2]);
+    const pq_atom order = diff < 0 ? PQ_ATOM_LT : (diff > 0 ? PQ_ATOM_GT : PQ_ATOM_UNIFY);
+    return pq_builtins_unify(machine, args[0], pq_new_atom_term(order));
+}
+
+/* type checks */
+
+static pq_builtin_result pq_builtin_var(pq_machine* machine, pq_term* args)
+{
+    return pq_term_is_var(pq_term_deref(args[0])) ? PQ_BUILTIN_TRUE : PQ_BUILTIN_FAIL;
+}
+
+static pq_builtin_result pq_builtin_nonvar(pq_machine* machine, pq_term* args)
+{
+    return !pq_term_is_var(pq_term_deref(args[0])) ? PQ_BUILTIN_TRUE : PQ_BUILTIN_FAIL;
+}
+
+static pq_builtin_result pq_builtin_atom(pq_machine* machine, pq_term* args)
+{
+    return pq_term_is_atom(pq_term_deref(args[0])) ? PQ_BUILTIN_TRUE : PQ_BUILTIN_FAIL;
+}
+
+static pq_builtin_result pq_builtin_number(pq_machine* machine, pq_term* args)
+{
+    const pq_term term = pq_term_deref(args[0]);
+    return pq_term_is_integer(term) || pq_term_is_float(term) ? PQ_BUILTIN_TRUE : PQ_BUILTIN_FAIL;
+}
+
+static pq_builtin_result pq_builtin_integer(pq_machine* machine, pq_term* args)
+{
+    return pq_term_is_integer(pq_term_deref(args[0])) ? PQ_BUILTIN_TRUE : PQ_BUILTIN_FAIL;
+}
+
+static pq_builtin_result pq_builtin_float(pq_machine* machine, pq_term* args)
+{
+    return pq_term_is_float(pq_term_deref(args[0])) ? PQ_BUILTIN_TRUE : PQ_BUILTIN_FAIL;
+}
+
+static pq_builtin_result pq_builtin_atomic(pq_machine* machine, pq_term* args)
+{
+    const pq_term term = pq_term_deref(args[0]);
+    return !pq_term_is_var(term) && !pq_term_is_compound(term) ? PQ_BUILTIN_TRUE : PQ_BUILTIN_FAIL;
+}
+
+static pq_builtin_result pq_builtin_compound(pq_machine* machine, pq_term* args)
+{
+    return pq_term_is_compound(pq_term_deref(args[0])) ? PQ_BUILTIN_TRUE : PQ_BUILTIN_FAIL;
+}
+
+static pq_builtin_result pq_builtin_callable(pq_machine* machine, pq_term* args)
+{
+    const pq_term term = pq_term_deref(args[0]);
+    return pq_term_is_atom(term) || pq_term_is_compound(term) ? PQ_BUILTIN_TRUE : PQ_BUILTIN_FAIL;
+}
+
+static pq_builtin_result pq_builtin_is_list(pq_machine* machine, pq_term* args)
+{
+    pq_term term = pq_term_deref(args[0]);
+    while(pq_term_get_tag(term) == PQ_TAG_LIST) term = pq_term_deref(pq_term_get_ptr(term)[1]);
+    return term == pq_new_atom_term(PQ_ATOM_NIL) ? PQ_BUILTIN_TRUE : PQ_BUILTIN_FAIL;
+}
+
+/* term construction */
+
+static pq_builtin_result pq_builtin_functor(pq_machine* machine, pq_term* args)
+{
+    const pq_term term = pq_term_deref(args[0]);
+    if(!pq_term_is_var(term))
+    {
+        const uint32_t arity = pq_term_get_arity(term);
+        const pq_term name = pq_term_is_compound(term) ? pq_new_atom_term(pq_term_get_name(term)) : term;
+        if(!pq_builtins_unify(machine, args[1], name)) return PQ_BUILTIN_FAIL;
+        return pq_builtins_unify(machine, args[2], (pq_term)arity << PQ_TERM_TAG_BITS | PQ_TAG_INT);
+    }
+
+    const pq_term name = pq_term_deref(args[1]);
+    const pq_term arity = pq_term_deref(args[2]);
+    if(pq_term_is_var(name) || pq_term_is_var(arity))
+    {
+        machine->err = "instantiation error: functor/3 expects a name and an arity.";
+        return PQ_BUILTIN_FAIL;
+    }
+    if(!pq_term_is_integer(arity))
+    {
+        machine->err = "type error: functor/3 expects an integer arity.";
+        return PQ_BUILTIN_FAIL;
+    }
+    if(pq_term_is_bigint(arity) || pq_term_get_int(arity) < 0 || pq_term_get_int(arity) > PQ_TERM_ARITY_MAX)
+    {
+        machine->err = "representation error: functor/3 expects an arity between 0 and the highest arity.";
+        return PQ_BUILTIN_FAIL;
+    }
+    if(!pq_term_get_int(arity)) return pq_term_is_compound(name) ? PQ_BUILTIN_FAIL : pq_builtins_unify(machine, term, name);
+    if(!pq_term_is_atom(name))
+    {
+        machine->err = "type error: functor/3 expects an atom name.";
+        return PQ_BUILTIN_FAIL;
+    }
+
+    const pq_term compound = pq_builtins_new_compound(machine, pq_term_get_atom(name), (uint32_t)pq_term_get_int(arity));
+    if(compound == PQ_TERM_NONE) return PQ_BUILTIN_FAIL;
+    return pq_builtins_unify(machine, term, compound);
+}
+
+static pq_builtin_result pq_builtin_arg(pq_machine* machine, pq_term* args)
+{
+    const pq_term index = pq_term_deref(args[0]);
+    const pq_term term = pq_term_deref(args[1]);
+    if(pq_term_is_var(index) || pq_term_is_var(term))
+    {
+        machine->err = "instantiation error: arg/3 expects an index and a compound.";
+        return PQ_BUILTIN_FAIL;
+    }
+    if(!pq_term_is_integer(index) || !pq_term_is_compound(term))
+    {
+        machine->err = "type error: arg/3 expects an integer index and a compound.";
+        return PQ_BUILTIN_FAIL;
+    }
+    if(pq_term_is_bigint(index)) return PQ_BUILTIN_FAIL;
+    const PQint i = pq_term_get_int(index);
+    if(i < 1 || i > pq_term_get_arity(term)) return PQ_BUILTIN_FAIL;
+    return pq_builtins_unify(machine, args[2], pq_term_get_arg(term, (uint32_t)(i - 1)));
+}
+
+static pq_builtin_result pq_builtin_univ(pq_machine* machine, pq_term* args)
+{
+    const pq_term term = pq_term_deref(args[0]);
+    if(!pq_term_is_var(term))
+    {   //the list is built from its last cell.
+        const uint32_t arity = pq_term_get_arity(term);
+        pq_term* cells = pq_machine_alloc(machine, 2 * ((size_t)arity + 1));
+        if(!cells) return PQ_BUILTIN_FAIL;
+        for(uint32_t i = 0; i <= arity; ++i)
+        {
+            cells[2 * i] = i ? pq_term_get_arg(term, i - 1) : (arity ? pq_new_atom_term(pq_term_get_name(term)) : term);
+            cells[2 * i + 1] = i < arity ? pq_make_ptr_term(&cells[2 * i + 2], PQ_TAG_LIST) : pq_new_atom_term(PQ_ATOM_NIL);
+        }
+        return pq_builtins_unify(machine, args[1], pq_make_ptr_term(cells, PQ_TAG_LIST));
+    }
+
+    //the length of the list is the arity plus 1.
+    const pq_term list = pq_term_deref(args[1]);
+    uint32_t len = 0;
+    pq_term tail = list;
+    while(pq_term_get_tag(tail) == PQ_TAG_LIST && len <= PQ_TERM_ARITY_MAX)
+    {
+        len++;
+        tail = pq_term_deref(pq_term_get_ptr(tail)[1]);
+    }
+    if(pq_term_is_var(tail))
+    {
+        machine->err = "instantiation error: =../2 expects a list.";
+        return PQ_BUILTIN_FAIL;
+    }
+    if(tail != pq_new_atom_term(PQ_ATOM_NIL) || !len)
+    {
+        machine->err = "type error: =../2 expects a non-empty list.";
+        return PQ_BUILTIN_FAIL;
+    }
+
+    const pq_term name = pq_term_deref(pq_term_get_ptr(list)[0]);
+    if(pq_term_is_var(name))
+    {
+        machine->err = "instantiation error: =../2 expects a name.";
+        return PQ_BUILTIN_FAIL;
+    }
+    if(len == 1)
+    {
+        if(pq_term_is_compound(name))
+        {
+            machine->err = "type error: =../2 expects an atomic name.";
+            return PQ_BUILTIN_FAIL;
+        }
+        return pq_builtins_unify(machine, term, name);
+    }
+    if(!pq_term_is_atom(name))
+    {
+        machine->err = "type error: =../2 expects an atom name.";
+        return PQ_BUILTIN_FAIL;
+    }
+
+    const pq_term compound = pq_builtins_new_compound(machine, pq_term_get_atom(name), len - 1);
+    if(compound == PQ_TERM_NONE) return PQ_BUILTIN_FAIL;
+    pq_term* cells = pq_term_get_args(compound);
+    tail = pq_term_deref(pq_term_get_ptr(list)[1]);
+    for(uint32_t i = 0; i < len - 1; ++i, tail = pq_term_deref(pq_term_get_ptr(tail)[1])) cells[i] = pq_term_get_ptr(tail)[0];
+    return pq_builtins_unify(machine, term, compound);
+}
+
+/**
+ * @brief Copies a term onto the heap with new variables.
+ * The variable cells of the term are marked with their copies while it is walked, they are restored before returning.
+ *
+ * @param machine The machine that will be modified, upon failure the error is stored here.
+ * @param term The term.
+ * @return The copy, PQ_TERM_NONE upon failure.
+ */
+static pq_term pq_builtins_copy(pq_machine* machine, const pq_term term)
+{
+    //the work stack holds pairs of a source term and the address of the cell that receives its copy.
+    pq_term copy = PQ_TERM_NONE;
+    size_t sz = 0;
+    size_t marked_sz = 0;
+    PQbool ok = PQ_TRUE;
+    if(pq_array_reserve((void**)&machine->pdl, &machine->pdl_cap, 2, sizeof(pq_term)) != PQ_SUCCESS) ok = PQ_FALSE;
+    else
+    {
+        machine->pdl[sz++] = term;
+        machine->pdl[sz++] = (pq_term)(uintptr_t)&copy;
+    }
+
+    while(sz && ok)
+    {
+        pq_term* dest = (pq_term*)(uintptr_t)machine->pdl[--sz];
+        const pq_term src = pq_term_deref(machine->pdl[--sz]);
+        switch(pq_term_get_tag(src))
+        {
+        case PQ_TAG_REF:
+        {
+            pq_term* cell = pq_machine_alloc(machine, 1);
+            if(!cell || pq_array_reserve((void**)&machine->marked, &machine->marked_cap, marked_sz + 1, sizeof(pq_term*)) != PQ_SUCCESS)
+            {
+                ok = PQ_FALSE;
+                break;
+            }
+            *cell = pq_make_ptr_term(cell, PQ_TAG_REF);
+            *dest = *cell;
+            //the cell of the variable refers to its copy until it is restored.
+            machine->marked[marked_sz++] = pq_term_get_ptr(src);
+            *pq_term_get_ptr(src) = pq_make_ptr_term(cell, PQ_TAG_FUNCTOR);
+            break;
+        }
+        case PQ_TAG_FUNCTOR: //a variable that was copied.
+            *dest = pq_make_ptr_term(pq_term_get_ptr(src), PQ_TAG_REF);
+            break;
+        case PQ_TAG_LIST:
+        case PQ_TAG_STR:
+        {
+            const PQbool is_list = pq_term_get_tag(src) == PQ_TAG_LIST;
+            const uint32_t arity = pq_term_get_arity(src);
+            pq_term* cells = pq_machine_alloc(machine, arity + !is_list);
+            if(!cells || pq_array_reserve((void**)&machine->pdl, &machine->pdl_cap, sz + 2 * (size_t)arity, sizeof(pq_term)) != PQ_SUCCESS)
+            {
+                ok = PQ_FALSE;
+                break;
+            }
+            *dest = pq_make_ptr_term(cells, pq_term_get_tag(src));
+            if(!is_list) *cells++ = *pq_term_get_ptr(src);
+            const pq_term* src_args = pq_term_get_args(src);
+            for(uint32_t i = arity; i-- > 0;)
+            {
+                machine->pdl[sz++] = src_args[i];
+                machine->pdl[sz++] = (pq_term)(uintptr_t)&cells[i];
+            }
+            break;
+        }
+        default: //constants are shared, the boxed constants are never modified.
+            *dest = src;
+            break;
+        }
+    }
+
+    for(size_t i = 0; i < marked_sz; ++i) *machine->marked[i] = pq_make_ptr_term(machine->marked[i], PQ_TAG_REF);
+    if(!ok)
+    {
+        if(!machine->err) machine->err = "resource error: not enough memory for the term.";
+        return PQ_TERM_NONE;
+    }
+    return copy;
+}
+
+static pq_builtin_result pq_builtin_copy_term(pq_machine* machine, pq_term* args)
+{
+    const pq_term copy = pq_builtins_copy(machine, args[0]);
+    if(copy == PQ_TERM_NONE) return PQ_BUILTIN_FAIL;
+    return pq_builtins_unify(machine, args[1], copy);
+}
+
+/* arithmetic */
+
+/**
+ * @brief Sets a type error for a number that is not an integer.
+ *
+ * @param machine The machine that will be modified.
+ * @return PQ_FAILURE.
+ */
+static int pq_builtins_integer_error(pq_machine* machine)
+{
+    machine->err = "type error: the arithmetic function expects integers.";
+    return PQ_FAILURE;
+}
+
+static int pq_builtins_zero_divisor_error(pq_machine* machine)
+{
+    machine->err = "evaluation error: division by zero.";
+    return PQ_FAILURE;
+}
+
+/**
+ * @brief A view of an integer as a sign and a magnitude, the magnitude of a PQint is stored in the view.
+ */
+typedef struct pq_builtins_int_view
+{
+    PQbool neg;
+    const pq_limb* limbs;
+    size_t sz;
+    pq_limb small;
+} pq_builtins_int_view;
+
+static inline void pq_builtins_view_int(const pq_number* number, pq_builtins_int_view* view)
+{
+    if(number->kind == PQ_NUMBER_BIG)
+    {
+        view->neg = pq_bigint_is_negative(number->val.big);
+        view->limbs = pq_bigint_get_limbs(number->val.big);
+        view->sz = pq_bigint_get_size(number->val.big);
+        return;
+    }
+    view->neg = number->val.i < 0;
+    view->small = view->neg ? 0 - (pq_limb)number->val.i : (pq_limb)number->val.i;
+    view->limbs = &view->small;
+    view->sz = view->small != 0;
+}
+
+static inline PQflt pq_builtins_to_float(const pq_number* number)
+{
+    switch(number->kind)
+    {
+    case PQ_NUMBER_INT: return (PQflt)number->val.i;
+    case PQ_NUMBER_FLOAT: return number->val.f;
+    default: return pq_bigint_term_to_float(pq_make_ptr_term(number->val.big, PQ_TAG_BOX));
+    }
+}
+
+/**
+ * @brief Compares two numbers by their value, an integer is converted into a float if the other number is a float.
+ *
+ * @param x The first number.
+ * @param y The second number.
+ * @return -1, 0, or 1.
+ */
+static int pq_builtins_compare_numbers(const pq_number* x, const pq_number* y)
+{
+    if(x->kind == PQ_NUMBER_INT && y->kind == PQ_NUMBER_INT) return x->val.i < y->val.i ? -1 : x->val.i > y->val.i;
+    if(x->kind == PQ_NUMBER_FLOAT || y->kind == PQ_NUMBER_FLOAT)
+    {
+        const PQflt a = pq_builtins_to_float(x);
+        const PQflt b = pq_builtins_to_float(y);
+        return a < b ? -1 : a > b;
+    }
+
+    pq_builtins_int_view a;
+    pq_builtins_int_view b;
+    pq_builtins_view_int(x, &a);
+    pq_builtins_view_int(y, &b);
+    if(a.neg != b.neg) return a.neg ? -1 : 1;
+    const int diff = pq_bigint_compare(a.limbs, a.sz, b.limbs, b.sz);
+    return a.neg ? -diff : diff;
+}
+
+/**
+ * @brief Reserves the room of an integer result on top of the heap, the heap grows when the result is stored.
+ *
+ * @param machine The machine that will be modified, upon failure the error is stored here.
+ * @param limbs The number of limbs of the room.
+ * @return The room, after the cells of the box, NULL if the heap is full.
+ */
+static pq_limb* pq_builtins_reserve_limbs(pq_machine* machine, const size_t limbs)
+{
+    if((size_t)(machine->heap_end - machine->h) < limbs + 2)
+    {
+        machine->err = "resource error: the heap is full.";
+        return NULL;
+    }
+    return machine->h + 2;
+}
+
+/**
+ * @brief Stores an integer result, a signed magnitude in the room on top of the heap, it is boxed only if it does not fit in a PQint.
+ *
+ * @param machine The machine that will be modified.
+ * @param result The number that receives the result.
+ * @param neg Whether the result is negative.
+ * @param limbs The magnitude, it is in the room that was reserved.
+ * @param n The number of limbs of the magnitude.
+ */
+static void pq_builtins_store_int(pq_machine* machine, pq_number* result, const PQbool neg, const pq_limb* limbs, size_t n)
+{
+    n = pq_bigint_normalize(limbs, n);
+    PQint val;
+    if(pq_bigint_fits_int(limbs, n, neg, &val))
+    {
+        result->kind = PQ_NUMBER_INT;
+        result->val.i = val;
+        return;
+    }
+
+    pq_term* box = machine->h;
+    memmove(box + 2, limbs, n * sizeof(pq_limb));
+    box[0] = pq_make_box_cell(PQ_BOX_BIGINT, (uint32_t)n + 1);
+    box[1] = neg;
+    machine->h = box + 2 + n;
+    result->kind = PQ_NUMBER_BIG;
+    result->val.big = box;
+}
+
+/**
+ * @brief Adds or subtracts two integers, the result replaces the first integer.
+ * The PQint are added with an overflow check, they are promoted to bignums if the sum overflows.
+ *
+ * @param machine The machine that will be modified, upon failure the error is stored here.
+ * @param x The first integer, and the result.
+ * @param y The second integer.
+ * @param negate Whether y is subtracted.
+ * @return PQ_SUCCESS if the integers were added else PQ_FAILURE.
+ */
+static int pq_builtins_int_add(pq_machine* machine, pq_number* x, const pq_number* y, const PQbool negate)
+{
+    if(x->kind == PQ_NUMBER_INT && y->kind == PQ_NUMBER_INT)
+    {
+        PQint sum;
+        const PQbool overflow = negate ? pq_int_sub_overflow(x->val.i, y->val.i, &sum) : pq_int_add_overflow(x->val.i, y->val.i, &sum);
+        if(!overflow)
+        {
+            x->val.i = sum;
+            return PQ_SUCCESS;
+        }
+    }
+
+    pq_builtins_int_view a;
+    pq_builtins_int_view b;
+    pq_builtins_view_int(x, &a);
+    pq_builtins_view_int(y, &b);
+    b.neg ^= negate;
+    pq_limb* r = pq_builtins_reserve_limbs(machine, (a.sz > b.sz ? a.sz : b.sz) + 1);
+    if(!r) return PQ_FAILURE;
+
+    if(a.neg == b.neg) pq_builtins_store_int(machine, x, a.neg, r, pq_bigint_add(r, a.limbs, a.sz, b.limbs, b.sz));
+    else if(pq_bigint_compare(a.limbs, a.sz, b.limbs, b.sz) >= 0)
+        pq_builtins_store_int(machine, x, a.neg, r, pq_bigint_sub(r, a.limbs, a.sz, b.limbs, b.sz));
+    else pq_builtins_store_int(machine, x, b.neg, r, pq_bigint_sub(r, b.limbs, b.sz, a.limbs, a.sz));
+    return PQ_SUCCESS;
+}
+
+static int pq_builtins_int_mul(pq_machine* machine, pq_number* x, const pq_number* y)
+{
+    if(x->kind == PQ_NUMBER_INT && y->kind == PQ_NUMBER_INT)
+    {
+        PQint product;
+        if(!pq_int_mul_overflow(x->val.i, y->val.i, &product))
+        {
+            x->val.i = product;
+            return PQ_SUCCESS;
+        }
+    }
+
+    pq_builtins_int_view a;
+    pq_builtins_int_view b;
+    pq_builtins_view_int(x, &a);
+    pq_builtins_view_int(y, &b);
+    pq_limb* r = pq_builtins_reserve_limbs(machine, a.sz + b.sz);
+    if(!r) return PQ_FAILURE;
+    pq_builtins_store_int(machine, x, a.neg != b.neg, r, pq_bigint_mul(r, a.limbs, a.sz, b.limbs, b.sz));
+    return PQ_SUCCESS;
+}
+
+static int pq_builtins_int_negate(pq_machine* machine, pq_number* x)
+{
+    if(x->kind == PQ_NUMBER_INT && x->val.i != INT64_MIN)
+    {
+        x->val.i = -x->val.i;
+        return PQ_SUCCESS;
+    }
+
+    pq_builtins_int_view a;
+    pq_builtins_view_int(x, &a);
+    pq_limb* r = pq_builtins_reserve_limbs(machine, a.sz);
+    if(!r) return PQ_FAILURE;
+    memcpy(r, a.limbs, a.sz * sizeof(pq_limb));
+    pq_builtins_store_int(machine, x, !a.neg, r, a.sz);
+    return PQ_SUCCESS;
+}
+
+/**
+ * @brief Divides two integers, the result replaces the first integer.
+ *
+ * @param machine The machine that will be modified, upon failure the error is stored here.
+ * @param name The function, //, div, mod, or rem.
+ * @param x The dividend, and the result.
+ * @param y The divisor.
+ * @return PQ_SUCCESS if the integers were divided else PQ_FAILURE.
+ */
+static int pq_builtins_int_divide(pq_machine* machine, const pq_atom name, pq_number* x, const pq_number* y)
+{
+    if(x->kind == PQ_NUMBER_INT && y->kind == PQ_NUMBER_INT && !(x->val.i == INT64_MIN && y->val.i == -1))
+    {
+        if(!y->val.i) return pq_builtins_zero_divisor_error(machine);
+        const PQint q = x->val.i / y->val.i;
+        const PQint r = x->val.i % y->val.i;
+        const PQbool floor_adjust = r && ((r < 0) != (y->val.i < 0));
+        if(name == PQ_ATOM_INT_DIVIDE) x->val.i = q;
+        else if(name == PQ_ATOM_DIV) x->val.i = q - floor_adjust;
+        else if(name == PQ_ATOM_REM) x->val.i = r;
+        else x->val.i = floor_adjust ? r + y->val.i : r;
+        return PQ_SUCCESS;
+    }
+
+    pq_builtins_int_view a;
+    pq_builtins_int_view b;
+    pq_builtins_view_int(x, &a);
+    pq_builtins_view_int(y, &b);
+    if(!b.sz) return pq_builtins_zero_divisor_error(machine);
+
+    //the quotient has a limb of room for the floored quotient, the remainder and the scratch memory are after it.
+    const size_t q_room = a.sz >= b.sz ? a.sz - b.sz + 2 : 1;
+    pq_limb* q = pq_builtins_reserve_limbs(machine, q_room + b.sz + a.sz + b.sz + 2);
+    if(!q) return PQ_FAILURE;
+    pq_limb* r = q + q_room;
+    size_t qn = 0;
+    size_t rn = a.sz;
+    if(a.sz < b.sz) memcpy(r, a.limbs, a.sz * sizeof(pq_limb));
+    else pq_bigint_divmod(q, &qn, r, &rn, a.limbs, a.sz, b.limbs, b.sz, r + b.sz);
+
+    //the quotient is truncated, the floored quotient is 1 further from 0 and the modulo has the sign of the divisor.
+    const PQbool floor_adjust = rn && a.neg != b.neg;
+    const pq_limb one = 1;
+    switch(name)
+    {
+    case PQ_ATOM_INT_DIVIDE:
+        pq_builtins_store_int(machine, x, a.neg != b.neg, q, qn);
+        break;
+    case PQ_ATOM_DIV:
+        if(floor_adjust) qn = pq_bigint_add(q, q, qn, &one, 1);
+        pq_builtins_store_int(machine, x, a.neg != b.neg, q, qn);
+        break;
+    case PQ_ATOM_REM:
+        pq_builtins_store_int(machine, x, a.neg, r, rn);
+        break;
+    default:
+        if(floor_adjust) rn = pq_bigint_sub(r, b.limbs, b.sz, r, rn);
+        pq_builtins_store_int(machine, x, b.neg, r, rn);
+        break;
+    }
+    return PQ_SUCCESS;
+}
+
+/**
+ * @brief Raises an integer to an integer power, the result replaces the base.
+ *
+ * @param machine The machine that will be modified, upon failure the error is stored here.
+ * @param name The function, ** or ^.
+ * @param x The base, and the result.
+ * @param y The exponent.
+ * @return PQ_SUCCESS if the power was computed else PQ_FAILURE.
+ */
+static int pq_builtins_int_power(pq_machine* machine, const pq_atom name, pq_number* x, const pq_number* y)
+{
+    pq_builtins_int_view e;
+    pq_builtins_view_int(y, &e);
+    const PQbool unit = x->kind == PQ_NUMBER_INT && (x->val.i == 1 || x->val.i == -1 || (!x->val.i && !e.neg));
+    if(unit)
+    {   //1, -1, and 0 to a non-negative power, the exponent can be a bignum.
+        if(!e.sz) x->val.i = 1;
+        else if(x->val.i == -1 && !(e.limbs[0] & 1)) x->val.i = 1;
+        return PQ_SUCCESS;
+    }
+    if(e.neg)
+    {
+        if(name == PQ_ATOM_CARET)
+        {
+            machine->err = "type error: the exponent of ^/2 must not be negative.";
+            return PQ_FAILURE;
+        }
+        x->val.f = pow(pq_builtins_to_float(x), pq_builtins_to_float(y));
+        x->kind = PQ_NUMBER_FLOAT;
+        return PQ_SUCCESS;
+    }
+    if(e.sz > 1)
+    {
+        machine->err = "resource error: the integer is too large.";
+        return PQ_FAILURE;
+    }
+
+    //by squaring, the intermediate bignums are dropped from the heap after the expression is evaluated.
+    pq_number result = { PQ_NUMBER_INT, { 1 } };
+    pq_number base = *x;
+    for(pq_limb bits = e.sz ? e.limbs[0] : 0; bits; bits >>= 1)
+    {
+        if((bits & 1) && pq_builtins_int_mul(machine, &result, &base) != PQ_SUCCESS) return PQ_FAILURE;
+        if(bits > 1 && pq_builtins_int_mul(machine, &base, &base) != PQ_SUCCESS) return PQ_FAILURE;
+    }
+    *x = result;
+    return PQ_SUCCESS;
+}
+
+/**
+ * @brief Shifts an integer, a right shift rounds toward negative infinity, the result replaces the integer.
+ *
+ * @param machine The machine that will be modified, upon failure the error is stored here.
+ * @param x The integer, and the result.
+ * @param y The number of bits, a negative number shifts the other way.
+ * @param left Whether the integer is shifted to the left.
+ * @return PQ_SUCCESS if the integer was shifted else PQ_FAILURE.
+ */
+static int pq_builtins_int_shift(pq_machine* machine, pq_number* x, const pq_number* y, PQbool left)
+{
+    pq_builtins_int_view a;
+    pq_builtins_int_view b;
+    pq_builtins_view_int(x, &a);
+    pq_builtins_view_int(y, &b);
+    if(b.neg) left = !left;
+    if(!a.sz) return PQ_SUCCESS;
+    if(b.sz > 1 || b.limbs[0] > ((size_t)1 << 62))
+    {   //the bits of every integer are shifted out, or the integer does not fit in memory.
+        if(left)
+        {
+            machine->err = "resource error: the integer is too large.";
+            return PQ_FAILURE;
+        }
+        x->kind = PQ_NUMBER_INT;
+        x->val.i = a.neg ? -1 : 0;
+        return PQ_SUCCESS;
+    }
+
+    const size_t bits = b.sz ? (size_t)b.limbs[0] : 0;
+    if(x->kind == PQ_NUMBER_INT)
+    {
+        if(!left)
+        {
+            x->val.i = bits >= 64 ? (a.neg ? -1 : 0) : x->val.i >> bits;
+            return PQ_SUCCESS;
+        }
+        if(bits < 63 && x->val.i >= (INT64_MIN >> bits) && x->val.i <= (INT64_MAX >> bits))
+        {
+            x->val.i = (PQint)((uint64_t)x->val.i << bits);
+            return PQ_SUCCESS;
+        }
+    }
+
+    pq_limb* r = pq_builtins_reserve_limbs(machine, a.sz + bits / 64 + 2);
+    if(!r) return PQ_FAILURE;
+    if(left)
+    {
+        pq_builtins_store_int(machine, x, a.neg, r, pq_bigint_shift_left(r, a.limbs, a.sz, bits));
+        return PQ_SUCCESS;
+    }
+    if(!a.neg)
+    {
+        pq_builtins_store_int(machine, x, PQ_FALSE, r, pq_bigint_shift_right(r, a.limbs, a.sz, bits));
+        return PQ_SUCCESS;
+    }
+
+    //-a >> bits is -(((a - 1) >> bits) + 1).
+    const pq_limb one = 1;
+    size_t n = pq_bigint_sub(r, a.limbs, a.sz, &one, 1);
+    n = pq_bigint_shift_right(r, r, n, bits);
+    pq_builtins_store_int(machine, x, PQ_TRUE, r, pq_bigint_add(r, r, n, &one, 1));
+    return PQ_SUCCESS;
+}
+
+/**
+ * @brief Writes the two's complement of an integer.
+ *
+ * @param r The two's complement, it has n limbs.
+ * @param view The integer.
+ * @param n The number of limbs, the magnitude has less limbs.
+ */
+static void pq_builtins_twos_complement(pq_limb* r, const pq_builtins_int_view* view, const size_t n)
+{
+    memcpy(r, view->limbs, view->sz * sizeof(pq_limb));
+    memset(r + view->sz, 0, (n - view->sz) * sizeof(pq_limb));
+    if(!view->neg) return;
+
+    //-a is ~(a - 1).
+    for(size_t i = 0; i < n && !r[i]--; ++i);
+    for(size_t i = 0; i < n; ++i) r[i] = ~r[i];
+}
+
+static int pq_builtins_int_bitwise(pq_machine* machine, const pq_atom name, pq_number* x, const pq_number* y)
+{
+    if(x->kind == PQ_NUMBER_INT && y->kind == PQ_NUMBER_INT)
+    {
+        if(name == PQ_ATOM_BIT_AND) x->val.i &= y->val.i;
+        else if(name == PQ_ATOM_BIT_OR) x->val.i |= y->val.i;
+        else x->val.i ^= y->val.i;
+        return PQ_SUCCESS;
+    }
+
+    pq_builtins_int_view a;
+    pq_builtins_int_view b;
+    pq_builtins_view_int(x, &a);
+    pq_builtins_view_int(y, &b);
+    const size_t n = (a.sz > b.sz ? a.sz : b.sz) + 1;
+    pq_limb* r = pq_builtins_reserve_limbs(machine, 2 * n + 1);
+    if(!r) return PQ_FAILURE;
+    pq_builtins_twos_complement(r, &a, n);
+    pq_builtins_twos_complement(r + n, &b, n);
+    for(size_t i = 0; i < n; ++i)
+    {
+        if(name == PQ_ATOM_BIT_AND) r[i] &= r[n + i];
+        else if(name == PQ_ATOM_BIT_OR) r[i] |= r[n + i];
+        else r[i] ^= r[n + i];
+    }
+
+    const PQbool neg = (PQbool)(r[n - 1] >> 63);
+    size_t rn = n;
+    if(neg)
+    {   //the magnitude of a negative result is ~r + 1.
+        const pq_limb one = 1;
+        for(size_t i = 0; i < n; ++i) r[i] = ~r[i];
+        rn = pq_bigint_add(r, r, pq_bigint_normalize(r, n), &one, 1);
+    }
+    pq_builtins_store_int(machine, x, neg, r, rn);
+    return PQ_SUCCESS;
+}
+
+/**
+ * @brief Converts a float into an integer for the rounding functions.
+ *
+ * @param machine The machine that will be modified, upon failure the error is stored here.
+ * @param val The rounded float.
+ * @param result The integer.
+ * @return PQ_SUCCESS if the float is finite else PQ_FAILURE.
+ */
+static int pq_builtins_float_to_int(pq_machine* machine, const PQflt val, pq_number* result)
+{
+    if(val >= -9223372036854775808.0 && val < 9223372036854775808.0)
+    {
+        result->kind = PQ_NUMBER_INT;
+        result->val.i = (PQint)val;
+        return PQ_SUCCESS;
+    }
+    if(!isfinite(val))
+    {
+        machine->err = "evaluation error: the float is not finite.";
+        return PQ_FAILURE;
+    }
+
+    pq_limb* r = pq_builtins_reserve_limbs(machine, PQ_BIGINT_FLOAT_LIMBS);
+    if(!r) return PQ_FAILURE;
+    pq_builtins_store_int(machine, result, val < 0, r, pq_bigint_from_float(r, val));
+    return PQ_SUCCESS;
+}
+
+/**
+ * @brief Applies an arithmetic function, the result replaces the first argument.
+ * An integer result that overflows a PQint is a bignum on top of the heap.
+ *
+ * @param machine The machine that will be modified, upon failure the error is stored here.
+ * @param functor The functor cell of the function.
+ * @param x The first argument, and the result.
+ * @param y The second argument of a binary function.
+ * @return PQ_SUCCESS if the function was applied else PQ_FAILURE.
+ */
+static int pq_builtins_apply(pq_machine* machine, const pq_term functor, pq_number* x, const pq_number* y)
+{
+    const pq_atom name = pq_term_get_atom(functor);
+    const uint32_t arity = (uint32_t)(functor & 0xFFFFFFFFu) >> PQ_TERM_TAG_BITS;
+    const PQbool ints = x->kind != PQ_NUMBER_FLOAT && (arity == 1 || y->kind != PQ_NUMBER_FLOAT);
+    const PQbool finite = (x->kind != PQ_NUMBER_FLOAT || isfinite(x->val.f)) && (arity == 1 || y->kind != PQ_NUMBER_FLOAT || isfinite(y->val.f));
+
+    //the cases that break have a float result.
+    if(arity == 2) switch(name)
+    {
+    case PQ_ATOM_PLUS:
+        if(ints) return pq_builtins_int_add(machine, x, y, PQ_FALSE);
+        x->val.f = pq_builtins_to_float(x) + pq_builtins_to_float(y);
+        break;
+    case PQ_ATOM_MINUS:
+        if(ints) return pq_builtins_int_add(machine, x, y, PQ_TRUE);
+        x->val.f = pq_builtins_to_float(x) - pq_builtins_to_float(y);
+        break;
+    case PQ_ATOM_TIMES:
+        if(ints) return pq_builtins_int_mul(machine, x, y);
+        x->val.f = pq_builtins_to_float(x) * pq_builtins_to_float(y);
+        break;
+    case PQ_ATOM_DIVIDE:
+        if(ints)
+        {   //an exact quotient of integers is an integer.
+            pq_number r = *x;
+            if(pq_builtins_int_divide(machine, PQ_ATOM_REM, &r, y) != PQ_SUCCESS) return PQ_FAILURE;
+            if(r.kind == PQ_NUMBER_INT && !r.val.i) return pq_builtins_int_divide(machine, PQ_ATOM_INT_DIVIDE, x, y);
+        }
+        if(pq_builtins_to_float(y) == 0) return pq_builtins_zero_divisor_error(machine);
+        x->val.f = pq_builtins_to_float(x) / pq_builtins_to_float(y);
+        break;
+    case PQ_ATOM_INT_DIVIDE:
+    case PQ_ATOM_DIV:
+    case PQ_ATOM_MOD:
+    case PQ_ATOM_REM:
+        if(!ints) return pq_builtins_integer_error(machine);
+        return pq_builtins_int_divide(machine, name, x, y);
+    case PQ_ATOM_MIN:
+    case PQ_ATOM_MAX:
+        if((pq_builtins_compare_numbers(x, y) < 0) != (name == PQ_ATOM_MIN)) *x = *y;
+        return PQ_SUCCESS;
+    case PQ_ATOM_POWER:
+    case PQ_ATOM_CARET:
+        if(ints) return pq_builtins_int_power(machine, name, x, y);
+        x->val.f = pow(pq_builtins_to_float(x), pq_builtins_to_float(y));
+        break;
+    case PQ_ATOM_SHIFT_LEFT:
+    case PQ_ATOM_SHIFT_RIGHT:
+        if(!ints) return pq_builtins_integer_error(machine);
+        return pq_builtins_int_shift(machine, x, y, name == PQ_ATOM_SHIFT_LEFT);
+    case PQ_ATOM_BIT_AND:
+    case PQ_ATOM_BIT_OR:
+    case PQ_ATOM_XOR:
+        if(!ints) return pq_builtins_integer_error(machine);
+        return pq_builtins_int_bitwise(machine, name, x, y);
+    case PQ_ATOM_ATAN:
+        x->val.f = atan2(pq_builtins_to_float(x), pq_builtins_to_float(y));
+        break;
+    default:
+        goto unknown;
+    }
+    else switch(name)
+    {
+    case PQ_ATOM_MINUS:
+        if(ints) return pq_builtins_int_negate(machine, x);
+        x->val.f = -x->val.f;
+        break;
+    case PQ_ATOM_PLUS:
+        return PQ_SUCCESS;
+    case PQ_ATOM_ABS:
+        if(ints)
+        {
+            const PQbool neg = x->kind == PQ_NUMBER_BIG ? pq_bigint_is_negative(x->val.big) : x->val.i < 0;
+            return neg ? pq_builtins_int_negate(machine, x) : PQ_SUCCESS;
+        }
+        x->val.f = fabs(x->val.f);
+        break;
+    case PQ_ATOM_SIGN:
+        if(ints)
+        {
+            x->val.i = x->kind == PQ_NUMBER_BIG ? (pq_bigint_is_negative(x->val.big) ? -1 : 1) : (x->val.i > 0) - (x->val.i < 0);
+            x->kind = PQ_NUMBER_INT;
+            return PQ_SUCCESS;
+        }
+        x->val.f = (x->val.f > 0) - (x->val.f < 0);
+        break;
+    case PQ_ATOM_BIT_NOT:
+    {   //\x is -x - 1.
+        if(!ints) return pq_builtins_integer_error(machine);
+        if(x->kind == PQ_NUMBER_INT)
+        {
+            x->val.i = ~x->val.i;
+            return PQ_SUCCESS;
+        }
+        const pq_number one = { PQ_NUMBER_INT, { 1 } };
+        if(pq_builtins_int_negate(machine, x) != PQ_SUCCESS) return PQ_FAILURE;
+        return pq_builtins_int_add(machine, x, &one, PQ_TRUE);
+    }
+    case PQ_ATOM_FLOAT:
+        x->val.f = pq_builtins_to_float(x);
+        break;
+    case PQ_ATOM_INTEGER:
+        return ints ? PQ_SUCCESS : pq_builtins_float_to_int(machine, round(x->val.f), x);
+    case PQ_ATOM_TRUNCATE:
+        return ints ? PQ_SUCCESS : pq_builtins_float_to_int(machine, trunc(x->val.f), x);
+    case PQ_ATOM_ROUND:
+        return ints ? PQ_SUCCESS : pq_builtins_float_to_int(machine, round(x->val.f), x);
+    case PQ_ATOM_CEILING:
+        return ints ? PQ_SUCCESS : pq_builtins_float_to_int(machine, ceil(x->val.f), x);
+    case PQ_ATOM_FLOOR:
+        return ints ? PQ_SUCCESS : pq_builtins_float_to_int(machine, floor(x->val.f), x);
+    case PQ_ATOM_FLOAT_INTEGER_PART:
+    case PQ_ATOM_FLOAT_FRACTIONAL_PART:
+    {
+        const PQflt f = pq_builtins_to_float(x);
+        x->val.f = name == PQ_ATOM_FLOAT_INTEGER_PART ? trunc(f) : f - trunc(f);
+        break;
+    }
+    case PQ_ATOM_SQRT:
+    case PQ_ATOM_SIN:
+    case PQ_ATOM_COS:
+    case PQ_ATOM_TAN:
+    case PQ_ATOM_ATAN:
+    case PQ_ATOM_EXP:
+    case PQ_ATOM_LOG:
+    {
+        const PQflt f = pq_builtins_to_float(x);
+        if((name == PQ_ATOM_LOG && f <= 0) || (name == PQ_ATOM_SQRT && f < 0))
+        {
+            machine->err = "evaluation error: the function is undefined for the argument.";
+            return PQ_FAILURE;
+        }
+        switch(name)
+        {
+        case PQ_ATOM_SQRT: x->val.f = sqrt(f); break;
+        case PQ_ATOM_SIN: x->val.f = sin(f); break;
+        case PQ_ATOM_COS: x->val.f = cos(f); break;
+        case PQ_ATOM_TAN: x->val.f = tan(f); break;
+        case PQ_ATOM_ATAN: x->val.f = atan(f); break;
+        case PQ_ATOM_EXP: x->val.f = exp(f); break;
+        default: x->val.f = log(f); break;
+        }
+        break;
+    }
+    default:
+        goto unknown;
+    }
+    x->kind = PQ_NUMBER_FLOAT;
+
+    //the infinities and not-a-number are only results of the arguments that are already not finite.
+    if(finite && isnan(x->val.f))
+    {
+        machine->err = "evaluation error: the result is undefined.";
+        return PQ_FAILURE;
+    }
+    if(finite && isinf(x->val.f))
+    {
+        machine->err = "evaluation error: float overflow.";
+        return PQ_FAILURE;
+    }
+    return PQ_SUCCESS;
+
+unknown:
+    pq_machine_set_pred_error(machine, "type error: %s/%u is not an arithmetic function.", name, arity);
+    return PQ_FAILURE;
+}
+
+/**
+ * @brief Evaluates an arithmetic expression without recursion.
+ * The work stack holds the subexpressions and the functor cells of the functions whose arguments are being evaluated,
+ * a functor cell is never the value of an argument so it marks where the function is applied.
+ * The bignums that are computed on the way are dropped from the heap, the bignum result is moved to the old top of the heap.
+ *
+ * @param machine The machine that will be modified, upon failure the error is stored here.
+ * @param expr The expression.
+ * @param result The value of the expression.
+ * @return PQ_SUCCESS if the expression was evaluated else PQ_FAILURE.
+ */
+static int pq_builtins_eval(pq_machine* machine, const pq_term expr, pq_number* result)
+{
+    pq_term* const h = machine->h;
+    size_t sz = 0;
+    size_t numbers_sz = 0;
+    if(pq_array_reserve((void**)&machine->pdl, &machine->pdl_cap, 1, sizeof(pq_term)) != PQ_SUCCESS) goto no_memory;
+    machine->pdl[sz++] = expr;
+
+    while(sz)
+    {
+        const pq_term term = pq_term_deref(machine->pdl[--sz]);
+        const pq_term_tag tag = pq_term_get_tag(term);
+        if(tag == PQ_TAG_FUNCTOR)
+        {   //the arguments were evaluated.
+            const uint32_t arity = (uint32_t)(term & 0xFFFFFFFFu) >> PQ_TERM_TAG_BITS;
+            numbers_sz -= arity - 1;
+            if(pq_builtins_apply(machine, term, &machine->numbers[numbers_sz - 1], &machine->numbers[numbers_sz]) != PQ_SUCCESS)
+                goto error;
+            continue;
+        }
+
+        if(tag == PQ_TAG_STR || tag == PQ_TAG_LIST)
+        {
+            const uint32_t arity = pq_term_get_arity(term);
+            if(tag == PQ_TAG_LIST || arity > 2)
+            {
+                pq_machine_set_pred_error(machine, "type error: %s/%u is not an arithmetic function.", pq_term_get_name(term), arity);
+                goto error;
+            }
+            if(pq_array_reserve((void**)&machine->pdl, &machine->pdl_cap, sz + 1 + arity, sizeof(pq_term)) != PQ_SUCCESS)
+                goto no_memory;
+            machine->pdl[sz++] = *pq_term_get_ptr(term);
+            for(uint32_t i = arity; i-- > 0;) machine->pdl[sz++] = pq_term_get_arg(term, i);
+            continue;
+        }
+
+        if(pq_array_reserve((void**)&machine->numbers, &machine->numbers_cap, numbers_sz + 1, sizeof(pq_number)) != PQ_SUCCESS)
+            goto no_memory;
+        pq_number* number = &machine->numbers[numbers_sz++];
+        if(pq_term_is_bigint(term))
+        {
+            number->kind = PQ_NUMBER_BIG;
+            number->val.big = pq_term_get_ptr(term);
+        }
+        else if(pq_term_is_integer(term))
+        {
+            number->kind = PQ_NUMBER_INT;
+            number->val.i = pq_term_get_int(term);
+        }
+        else if(pq_term_is_float(term))
+        {
+            number->kind = PQ_NUMBER_FLOAT;
+            number->val.f = pq_term_get_float(term);
+        }
+        else if(pq_term_is_var(term))
+        {
+            machine->err = "instantiation error: the arithmetic expression is unbound.";
+            goto error;
+        }
+        else if(pq_term_get_atom(term) == PQ_ATOM_PI || pq_term_get_atom(term) == PQ_ATOM_E)
+        {
+            number->kind = PQ_NUMBER_FLOAT;
+            number->val.f = pq_term_get_atom(term) == PQ_ATOM_PI ? 3.14159265358979323846 : 2.71828182845904523536;
+        }
+        else
+        {
+            pq_machine_set_pred_error(machine, "type error: %s/%u is not an arithmetic function.", pq_term_get_atom(term), 0);
+            goto error;
+        }
+    }
+
+    *result = machine->numbers[0];
+    if(result->kind == PQ_NUMBER_BIG && result->val.big >= h && result->val.big < machine->h)
+    {
+        const size_t size = (size_t)(result->val.big[0] >> 32) + 1;
+        memmove(h, result->val.big, size * sizeof(pq_term));
+        result->val.big = h;
+        machine->h = h + size;
+    }
+    else machine->h = h;
+    return PQ_SUCCESS;
+
+no_memory:
+    machine->err = "resource error: not enough memory for the arithmetic expression.";
+error:
+    machine->h = h;
+    return PQ_FAILURE;
+}
+
+/**
+ * @brief Evaluates an expression of small integers without the work stacks, the common case of a counter or a bound.
+ *
+ * @param expr The expression.
+ * @param val Receives the value.
+ * @return PQ_TRUE if the expression is a small integer, or the sum, the difference, or the product of two small integers
+ * that does not overflow, else PQ_FALSE and the expression is evaluated by pq_builtins_eval function.
+ */
+static inline PQbool pq_builtins_eval_small(const pq_term expr, PQint* val)
+{
+    const pq_term term = pq_term_deref(expr);
+    if(pq_term_get_tag(term) == PQ_TAG_INT)
+    {
+        *val = pq_term_get_int(term);
+        return PQ_TRUE;
+    }
+    if(pq_term_get_tag(term) != PQ_TAG_STR) return PQ_FALSE;
+
+    const pq_term functor = *pq_term_get_ptr(term);
+    if(functor != pq_make_functor_cell(PQ_ATOM_PLUS, 2) && functor != pq_make_functor_cell(PQ_ATOM_MINUS, 2)
+        && functor != pq_make_functor_cell(PQ_ATOM_TIMES, 2))
+        return PQ_FALSE;
+    const pq_term x = pq_term_deref(pq_term_get_arg(term, 0));
+    const pq_term y = pq_term_deref(pq_term_get_arg(term, 1));
+    if(pq_term_get_tag(x) != PQ_TAG_INT || pq_term_get_tag(y) != PQ_TAG_INT) return PQ_FALSE;
+
+    //the sum of two small integers fits in a PQint.
+    if(functor == pq_make_functor_cell(PQ_ATOM_PLUS, 2)) *val = pq_term_get_int(x) + pq_term_get_int(y);
+    else if(functor == pq_make_functor_cell(PQ_ATOM_MINUS, 2)) *val = pq_term_get_int(x) - pq_term_get_int(y);
+    else return !pq_int_mul_overflow(pq_term_get_int(x), pq_term_get_int(y), val);
+    return PQ_TRUE;
+}
+
+/**
+ * @brief Compares the values of two arithmetic expressions.
+ *
+ * @param machine The machine that will be modified, upon failure the error is stored here.
+ * @param args The argument registers that hold the expressions.
+ * @param diff -1, 0, or 1.
+ * @return PQ_SUCCESS if the expressions were evaluated else PQ_FAILURE.
+ */
+static int pq_builtins_compare_exprs(pq_machine* machine, const pq_term* args, int* diff)
+{
+    PQint a;
+    PQint b;
+    if(pq_builtins_eval_small(args[0], &a) && pq_builtins_eval_small(args[1], &b))
+    {
+        *diff = a < b ? -1 : a > b;
+        return PQ_SUCCESS;
+    }
+
+    pq_term* const h = machine->h;
+    pq_number x;
+    pq_number y;
+    if(pq_builtins_eval(machine, args[0], &x) != PQ_SUCCESS || pq_builtins_eval(machine, args[1], &y) != PQ_SUCCESS)
+    {
+        machine->h = h;
+        return PQ_FAILURE;
+    }
+    *diff = pq_builtins_compare_numbers(&x, &y);
+    machine->h = h;
+    return PQ_SUCCESS;
+}
+
+static pq_builtin_result pq_builtin_is(pq_machine* machine, pq_term* args)
+{
+    PQint val;
+    pq_term term;
+    if(pq_builtins_eval_small(args[1], &val)) term = pq_machine_new_integer(machine, val);
+    else
+    {
+        pq_number result;
+        if(pq_builtins_eval(machine, args[1], &result) != PQ_SUCCESS) return PQ_BUILTIN_FAIL;
+        switch(result.kind)
+        {
+        case PQ_NUMBER_INT: term = pq_machine_new_integer(machine, result.val.i); break;
+        case PQ_NUMBER_FLOAT: term = pq_machine_new_float(machine, result.val.f); break;
+        default: term = pq_make_ptr_term(result.val.big, PQ_TAG_BOX); break;
+        }
+    }
+    if(term == PQ_TERM_NONE) return PQ_BUILTIN_FAIL;
+    return pq_builtins_unify(machine, args[0], term);
+}
+
+//the arithmetic comparisons.
+#define PQ_BUILTIN_ARITH_COMPARE(id, op) \
+    static pq_builtin_result pq_builtin_##id(pq_machine* machine, pq_term* args) \
+    { \
+        int diff; \
+        if(pq_builtins_compare_exprs(machine, args, &diff) != PQ_SUCCESS) return PQ_BUILTIN_FAIL; \
+        return diff op 0 ? PQ_BUILTIN_TRUE : PQ_BUILTIN_FAIL; \
+    }
+PQ_BUILTIN_ARITH_COMPARE(arith_eq, ==)
+PQ_BUILTIN_ARITH_COMPARE(arith_ne, !=)
+PQ_BUILTIN_ARITH_COMPARE(lt, <)
+PQ_BUILTIN_ARITH_COMPARE(le, <=)
+PQ_BUILTIN_ARITH_COMPARE(gt, >)
+PQ_BUILTIN_ARITH_COMPARE(ge, >=)
+#undef PQ_BUILTIN_ARITH_COMPARE
+
+/* output */
+
+/**
+ * @brief Writes a term with the output of the machine.
+ *
+ * @param machine The machine that will be used.
+ * @param term The term.
+ * @param flags The PQ_WRITE_* flags.
+ * @return PQ_BUILTIN_TRUE if the term was written else PQ_BUILTIN_FAIL.
+ */
+static pq_builtin_result pq_builtins_write(pq_machine* machine, const pq_term term, const int flags)
+{
+    pq_writer_clear(machine->writer);
+    if(pq_writer_write(machine->writer, term, flags) != PQ_SUCCESS)
+    {
+        machine->err = machine->writer->err;
+        return PQ_BUILTIN_FAIL;
+    }
+    pq_machine_print(machine, machine->writer->str);
+    return PQ_BUILTIN_TRUE;
+}
+
+static pq_builtin_result pq_builtin_write(pq_machine* machine, pq_term* args)
+{
+    return pq_builtins_write(machine, args[0], 0);
+}
+
+static pq_builtin_result pq_builtin_writeq(pq_machine* machine, pq_term* args)
+{
+    return pq_builtins_write(machine, args[0], PQ_WRITE_QUOTED);
+}
+
+static pq_builtin_result pq_builtin_write_canonical(pq_machine* machine, pq_term* args)
+{
+    return pq_builtins_write(machine, args[0], PQ_WRITE_QUOTED | PQ_WRITE_IGNORE_OPS);
+}
+
+static pq_builtin_result pq_builtin_nl(pq_machine* machine, pq_term* args)
+{
+    pq_machine_print(machine, "\n");
+    return PQ_BUILTIN_TRUE;
+}
+
+/* tabling */
+
+/**
+ * @brief Gets the table of an argument of a '$tbl_*' builtin.
+ *
+ * @param machine The machine that will be used, upon failure the error is stored here.
+ * @param arg The argument, the index of the table.
+ * @param table Receives the index of the table.
+ * @return true if the argument is a table else false.
+ */
+static PQbool pq_builtins_get_table(pq_machine* machine, const pq_term arg, uint32_t* table)
+{
+    const pq_term term = pq_term_deref(arg);
+    if(pq_term_get_tag(term) != PQ_TAG_INT || pq_term_get_int(term) < 0 || (size_t)pq_term_get_int(term) >= machine->tables->tables_sz)
+    {
+        machine->err = "domain error: expected the index of a table.";
+        return PQ_FALSE;
+    }
+    *table = (uint32_t)pq_term_get_int(term);
+    return PQ_TRUE;
+}
+
+/**
+ * @brief Creates the term of the tokens of an answer (see pq_table_get_answer).
+ *
+ * @param machine The machine that will be modified, upon failure the error is stored here.
+ * @return The term, PQ_TERM_NONE if the heap is full.
+ */
+static pq_term pq_builtins_answer_term(pq_machine* machine)
+{
+    //the work stack holds the addresses of the cells that receive the next terms, the variables are found by number in marked.
+    const pq_table_space* space = machine->tables;
+    pq_term term = PQ_TERM_NONE;
+    size_t sz = 0;
+    size_t vars_sz = 0;
+    if(pq_array_reserve((void**)&machine->pdl, &machine->pdl_cap, 1, sizeof(pq_term)) != PQ_SUCCESS)
+    {
+        machine->err = "resource error: not enough memory for the term.";
+        return PQ_TERM_NONE;
+    }
+    machine->pdl[sz++] = (pq_term)(uintptr_t)&term;
+
+    for(size_t k = 0; k < space->tokens_sz; ++k)
+    {
+        const pq_term token = space->tokens[k];
+        pq_term* dest = (pq_term*)(uintptr_t)machine->pdl[--sz];
+        pq_term* cells = NULL;
+        uint32_t arity = 0;
+        switch(pq_term_get_tag(token))
+        {
+        case PQ_TAG_LIST:
+            arity = 2;
+            cells = pq_machine_alloc(machine, 2);
+            if(cells) *dest = pq_make_ptr_term(cells, PQ_TAG_LIST);
+            break;
+        case PQ_TAG_FUNCTOR:
+            if(pq_table_is_var_token(token))
+            {   //the first occurrence creates the variable, the numbers are in order of appearance.
+                const uint32_t var = pq_table_get_var_number(token);
+                if(var == vars_sz)
+                {
+                    cells = pq_machine_alloc(machine, 1);
+                    if(!cells || pq_array_reserve((void**)&machine->marked, &machine->marked_cap, vars_sz + 1, sizeof(pq_term*)) != PQ_SUCCESS)
+                    {
+                        cells = NULL;
+                        break;
+                    }
+                    *cells = pq_make_ptr_term(cells, PQ_TAG_REF);
+                    machine->marked[vars_sz++] = cells;
+                }
+                cells = machine->marked[var];
+                *dest = pq_make_ptr_term(cells, PQ_TAG_REF);
+                break;
+            }
+            arity = (uint32_t)(token & 0xFFFFFFFFu) >> PQ_TERM_TAG_BITS;
+            cells = pq_machine_alloc(machine, arity + 1);
+            if(!cells) break;
+            *dest = pq_make_ptr_term(cells, PQ_TAG_STR);
+            *cells++ = token;
+            break;
+        case PQ_TAG_BOX_HEADER:
+        {   //the raw data cells follow the header.
+            const size_t n = (size_t)(token >> 32) + 1;
+            cells = pq_machine_alloc(machine, n);
+            if(!cells) break;
+            memcpy(cells, &space->tokens[k], n * sizeof(pq_term));
+            *dest = pq_make_ptr_term(cells, PQ_TAG_BOX);
+            k += n - 1;
+            break;
+        }
+        default: //an atom or a small integer.
+            *dest = token;
+            cells = dest;
+            break;
+        }
+        if(!cells || pq_array_reserve((void**)&machine->pdl, &machine->pdl_cap, sz + arity, sizeof(pq_term)) != PQ_SUCCESS)
+        {
+            if(!machine->err) machine->err = "resource error: not enough memory for the term.";
+            return PQ_TERM_NONE;
+        }
+        for(uint32_t i = arity; i-- > 0;) machine->pdl[sz++] = (pq_term)(uintptr_t)&cells[i];
+    }
+    return term;
+}
+
+/**
+ * @brief Declares tabled predicates, a spec is Name/Arity, a conjunction or a list of specs.
+ * The clauses of a tabled predicate move to a hidden predicate, and its only clause calls the table:
+ * p(X1, ..., XN) :- '$tbl'(p(X1, ..., XN), 'p tabled'(X1, ..., XN)).
+ */
+static pq_builtin_result pq_builtin_table(pq_machine* machine, pq_term* args)
+{
+    pq_term specs = pq_term_deref(args[0]);
+    while(!pq_term_is_atom(specs) || pq_term_get_atom(specs) != PQ_ATOM_NIL)
+    {
+        pq_term spec = specs;
+        specs = pq_new_atom_term(PQ_ATOM_NIL);
+        if(pq_term_get_tag(spec) == PQ_TAG_LIST || (pq_term_is_compound(spec) && pq_term_get_name(spec) == PQ_ATOM_COMMA && pq_term_get_arity(spec) == 2))
+        {
+            specs = pq_term_deref(pq_term_get_arg(spec, 1));
+            spec = pq_term_deref(pq_term_get_arg(spec, 0));
+        }
+
+        if(pq_term_is_var(spec))
+        {
+            machine->err = "instantiation error: table/1 expects Name/Arity.";
+            return PQ_BUILTIN_FAIL;
+        }
+        const pq_term name = pq_term_is_compound(spec) && pq_term_get_arity(spec) == 2 && pq_term_get_name(spec) == PQ_ATOM_DIVIDE
+            ? pq_term_deref(pq_term_get_arg(spec, 0)) : PQ_TERM_NONE;
+        const pq_term arity = name != PQ_TERM_NONE ? pq_term_deref(pq_term_get_arg(spec, 1)) : PQ_TERM_NONE;
+        if(name == PQ_TERM_NONE || !pq_term_is_atom(name) || pq_term_get_tag(arity) != PQ_TAG_INT
+            || pq_term_get_int(arity) < 0 || pq_term_get_int(arity) > PQ_WAM_REGISTERS)
+        {
+            machine->err = "type error: table/1 expects Name/Arity.";
+            return PQ_BUILTIN_FAIL;
+        }
+
+        const uint32_t n = (uint32_t)pq_term_get_int(arity);
+        pq_pred* pred = pq_database_get_pred(machine->db, pq_term_get_atom(name), n);
+        if(!pred)
+        {
+            machine->err = "resource error: not enough memory for the predicate.";
+            return PQ_BUILTIN_FAIL;
+        }
+        if(pred->builtin)
+        {
+            pq_machine_set_pred_error(machine, "permission error: %s/%u is a builtin predicate.", pred->name, n);
+            return PQ_BUILTIN_FAIL;
+        }
+        if(pred->tabled) continue;
+
+        //the hidden predicate is named after the predicate, e.g. 'path tabled'/2.
+        const char* cstr = pq_atom_get_cstr(pred->name);
+        const size_t len = strlen(cstr);
+        char* hidden_name = (char*)malloc(len + 8);
+        if(!hidden_name)
+        {
+            machine->err = "resource error: not enough memory for the predicate.";
+            return PQ_BUILTIN_FAIL;
+        }
+        memcpy(hidden_name, cstr, len);
+        memcpy(hidden_name + len, " tabled", 8);
+        const pq_atom hidden_atom = pq_atom_intern(pq_make_lexeme(hidden_name, len + 7));
+        free(hidden_name);
+        pq_pred* hidden = hidden_atom != PQ_ATOM_NONE ? pq_database_get_pred(machine->db, hidden_atom, n) : NULL;
+        if(!hidden || pq_database_move_clauses(machine->db, pred, hidden) != PQ_SUCCESS)
+        {
+            machine->err = "resource error: not enough memory for the predicate.";
+            return PQ_BUILTIN_FAIL;
+        }
+
+        //the clause that calls the table, the head and the implementation share their variables.
+        pq_term head = name;
+        pq_term impl = pq_new_atom_term(hidden_atom);
+        if(n)
+        {
+            head = pq_builtins_new_compound(machine, pred->name, n);
+            impl = head != PQ_TERM_NONE ? pq_builtins_new_compound(machine, hidden_atom, n) : PQ_TERM_NONE;
+            if(impl == PQ_TERM_NONE) return PQ_BUILTIN_FAIL;
+            memcpy(pq_term_get_args(impl), pq_term_get_args(head), n * sizeof(pq_term));
+        }
+        const pq_term call = pq_builtins_new_compound(machine, PQ_ATOM_TABLED_CALL, 2);
+        const pq_term clause = call != PQ_TERM_NONE ? pq_builtins_new_compound(machine, PQ_ATOM_NECK, 2) : PQ_TERM_NONE;
+        if(clause == PQ_TERM_NONE) return PQ_BUILTIN_FAIL;
+        pq_term_get_args(call)[0] = head;
+        pq_term_get_args(call)[1] = impl;
+        pq_term_get_args(clause)[0] = head;
+        pq_term_get_args(clause)[1] = call;
+        if(pq_compiler_add_clause(machine->compiler, clause) != PQ_SUCCESS)
+        {
+            machine->err = machine->compiler->err;
+            return PQ_BUILTIN_FAIL;
+        }
+        pred->tabled = hidden;
+        if(!machine->tables->stack_sz) pq_table_space_clear(machine->tables);
+    }
+    return PQ_BUILTIN_TRUE;
+}
+
+static pq_builtin_result pq_builtin_abolish_all_tables(pq_machine* machine, pq_term* args)
+{
+    (void)args;
+    if(machine->tables->stack_sz)
+    {
+        machine->err = "permission error: abolish_all_tables/0 cannot run while a table is evaluated.";
+        return PQ_BUILTIN_FAIL;
+    }
+    pq_table_space_clear(machine->tables);
+    return PQ_BUILTIN_TRUE;
+}
+
+//'$tbl_enter'(Goal, Impl, Table, Status) finds the table of the goal, the status is complete, consume, or evaluate (see pq_table_enter).
+static pq_builtin_result pq_builtin_tbl_enter(pq_machine* machine, pq_term* args)
+{
+    static const pq_atom statuses[] = { PQ_ATOM_COMPLETE, PQ_ATOM_CONSUME, PQ_ATOM_EVALUATE };
+    const pq_term impl = pq_term_deref(args[1]);
+    if(!pq_term_is_atom(impl) && !pq_term_is_compound(impl))
+    {
+        machine->err = "type error: '$tbl_enter'/4 expects a callable implementation.";
+        return PQ_BUILTIN_FAIL;
+    }
+
+    //a tabled predicate without clauses has no answers, it is declared so it is not unknown.
+    const pq_pred* pred = pq_database_lookup(machine->db, pq_term_get_name(impl), pq_term_get_arity(impl));
+    pq_table_status status = PQ_TABLE_RETURN;
+    const uint32_t table = pq_table_get(machine->tables, args[0]);
+    if(table == UINT32_MAX || (pred && pred->clauses_sz && pq_table_enter(machine->tables, table, &status) != PQ_SUCCESS))
+    {
+        machine->err = "resource error: not enough memory for the table.";
+        return PQ_BUILTIN_FAIL;
+    }
+    if(!pq_builtins_unify(machine, args[2], (pq_term)table << PQ_TERM_TAG_BITS | PQ_TAG_INT)) return PQ_BUILTIN_FAIL;
+    return pq_builtins_unify(machine, args[3], pq_new_atom_term(statuses[status]));
+}
+
+//'$tbl_iterate'(Table) starts an evaluation of the clauses.
+static pq_builtin_result pq_builtin_tbl_iterate(pq_machine* machine, pq_term* args)
+{
+    uint32_t table;
+    if(!pq_builtins_get_table(machine, args[0], &table)) return PQ_BUILTIN_FAIL;
+    pq_table_iterate(machine->tables, table);
+    return PQ_BUILTIN_TRUE;
+}
+
+//'$tbl_add'(Table, Answer) adds an answer unless the table has a variant of it.
+static pq_builtin_result pq_builtin_tbl_add(pq_machine* machine, pq_term* args)
+{
+    uint32_t table;
+    if(!pq_builtins_get_table(machine, args[0], &table)) return PQ_BUILTIN_FAIL;
+    if(pq_table_add_answer(machine->tables, table, args[1]) != PQ_SUCCESS)
+    {
+        machine->err = "resource error: not enough memory for the answer.";
+        return PQ_BUILTIN_FAIL;
+    }
+    return PQ_BUILTIN_TRUE;
+}
+
+//'$tbl_again'(Table) succeeds if the clauses are evaluated again, else the evaluation ends.
+static pq_builtin_result pq_builtin_tbl_again(pq_machine* machine, pq_term* args)
+{
+    uint32_t table;
+    if(!pq_builtins_get_table(machine, args[0], &table)) return PQ_BUILTIN_FAIL;
+    if(machine->tables->tables[table].state != PQ_TABLE_EVALUATING)
+    {
+        machine->err = "domain error: '$tbl_again'/1 expects a table that is evaluated.";
+        return PQ_BUILTIN_FAIL;
+    }
+    return pq_table_again(machine->tables, table) ? PQ_BUILTIN_TRUE : PQ_BUILTIN_FAIL;
+}
+
+//'$tbl_size'(Table, N) gets the number of answers, a consumer only returns the answers that were found before it.
+static pq_builtin_result pq_builtin_tbl_size(pq_machine* machine, pq_term* args)
+{
+    uint32_t table;
+    if(!pq_builtins_get_table(machine, args[0], &table)) return PQ_BUILTIN_FAIL;
+    const pq_term size = pq_machine_new_integer(machine, (PQint)machine->tables->tables[table].answers_sz);
+    if(size == PQ_TERM_NONE) return PQ_BUILTIN_FAIL;
+    return pq_builtins_unify(machine, args[1], size);
+}
+
+//'$tbl_answer'(Table, I, Answer) unifies the I-th answer, from 0.
+static pq_builtin_result pq_builtin_tbl_answer(pq_machine* machine, pq_term* args)
+{
+    uint32_t table;
+    if(!pq_builtins_get_table(machine, args[0], &table)) return PQ_BUILTIN_FAIL;
+    const pq_term index = pq_term_deref(args[1]);
+    if(pq_term_get_tag(index) != PQ_TAG_INT || pq_term_get_int(index) < 0
+        || (size_t)pq_term_get_int(index) >= machine->tables->tables[table].answers_sz)
+        return PQ_BUILTIN_FAIL;
+    if(pq_table_get_answer(machine->tables, table, (size_t)pq_term_get_int(index)) != PQ_SUCCESS)
+    {
+        machine->err = "resource error: not enough memory for the answer.";
+        return PQ_BUILTIN_FAIL;
+    }
+    const pq_term answer = pq_builtins_answer_term(machine);
+    if(answer == PQ_TERM_NONE) return PQ_BUILTIN_FAIL;
+    return pq_builtins_unify(machine, args[2], answer);
+}
+
+/* system */
+
+static pq_builtin_result pq_builtin_consult(pq_machine* machine, pq_term* args)
+{
+    const pq_term path = pq_term_deref(args[0]);
+    if(pq_term_is_var(path))
+    {
+        machine->err = "instantiation error: consult/1 expects a file name.";
+        return PQ_BUILTIN_FAIL;
+    }
+    if(!pq_term_is_atom(path))
+    {
+        machine->err = "type error: consult/1 expects an atom.";
+        return PQ_BUILTIN_FAIL;
+    }
+
+    //the extension is optional, the error of the parser is kept if the file was read.
+    if(pq_machine_consult_file(machine, pq_atom_get_cstr(pq_term_get_atom(path))) != PQ_SUCCESS) return PQ_BUILTIN_FAIL;
+    return machine->halted ? PQ_BUILTIN_FAIL : PQ_BUILTIN_TRUE;
+}
+
+static pq_builtin_result pq_builtin_op(pq_machine* machine, pq_term* args)
+{   //the operators are shared by the parsers of the machine, so they apply to the next clause that is read.
+    if(pq_op_table_add_terms(machine->ops, args[0], args[1], args[2], &machine->err) != PQ_SUCCESS) return PQ_BUILTIN_FAIL;
+    return PQ_BUILTIN_TRUE;
+}
+
+static pq_builtin_result pq_builtin_statistics(pq_machine* machine, pq_term* args)
+{
+    static PQint last_runtime = 0;
+    static PQint last_walltime = 0;
+    const pq_term key = pq_term_deref(args[0]);
+    if(pq_term_is_var(key))
+    {
+        machine->err = "instantiation error: statistics/2 expects a key.";
+        return PQ_BUILTIN_FAIL;
+    }
+
+    pq_term val;
+    switch(pq_term_is_atom(key) ? pq_term_get_atom(key) : PQ_ATOM_NONE)
+    {
+    case PQ_ATOM_CPUTIME:
+        val = pq_machine_new_float(machine, (PQflt)clock() / CLOCKS_PER_SEC);
+        break;
+    case PQ_ATOM_INFERENCES:
+        val = pq_machine_new_integer(machine, (PQint)machine->inferences);
+        break;
+    case PQ_ATOM_RUNTIME:
+    case PQ_ATOM_WALLTIME:
+    {   //[Total, SinceLast] in milliseconds.
+        const PQbool runtime = pq_term_get_atom(key) == PQ_ATOM_RUNTIME;
+        const PQint now = runtime ? (PQint)(clock() / (CLOCKS_PER_SEC / 1000)) : (PQint)time(NULL) * 1000;
+        PQint* last = runtime ? &last_runtime : &last_walltime;
+        pq_term* cells = pq_machine_alloc(machine, 4);
+        if(!cells) return PQ_BUILTIN_FAIL;
+        cells[0] = pq_machine_new_integer(machine, now);
+        cells[1] = pq_make_ptr_term(&cells[2], PQ_TAG_LIST);
+        cells[2] = pq_machine_new_integer(machine, now - *last);
+        cells[3] = pq_new_atom_term(PQ_ATOM_NIL);
+        *last = now;
+        val = cells[0] == PQ_TERM_NONE || cells[2] == PQ_TERM_NONE ? PQ_TERM_NONE : pq_make_ptr_term(cells, PQ_TAG_LIST);
+        break;
+    }
+    case PQ_ATOM_GARBAGE_COLLECTION:
+    {   //[Collections, ReclaimedBytes, Milliseconds].
+        const PQint stats[3] = { (PQint)machine->gc.count, (PQint)machine->gc.reclaimed, (PQint)(machine->gc.time * 1000) };
+        pq_term* cells = pq_machine_alloc(machine, 6);
+        if(!cells) return PQ_BUILTIN_FAIL;
+        val = pq_make_ptr_term(cells, PQ_TAG_LIST);
+        for(uint32_t i = 0; i < 3; ++i)
+        {
+            cells[2 * i] = pq_machine_new_integer(machine, stats[i]);
+            cells[2 * i + 1] = i < 2 ? pq_make_ptr_term(&cells[2 * i + 2], PQ_TAG_LIST) : pq_new_atom_term(PQ_ATOM_NIL);
+            if(cells[2 * i] == PQ_TERM_NONE) val = PQ_TERM_NONE;
+        }
+        break;
+    }
+    default:
+        machine->err = "domain error: statistics/2 expects runtime, cputime, walltime, inferences, or garbage_collection.";
+        return PQ_BUILTIN_FAIL;
+    }
+    if(val == PQ_TERM_NONE) return PQ_BUILTIN_FAIL;
+    return pq_builtins_unify(machine, args[1], val);
+}
+
+static pq_builtin_result pq_builtin_garbage_collect(pq_machine* machine, pq_term* args)
+{
+    (void)args;
+    return pq_machine_gc(machine, 0) == PQ_SUCCESS ? PQ_BUILTIN_TRUE : PQ_BUILTIN_FAIL;
+}
+
+//set_gc_policy(Min, Growth) collects the heap when it grew by max(Min, Live * Growth / 100) cells since the last collection.
+static pq_builtin_result pq_builtin_set_gc_policy(pq_machine* machine, pq_term* args)
+{
+    const pq_term min = pq_term_deref(args[0]);
+    const pq_term growth = pq_term_deref(args[1]);
+    if(pq_term_is_var(min) || pq_term_is_var(growth))
+    {
+        machine->err = "instantiation error: set_gc_policy/2 expects two integers.";
+        return PQ_BUILTIN_FAIL;
+    }
+    if(pq_term_get_tag(min) != PQ_TAG_INT || pq_term_get_tag(growth) != PQ_TAG_INT)
+    {
+        machine->err = "type error: set_gc_policy/2 expects two integers.";
+        return PQ_BUILTIN_FAIL;
+    }
+    if(pq_term_get_int(min) < 0 || pq_term_get_int(growth) < 0 || pq_term_get_int(growth) > UINT32_MAX)
+    {
+        machine->err = "domain error: set_gc_policy/2 expects two non-negative integers.";
+        return PQ_BUILTIN_FAIL;
+    }
+    pq_machine_set_gc_policy(machine, (size_t)pq_term_get_int(min), (uint32_t)pq_term_get_int(growth));
+    return PQ_BUILTIN_TRUE;
+}
+
+//the values of the occurs_check flag, indexed by pq_occurs_check.
+static const pq_atom pq_builtins_occurs_check_values[3] = { PQ_ATOM_FALSE, PQ_ATOM_TRUE, PQ_ATOM_ERROR };
+
+//set_prolog_flag(occurs_check, Value) sets the occurs check of the unifications to false, true, or error.
+static pq_builtin_result pq_builtin_set_prolog_flag(pq_machine* machine, pq_term* args)
+{
+    const pq_term flag = pq_term_deref(args[0]);
+    const pq_term value = pq_term_deref(args[1]);
+    if(pq_term_is_var(flag) || pq_term_is_var(value))
+    {
+        machine->err = "instantiation error: set_prolog_flag/2 expects a flag and a value.";
+        return PQ_BUILTIN_FAIL;
+    }
+    if(!pq_term_is_atom(flag) || pq_term_get_atom(flag) != PQ_ATOM_OCCURS_CHECK)
+    {
+        machine->err = "domain error: set_prolog_flag/2 expects the flag occurs_check.";
+        return PQ_BUILTIN_FAIL;
+    }
+    for(uint32_t i = 0; i < 3; ++i)
+    {
+        if(value != pq_new_atom_term(pq_builtins_occurs_check_values[i])) continue;
+        machine->occurs_check = (pq_occurs_check)i;
+        return PQ_BUILTIN_TRUE;
+    }
+    machine->err = "domain error: the flag occurs_check expects false, true, or error.";
+    return PQ_BUILTIN_FAIL;
+}
+
+static pq_builtin_result pq_builtin_current_prolog_flag(pq_machine* machine, pq_term* args)
+{
+    if(pq_builtins_unify(machine, args[0], pq_new_atom_term(PQ_ATOM_OCCURS_CHECK)) != PQ_BUILTIN_TRUE) return PQ_BUILTIN_FAIL;
+    return pq_builtins_unify(machine, args[1], pq_new_atom_term(pq_builtins_occurs_check_values[machine->occurs_check]));
+}
+
+/**
+ * @brief Writes the indexes of every predicate that has some: the first argument index, the jit indexes, and the memory they use.
+ */
+static pq_builtin_result pq_builtin_index_statistics(pq_machine* machine, pq_term* args)
+{
+    (void)args;
+    char line[256];
+    size_t total = 0;
+    const pq_database* db = machine->db;
+    for(uint32_t i = 0; i <= db->slot_mask; ++i)
+    {
+        const pq_pred* pred = db->preds[i];
+        if(!pred || !pred->entry_block) continue;
+        const pq_code* entry = pred->entry_block;
+        if(pq_wam_get_op(*entry) == PQ_WAM_SWITCH_ON_ARGS) entry += 2;
+        const PQbool first = pq_wam_get_op(*entry) == PQ_WAM_SWITCH_ON_TERM;
+        if(!first && (!pred->jit || !pred->jit->indexes_sz)) continue;
+
+        const size_t memory = pq_database_index_memory(pred);
+        total += memory;
+        snprintf(line, sizeof(line), "%s/%" PRIu32 ": %" PRIu32 " clauses, the indexes use %zu bytes.\n",
+            pq_atom_get_cstr(pred->name), pred->arity, pred->clauses_sz, memory);
+        pq_machine_print(machine, line);
+        if(first) pq_machine_print(machine, "    first argument index.\n");
+        for(size_t j = 0; pred->jit && j < pred->jit->indexes_sz; ++j)
+        {   //the arguments are numbered from 1, like arg/3.
+            const pq_jit_index* index = &pred->jit->indexes[j];
+            int len = snprintf(line, sizeof(line), "    jit index on the arguments");
+            for(uint32_t k = 0; k < PQ_JIT_MAX_ARGS; ++k)
+                if(index->args >> k & 1) len += snprintf(line + len, sizeof(line) - len, " %" PRIu32, k + 1);
+            snprintf(line + len, sizeof(line) - len, ": %" PRIu32 " keys, %zu bytes, %" PRIu64 " calls since the last review.\n",
+                index->keys, index->size * sizeof(pq_code), index->hits);
+            pq_machine_print(machine, line);
+        }
+    }
+    snprintf(line, sizeof(line), "the indexes use %zu bytes.\n", total);
+    pq_machine_print(machine, line);
+    return PQ_BUILTIN_TRUE;
+}
+
+/**
+ * @brief A builtin predicate and its c implementation.
+ */
+typedef struct pq_builtin_def
+{
+    const char* name;
+    uint32_t arity;
+    pq_builtin_fn fn;
+} pq_builtin_def;
+
+static const pq_builtin_def pq_builtin_defs[] = {
+    { "true", 0, pq_builtin_true },
+    { "fail", 0, pq_builtin_fail },
+    { "false", 0, pq_builtin_fail },
+    { "halt", 0, pq_builtin_halt },
+    { "call", 1, pq_builtin_call },
+    { "call", 2, pq_builtin_call2 },
+    { "call", 3, pq_builtin_call3 },
+    { "call", 4, pq_builtin_call4 },
+    { "call", 5, pq_builtin_call5 },
+    { "call", 6, pq_builtin_call6 },
+    { "call", 7, pq_builtin_call7 },
+    { "call", 8, pq_builtin_call8 },
+    { "=", 2, pq_builtin_unify },
+    { "\\=", 2, pq_builtin_not_unify },
+    { "==", 2, pq_builtin_eq },
+    { "\\==", 2, pq_builtin_not_eq },
+    { "@<", 2, pq_builtin_std_lt },
+    { "@=<", 2, pq_builtin_std_le },
+    { "@>", 2, pq_builtin_std_gt },
+    { "@>=", 2, pq_builtin_std_ge },
+    { "compare", 3, pq_builtin_compare },
+    { "var", 1, pq_builtin_var },
+    { "nonvar", 1, pq_builtin_nonvar },
+    { "atom", 1, pq_builtin_atom },
+    { "number", 1, pq_builtin_number },
+    { "integer", 1, pq_builtin_integer },
+    { "float", 1, pq_builtin_float },
+    { "atomic", 1, pq_builtin_atomic },
+    { "compound", 1, pq_builtin_compound },
+    { "callable", 1, pq_builtin_callable },
+    { "is_list", 1, pq_builtin_is_list },
+    { "functor", 3, pq_builtin_functor },
+    { "arg", 3, pq_builtin_arg },
+    { "=..", 2, pq_builtin_univ },
+    { "copy_term", 2, pq_builtin_copy_term },
+    { "is", 2, pq_builtin_is },
+    { "=:=", 2, pq_builtin_arith_eq },
+    { "=\\=", 2, pq_builtin_arith_ne },
+    { "<", 2, pq_builtin_lt },
+    { "=<", 2, pq_builtin_le },
+    { ">", 2, pq_builtin_gt },
+    { ">=", 2, pq_builtin_ge },
+    { "write", 1, pq_builtin_write },
+    { "print", 1, pq_builtin_writeq },
+    { "writeq", 1, pq_builtin_writeq },
+    { "write_canonical", 1, pq_builtin_write_canonical },
+    { "nl", 0, pq_builtin_nl },
+    { "consult", 1, pq_builtin_consult },
+    { "op", 3, pq_builtin_op },
+    { "statistics", 2, pq_builtin_statistics },
+    { "index_statistics", 0, pq_builtin_index_statistics },
+    { "garbage_collect", 0, pq_builtin_garbage_collect },
+    { "set_gc_policy", 2, pq_builtin_set_gc_policy },
+    { "set_prolog_flag", 2, pq_builtin_set_prolog_flag },
+    { "current_prolog_flag", 2, pq_builtin_current_prolog_flag },
+    { "table", 1, pq_builtin_table },
+    { "abolish_all_tables", 0, pq_builtin_abolish_all_tables },
+    { "$tbl_enter", 4, pq_builtin_tbl_enter },
+    { "$tbl_iterate", 1, pq_builtin_tbl_iterate },
+    { "$tbl_add", 2, pq_builtin_tbl_add },
+    { "$tbl_again", 1, pq_builtin_tbl_again },
+    { "$tbl_size", 2, pq_builtin_tbl_size },
+    { "$tbl_answer", 3, pq_builtin_tbl_answer }
+};
+
+int pq_builtins_init(pq_machine* machine)
+{
+    for(size_t i = 0; i < sizeof(pq_builtin_defs) / sizeof(pq_builtin_defs[0]); ++i)
+    {
+        const pq_builtin_def* def = &pq_builtin_defs[i];
+        const pq_atom name = pq_atom_intern(pq_make_lexeme(def->name, strlen(def->name)));
+        pq_pred* pred = name != PQ_ATOM_NONE ? pq_database_get_pred(machine->db, name, def->arity) : NULL;
+        if(!pred) return PQ_FAILURE;
+        pred->builtin = def->fn;
+    }
+
+    //a consulted file replaces the library predicates that it defines.
+    return pq_machine_consult_text(machine, pq_builtins_library);
+}
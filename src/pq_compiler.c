@@ -0,0 +1,1238 @@
+/**
+ * @file pq_compiler.c
+ * @author Brandon Foster
+ * @brief poqer-lang compiler implementation.
+ * the internal implementation of the pq_compiler_* functions are documented below.
+ *
+ * @version 0.001
+ * @date 10-16-2026
+ * @copyright Brandon Foster (c) 2020-2021
+ */
+
+#include "pq_compiler.h"
+#include <stdio.h>
+
+#define PQ_COMPILER_NO_REG UINT32_MAX
+
+/**
+ * @brief Marks a variable cell with the index of the variable, a reference never points to a functor cell so the mark cannot be mistaken for a term.
+ *
+ * @param index The index of the variable.
+ * @return The mark that is stored in the variable cell.
+ */
+static inline pq_term pq_compiler_var_mark(const size_t index)
+{
+    return (pq_term)index << PQ_TERM_TAG_BITS | PQ_TAG_FUNCTOR;
+}
+
+/**
+ * @brief Checks if a dereferenced term is a marked variable.
+ *
+ * @param term The dereferenced term.
+ * @return true if the term is the mark of a variable else false.
+ */
+static inline PQbool pq_compiler_is_var(const pq_term term)
+{
+    return pq_term_get_tag(term) == PQ_TAG_FUNCTOR;
+}
+
+static inline pq_compile_var* pq_compiler_get_var(pq_compiler* compiler, const pq_term mark)
+{
+    return &compiler->vars[mark >> PQ_TERM_TAG_BITS];
+}
+
+/**
+ * @brief Gets a term that refers to a marked variable, it is used to build new terms with the variable.
+ *
+ * @param compiler The compiler that will be used.
+ * @param mark The mark of the variable.
+ * @return The reference to the variable cell.
+ */
+static inline pq_term pq_compiler_var_term(pq_compiler* compiler, const pq_term mark)
+{
+    return pq_make_ptr_term(pq_compiler_get_var(compiler, mark)->cell, PQ_TAG_REF);
+}
+
+/**
+ * @brief Checks if a term is a compound with a name and an arity.
+ *
+ * @param term The dereferenced term.
+ * @param name The name.
+ * @param arity The arity.
+ * @return true if the term is name/arity else false.
+ */
+static inline PQbool pq_compiler_is_functor(const pq_term term, const pq_atom name, const uint32_t arity)
+{
+    return pq_term_get_tag(term) == PQ_TAG_STR && pq_term_get_name(term) == name && pq_term_get_arity(term) == arity;
+}
+
+/**
+ * @brief Adds a variable to the clause and marks its cell.
+ *
+ * @param compiler The compiler that will be modified, upon failure the error is stored here.
+ * @param cell The cell of the unbound variable.
+ * @return The mark of the variable, PQ_TERM_NONE if there is not enough memory.
+ */
+static pq_term pq_compiler_add_var(pq_compiler* compiler, pq_term* cell)
+{
+    if(pq_array_reserve((void**)&compiler->vars, &compiler->vars_cap, compiler->vars_sz + 1, sizeof(pq_compile_var)) != PQ_SUCCESS)
+    {
+        compiler->err = "compile error: not enough memory for the variables.";
+        return PQ_TERM_NONE;
+    }
+    pq_compile_var* var = &compiler->vars[compiler->vars_sz];
+    memset(var, 0, sizeof(pq_compile_var));
+    var->cell = cell;
+    *cell = pq_compiler_var_mark(compiler->vars_sz++);
+    return *cell;
+}
+
+/**
+ * @brief Creates a variable that is not written in the clause (e.g. the choice point of a cut).
+ *
+ * @param compiler The compiler that will be modified, upon failure the error is stored here.
+ * @return The reference to the variable, PQ_TERM_NONE if there is not enough memory.
+ */
+static pq_term pq_compiler_new_var(pq_compiler* compiler)
+{
+    pq_term* cell = (pq_term*)pq_arena_alloc(compiler->arena, sizeof(pq_term));
+    if(!cell || pq_compiler_add_var(compiler, cell) == PQ_TERM_NONE)
+    {
+        compiler->err = "compile error: not enough memory for the variables.";
+        return PQ_TERM_NONE;
+    }
+    return pq_make_ptr_term(cell, PQ_TAG_REF);
+}
+
+/**
+ * @brief Marks every variable of a clause and counts their occurrences.
+ *
+ * @param compiler The compiler that will be modified, upon failure the error is stored here.
+ * @param clause The clause term.
+ */
+static void pq_compiler_mark_vars(pq_compiler* compiler, const pq_term clause)
+{
+    size_t work_sz = 0;
+    compiler->work[work_sz++] = clause;
+    while(work_sz)
+    {
+        const pq_term term = pq_term_deref(compiler->work[--work_sz]);
+        switch(pq_term_get_tag(term))
+        {
+        case PQ_TAG_REF:
+            if(pq_compiler_add_var(compiler, pq_term_get_ptr(term)) == PQ_TERM_NONE) return;
+            compiler->vars[compiler->vars_sz - 1].total = 1;
+            break;
+        case PQ_TAG_FUNCTOR:
+            pq_compiler_get_var(compiler, term)->total++;
+            break;
+        case PQ_TAG_STR:
+        case PQ_TAG_LIST:
+        {
+            const uint32_t arity = pq_term_get_arity(term);
+            if(pq_array_reserve((void**)&compiler->work, &compiler->work_cap, work_sz + arity, sizeof(pq_term)) != PQ_SUCCESS)
+            {
+                compiler->err = "compile error: not enough memory for the clause.";
+                return;
+            }
+            //the arguments are pushed in reverse, the variables are numbered in the order they are written.
+            const pq_term* args = pq_term_get_args(term);
+            for(uint32_t i = arity; i > 0; i--) compiler->work[work_sz++] = args[i - 1];
+            break;
+        }
+        default:
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Restores the variable cells that were marked.
+ *
+ * @param compiler The compiler that will be modified.
+ */
+static void pq_compiler_unmark_vars(pq_compiler* compiler)
+{
+    for(size_t i = 0; i < compiler->vars_sz; i++)
+        *compiler->vars[i].cell = pq_make_ptr_term(compiler->vars[i].cell, PQ_TAG_REF);
+    compiler->vars_sz = 0;
+}
+
+/**
+ * @brief Checks if a goal has a cut that cuts its clause, the cuts in the conditions of (->)/2 and in (\+)/1 are local to them.
+ *
+ * @param compiler The compiler that will be used, upon failure the error is stored here.
+ * @param goal The goal.
+ * @return true if the goal has a cut else false.
+ */
+static PQbool pq_compiler_has_cut(pq_compiler* compiler, const pq_term goal)
+{
+    size_t work_sz = 0;
+    compiler->work[work_sz++] = goal;
+    while(work_sz)
+    {
+        const pq_term term = pq_term_deref(compiler->work[--work_sz]);
+        if(term == pq_new_atom_term(PQ_ATOM_CUT)) return PQ_TRUE;
+        if(pq_term_get_tag(term) != PQ_TAG_STR || pq_term_get_arity(term) != 2) continue;
+
+        const pq_atom name = pq_term_get_name(term);
+        if(name != PQ_ATOM_COMMA && name != PQ_ATOM_SEMICOLON && name != PQ_ATOM_IF_THEN) continue;
+        if(pq_array_reserve((void**)&compiler->work, &compiler->work_cap, work_sz + 2, sizeof(pq_term)) != PQ_SUCCESS)
+        {
+            compiler->err = "compile error: not enough memory for the clause.";
+            return PQ_FALSE;
+        }
+        if(name != PQ_ATOM_IF_THEN) compiler->work[work_sz++] = pq_term_get_arg(term, 0);
+        compiler->work[work_sz++] = pq_term_get_arg(term, 1);
+    }
+    return PQ_FALSE;
+}
+
+/**
+ * @brief Appends a goal to the body.
+ *
+ * @param compiler The compiler that will be modified, upon failure the error is stored here.
+ * @param kind The pq_compile_goal_kind of the goal.
+ * @param term The goal of a call, or the variable of a cut.
+ */
+static void pq_compiler_add_goal(pq_compiler* compiler, const pq_compile_goal_kind kind, const pq_term term)
+{
+    if(pq_array_reserve((void**)&compiler->goals, &compiler->goals_cap, compiler->goals_sz + 1, sizeof(pq_compile_goal)) != PQ_SUCCESS)
+    {
+        compiler->err = "compile error: not enough memory for the body.";
+        return;
+    }
+    pq_compile_goal* goal = &compiler->goals[compiler->goals_sz++];
+    goal->term = term;
+    goal->chunk = 0;
+    goal->kind = (uint8_t)kind;
+}
+
+/**
+ * @brief Creates a compound term in the compiler's arena.
+ *
+ * @param compiler The compiler that will be used, upon failure the error is stored here.
+ * @param name The name of the compound.
+ * @param arity The number of arguments.
+ * @param args The arguments.
+ * @return The compound term (or the atom if the arity is 0), PQ_TERM_NONE if there is not enough memory.
+ */
+static pq_term pq_compiler_new_functor(pq_compiler* compiler, const pq_atom name, const uint32_t arity, const pq_term* args)
+{
+    if(!arity) return pq_new_atom_term(name);
+    pq_term* cells = (pq_term*)pq_arena_alloc(compiler->arena, (1 + (size_t)arity) * sizeof(pq_term));
+    if(!cells)
+    {
+        compiler->err = "compile error: not enough memory for the clause.";
+        return PQ_TERM_NONE;
+    }
+    cells[0] = pq_make_functor_cell(name, arity);
+    memcpy(&cells[1], args, arity * sizeof(pq_term));
+    return pq_make_ptr_term(cells, PQ_TAG_STR);
+}
+
+/**
+ * @brief Queues a clause of an auxiliary predicate.
+ *
+ * @param compiler The compiler that will be modified, upon failure the error is stored here.
+ * @param head The head of the auxiliary clause.
+ * @param body The body of the auxiliary clause.
+ * @param cut_var The head argument that a cut cuts to, PQ_TERM_NONE if there is none.
+ */
+static void pq_compiler_queue_aux(pq_compiler* compiler, const pq_term head, const pq_term body, const pq_term cut_var)
+{
+    const pq_term args[2] = { head, body };
+    const pq_term clause = pq_compiler_new_functor(compiler, PQ_ATOM_NECK, 2, args);
+    if(compiler->err) return;
+    if(pq_array_reserve((void**)&compiler->aux, &compiler->aux_cap, compiler->aux_sz + 1, sizeof(pq_compile_aux)) != PQ_SUCCESS)
+    {
+        compiler->err = "compile error: not enough memory for the clause.";
+        return;
+    }
+    compiler->aux[compiler->aux_sz].clause = clause;
+    compiler->aux[compiler->aux_sz].cut_var = cut_var;
+    compiler->aux_sz++;
+}
+
+/**
+ * @brief Creates the body Condition, '$local_cut', Then of an if-then, the condition is called if it has a cut so the cut stays local to it.
+ *
+ * @param compiler The compiler that will be used, upon failure the error is stored here.
+ * @param cond The condition.
+ * @param then The goal after the condition.
+ * @return The body.
+ */
+static pq_term pq_compiler_if_then_body(pq_compiler* compiler, pq_term cond, const pq_term then)
+{
+    if(pq_compiler_has_cut(compiler, cond)) cond = pq_compiler_new_functor(compiler, PQ_ATOM_CALL, 1, &cond);
+    if(compiler->err) return PQ_TERM_NONE;
+
+    pq_term args[2] = { pq_new_atom_term(PQ_ATOM_LOCAL_CUT), then };
+    args[1] = pq_compiler_new_functor(compiler, PQ_ATOM_COMMA, 2, args);
+    args[0] = cond;
+    if(compiler->err) return PQ_TERM_NONE;
+    return pq_compiler_new_functor(compiler, PQ_ATOM_COMMA, 2, args);
+}
+
+/**
+ * @brief Moves a control construct, (;)/2, (->)/2, or (\+)/1, into a new auxiliary predicate and calls it.
+ * The arguments of the auxiliary predicate are the variables of the construct that also occur outside of it,
+ * and the choice point of the clause if a cut in the construct cuts the clause.
+ *
+ * @param compiler The compiler that will be modified, upon failure the error is stored here.
+ * @param goal The control construct.
+ * @param cut_var The variable that a cut in the clause cuts to, it is created if needed.
+ */
+static void pq_compiler_add_aux_goal(pq_compiler* compiler, const pq_term goal, pq_term* cut_var)
+{
+    const pq_atom name = pq_term_get_name(goal);
+    const PQbool has_cut = name != PQ_ATOM_NOT_PROVABLE && pq_compiler_has_cut(compiler, goal);
+    if(has_cut && *cut_var == PQ_TERM_NONE) *cut_var = pq_compiler_new_var(compiler);
+    if(compiler->err) return;
+
+    //counts the occurrences of the variables in the construct.
+    size_t work_sz = 0;
+    compiler->work[work_sz++] = goal;
+    while(work_sz)
+    {
+        const pq_term term = pq_term_deref(compiler->work[--work_sz]);
+        if(pq_compiler_is_var(term)) pq_compiler_get_var(compiler, term)->inner++;
+        else if(pq_term_is_compound(term))
+        {
+            const uint32_t arity = pq_term_get_arity(term);
+            if(pq_array_reserve((void**)&compiler->work, &compiler->work_cap, work_sz + arity, sizeof(pq_term)) != PQ_SUCCESS)
+            {
+                compiler->err = "compile error: not enough memory for the clause.";
+                return;
+            }
+            memcpy(&compiler->work[work_sz], pq_term_get_args(term), arity * sizeof(pq_term));
+            work_sz += arity;
+        }
+    }
+
+    //the variables that occur outside of the construct become the arguments, the occurrences are reset for the next construct.
+    if(pq_array_reserve((void**)&compiler->work, &compiler->work_cap, compiler->vars_sz + 1, sizeof(pq_term)) != PQ_SUCCESS)
+    {
+        compiler->err = "compile error: not enough memory for the clause.";
+        return;
+    }
+    uint32_t arity = 0;
+    for(size_t i = 0; i < compiler->vars_sz; i++)
+    {
+        pq_compile_var* var = &compiler->vars[i];
+        if(var->inner && var->inner < var->total) compiler->work[arity++] = pq_make_ptr_term(var->cell, PQ_TAG_REF);
+        var->inner = 0;
+    }
+    if(has_cut) compiler->work[arity++] = *cut_var;
+    if(arity > PQ_TERM_ARITY_MAX)
+    {
+        compiler->err = "compile error: the control construct has too many variables.";
+        return;
+    }
+
+    char aux_name[32];
+    snprintf(aux_name, sizeof(aux_name), "$aux%" PRIu32, ++compiler->aux_count);
+    const pq_atom aux_atom = pq_atom_intern(pq_make_lexeme(aux_name, strlen(aux_name)));
+    if(aux_atom == PQ_ATOM_NONE)
+    {
+        compiler->err = "compile error: not enough memory for the clause.";
+        return;
+    }
+    const pq_term head = pq_compiler_new_functor(compiler, aux_atom, arity, compiler->work);
+    const pq_term aux_cut = has_cut ? pq_compiler_var_term(compiler, pq_term_deref(*cut_var)) : PQ_TERM_NONE;
+    if(compiler->err) return;
+
+    const pq_term left = pq_term_deref(pq_term_get_arg(goal, 0));
+    if(name == PQ_ATOM_SEMICOLON)
+    {   //(Cond -> Then ; Else) or (Left ; Right), one clause for each branch.
+        const pq_term first = pq_compiler_is_functor(left, PQ_ATOM_IF_THEN, 2) ?
+            pq_compiler_if_then_body(compiler, pq_term_get_arg(left, 0), pq_term_get_arg(left, 1)) : left;
+        if(compiler->err) return;
+        pq_compiler_queue_aux(compiler, head, first, aux_cut);
+        pq_compiler_queue_aux(compiler, head, pq_term_get_arg(goal, 1), aux_cut);
+    }
+    else if(name == PQ_ATOM_IF_THEN)
+    {   //(Cond -> Then) fails if the condition fails.
+        const pq_term body = pq_compiler_if_then_body(compiler, left, pq_term_get_arg(goal, 1));
+        if(compiler->err) return;
+        pq_compiler_queue_aux(compiler, head, body, aux_cut);
+    }
+    else
+    {   //\+ Goal is (Goal -> fail ; true).
+        const pq_term body = pq_compiler_if_then_body(compiler, left, pq_new_atom_term(PQ_ATOM_FAIL));
+        if(compiler->err) return;
+        pq_compiler_queue_aux(compiler, head, body, PQ_TERM_NONE);
+        pq_compiler_queue_aux(compiler, head, pq_new_atom_term(PQ_ATOM_TRUE), PQ_TERM_NONE);
+    }
+    if(compiler->err) return;
+
+    pq_compiler_add_goal(compiler, PQ_GOAL_CALL, head);
+}
+
+/**
+ * @brief Flattens the conjunctions of the body into goals.
+ *
+ * @param compiler The compiler that will be modified, upon failure the error is stored here.
+ * @param body The body of the clause.
+ * @param cut_var The head argument that a cut cuts to, PQ_TERM_NONE if a cut cuts the clause itself.
+ */
+static void pq_compiler_add_goals(pq_compiler* compiler, const pq_term body, const pq_term cut_var)
+{
+    pq_term own_level = PQ_TERM_NONE; //the choice point of the clause, created by the first cut that needs it.
+    pq_term clause_cut = cut_var;
+
+    compiler->goals_sz = 0;
+    size_t pending_sz = 0;
+    if(pq_array_reserve((void**)&compiler->pending, &compiler->pending_cap, 1, sizeof(pq_term)) != PQ_SUCCESS)
+    {
+        compiler->err = "compile error: not enough memory for the body.";
+        return;
+    }
+    compiler->pending[pending_sz++] = body;
+    while(pending_sz && !compiler->err)
+    {
+        const pq_term goal = pq_term_deref(compiler->pending[--pending_sz]);
+        if(pq_compiler_is_functor(goal, PQ_ATOM_COMMA, 2))
+        {   //the left goal is compiled first.
+            if(pq_array_reserve((void**)&compiler->pending, &compiler->pending_cap, pending_sz + 2, sizeof(pq_term)) != PQ_SUCCESS)
+            {
+                compiler->err = "compile error: not enough memory for the body.";
+                return;
+            }
+            compiler->pending[pending_sz++] = pq_term_get_arg(goal, 1);
+            compiler->pending[pending_sz++] = pq_term_get_arg(goal, 0);
+            continue;
+        }
+
+        switch(pq_term_get_tag(goal))
+        {
+        case PQ_TAG_FUNCTOR:
+        {   //a variable goal is call(Goal).
+            const pq_term var = pq_compiler_var_term(compiler, goal);
+            const pq_term call = pq_compiler_new_functor(compiler, PQ_ATOM_CALL, 1, &var);
+            if(!compiler->err) pq_compiler_add_goal(compiler, PQ_GOAL_CALL, call);
+            break;
+        }
+
+        case PQ_TAG_ATOM:
+            switch(pq_term_get_atom(goal))
+            {
+            case PQ_ATOM_TRUE:
+                break;
+            case PQ_ATOM_FAIL:
+            case PQ_ATOM_FALSE:
+                pq_compiler_add_goal(compiler, PQ_GOAL_FAIL, goal);
+                break;
+            case PQ_ATOM_CUT:
+            case PQ_ATOM_LOCAL_CUT:
+                if(pq_term_get_atom(goal) == PQ_ATOM_LOCAL_CUT || clause_cut == PQ_TERM_NONE)
+                {   //cuts to the choice point of the clause itself.
+                    if(own_level == PQ_TERM_NONE) own_level = pq_compiler_new_var(compiler);
+                    if(clause_cut == PQ_TERM_NONE) clause_cut = own_level;
+                    if(!compiler->err) pq_compiler_add_goal(compiler, PQ_GOAL_CUT, own_level);
+                }
+                else pq_compiler_add_goal(compiler, PQ_GOAL_CUT, clause_cut);
+                break;
+            default:
+                pq_compiler_add_goal(compiler, PQ_GOAL_CALL, goal);
+                break;
+            }
+            break;
+
+        case PQ_TAG_STR:
+            if(pq_compiler_is_functor(goal, PQ_ATOM_SEMICOLON, 2) || pq_compiler_is_functor(goal, PQ_ATOM_IF_THEN, 2)
+                || pq_compiler_is_functor(goal, PQ_ATOM_NOT_PROVABLE, 1))
+            {
+                if(clause_cut == PQ_TERM_NONE && pq_compiler_has_cut(compiler, goal))
+                {   //the construct cuts the clause.
+                    if(own_level == PQ_TERM_NONE) own_level = pq_compiler_new_var(compiler);
+                    clause_cut = own_level;
+                }
+                if(!compiler->err) pq_compiler_add_aux_goal(compiler, goal, &clause_cut);
+            }
+            else pq_compiler_add_goal(compiler, PQ_GOAL_CALL, goal);
+            break;
+
+        case PQ_TAG_LIST:
+            pq_compiler_add_goal(compiler, PQ_GOAL_CALL, goal);
+            break;
+
+        default:
+            compiler->err = "compile error: a goal must be callable.";
+            return;
+        }
+    }
+    if(compiler->err || own_level == PQ_TERM_NONE) return;
+
+    //the choice point is stored before the first goal.
+    pq_compiler_add_goal(compiler, PQ_GOAL_GET_LEVEL, own_level);
+    if(compiler->err) return;
+    memmove(&compiler->goals[1], &compiler->goals[0], (compiler->goals_sz - 1) * sizeof(pq_compile_goal));
+    compiler->goals[0].kind = PQ_GOAL_GET_LEVEL;
+    compiler->goals[0].term = own_level;
+}
+
+/**
+ * @brief Counts the occurrences of the variables of a term in a chunk.
+ *
+ * @param compiler The compiler that will be modified, upon failure the error is stored here.
+ * @param term The term.
+ * @param chunk The chunk of the term.
+ * @param arg The argument of the first call that the term is, -1 if it is not one.
+ */
+static void pq_compiler_count_vars(pq_compiler* compiler, const pq_term term, const uint32_t chunk, const int32_t arg)
+{
+    size_t work_sz = 0;
+    compiler->work[work_sz++] = term;
+    while(work_sz)
+    {
+        const pq_term sub = pq_term_deref(compiler->work[--work_sz]);
+        if(pq_compiler_is_var(sub))
+        {
+            pq_compile_var* var = pq_compiler_get_var(compiler, sub);
+            if(!var->occurrences++) var->first_chunk = chunk;
+            var->last_chunk = chunk;
+            if(arg > var->max_arg) var->max_arg = arg;
+        }
+        else if(pq_term_is_compound(sub))
+        {
+            const uint32_t arity = pq_term_get_arity(sub);
+            if(pq_array_reserve((void**)&compiler->work, &compiler->work_cap, work_sz + arity, sizeof(pq_term)) != PQ_SUCCESS)
+            {
+                compiler->err = "compile error: not enough memory for the clause.";
+                return;
+            }
+            memcpy(&compiler->work[work_sz], pq_term_get_args(sub), arity * sizeof(pq_term));
+            work_sz += arity;
+        }
+    }
+}
+
+/**
+ * @brief Splits the body into chunks and classifies the variables as void, temporary, or permanent.
+ *
+ * @param compiler The compiler that will be modified, upon failure the error is stored here.
+ * @param head The head of the clause.
+ * @return The number of permanent variables.
+ */
+static uint32_t pq_compiler_classify_vars(pq_compiler* compiler, const pq_term head)
+{
+    for(size_t i = 0; i < compiler->vars_sz; i++)
+    {
+        pq_compile_var* var = &compiler->vars[i];
+        var->occurrences = 0;
+        var->max_arg = -1;
+        var->seen = PQ_FALSE;
+        var->in_call = PQ_FALSE;
+        var->reg = PQ_COMPILER_NO_REG;
+    }
+
+    pq_compiler_count_vars(compiler, head, 0, -1);
+    uint32_t chunk = 0;
+    for(size_t i = 0; i < compiler->goals_sz && !compiler->err; i++)
+    {
+        pq_compile_goal* goal = &compiler->goals[i];
+        goal->chunk = chunk;
+        if(goal->kind != PQ_GOAL_CALL)
+        {
+            if(goal->kind != PQ_GOAL_FAIL) pq_compiler_count_vars(compiler, goal->term, chunk, -1);
+            continue;
+        }
+
+        const pq_term term = pq_term_deref(goal->term);
+        const uint32_t arity = pq_term_get_arity(term);
+        for(uint32_t j = 0; j < arity && !compiler->err; j++)
+        {   //the arguments of the first call are numbered, it decides which head arguments keep their register.
+            pq_compiler_count_vars(compiler, pq_term_get_arg(term, j), chunk, chunk == 0 ? (int32_t)j : -1);
+        }
+        chunk++;
+    }
+    if(compiler->err) return 0;
+
+    //marks the variables that are passed to a call, a cut level that is not passed can use neck_cut.
+    for(size_t i = 0; i < compiler->goals_sz; i++)
+    {
+        if(compiler->goals[i].kind != PQ_GOAL_CALL) continue;
+        const pq_term term = pq_term_deref(compiler->goals[i].term);
+        for(uint32_t j = 0; j < pq_term_get_arity(term); j++)
+        {
+            const pq_term arg = pq_term_deref(pq_term_get_arg(term, j));
+            if(pq_compiler_is_var(arg)) pq_compiler_get_var(compiler, arg)->in_call = PQ_TRUE;
+        }
+    }
+
+    //the permanent variables are ordered by their last chunk, the latest first,
+    //so the variables that are used after a call are the lowest ones and the environment is trimmed above them.
+    if(pq_array_reserve((void**)&compiler->work, &compiler->work_cap, (size_t)chunk + 1, sizeof(pq_term)) != PQ_SUCCESS)
+    {
+        compiler->err = "compile error: not enough memory for the clause.";
+        return 0;
+    }
+    memset(compiler->work, 0, ((size_t)chunk + 1) * sizeof(pq_term));
+    uint32_t perms = 0;
+    for(size_t i = 0; i < compiler->vars_sz; i++)
+    {
+        pq_compile_var* var = &compiler->vars[i];
+        if(var->occurrences <= 1) var->kind = PQ_VAR_VOID;
+        else if(var->first_chunk != var->last_chunk)
+        {
+            var->kind = PQ_VAR_PERM;
+            compiler->work[var->last_chunk]++;
+            perms++;
+        }
+        else var->kind = PQ_VAR_TEMP;
+    }
+    pq_term later = 0; //the permanent variables of the later chunks.
+    for(uint32_t c = chunk + 1; c-- > 0;)
+    {
+        const pq_term count = compiler->work[c];
+        compiler->work[c] = later;
+        later += count;
+    }
+    for(size_t i = 0; i < compiler->goals_sz; i++)
+    {   //the variables of the chunk of a call are not used after it.
+        pq_compile_goal* goal = &compiler->goals[i];
+        if(goal->kind == PQ_GOAL_CALL) goal->live = (uint32_t)compiler->work[goal->chunk];
+    }
+    for(size_t i = 0; i < compiler->vars_sz; i++)
+    {
+        pq_compile_var* var = &compiler->vars[i];
+        if(var->kind == PQ_VAR_PERM) var->reg = (uint32_t)compiler->work[var->last_chunk]++;
+    }
+    return perms;
+}
+
+/**
+ * @brief Appends an instruction to the code.
+ *
+ * @param compiler The compiler that will be modified, upon failure the error is stored here.
+ * @param op The opcode.
+ * @param a The first register operand.
+ * @param b The second register operand.
+ */
+static inline void pq_compiler_emit(pq_compiler* compiler, const pq_wam_opcode op, const uint32_t a, const uint32_t b)
+{
+    if(pq_array_reserve((void**)&compiler->code, &compiler->code_cap, compiler->code_sz + 1, sizeof(pq_code)) != PQ_SUCCESS)
+    {
+        compiler->err = "compile error: not enough memory for the code.";
+        return;
+    }
+    compiler->code[compiler->code_sz++] = pq_wam_make(op, a, b);
+}
+
+/**
+ * @brief Appends an operand word to the code.
+ *
+ * @param compiler The compiler that will be modified, upon failure the error is stored here.
+ * @param word The operand word.
+ */
+static inline void pq_compiler_emit_word(pq_compiler* compiler, const pq_code word)
+{
+    if(pq_array_reserve((void**)&compiler->code, &compiler->code_cap, compiler->code_sz + 1, sizeof(pq_code)) != PQ_SUCCESS)
+    {
+        compiler->err = "compile error: not enough memory for the code.";
+        return;
+    }
+    compiler->code[compiler->code_sz++] = word;
+}
+
+/**
+ * @brief Appends a constant operand, a boxed constant is copied into the database so it outlives the clause term.
+ *
+ * @param compiler The compiler that will be modified, upon failure the error is stored here.
+ * @param term The atomic term.
+ */
+static void pq_compiler_emit_constant(pq_compiler* compiler, const pq_term term)
+{
+    if(pq_term_get_tag(term) != PQ_TAG_BOX)
+    {
+        pq_compiler_emit_word(compiler, term);
+        return;
+    }
+
+    const pq_term* box = pq_term_get_ptr(term);
+    const size_t size = 1 + (size_t)(*box >> 32);
+    pq_term* copy = (pq_term*)pq_arena_alloc(compiler->db->arena, size * sizeof(pq_term));
+    if(!copy)
+    {
+        compiler->err = "compile error: not enough memory for the code.";
+        return;
+    }
+    memcpy(copy, box, size * sizeof(pq_term));
+    pq_compiler_emit_word(compiler, pq_make_ptr_term(copy, PQ_TAG_BOX));
+}
+
+/**
+ * @brief Gets a register that is not used by the chunk.
+ *
+ * @param compiler The compiler that will be modified, upon failure the error is stored here.
+ * @return The register.
+ */
+static inline uint32_t pq_compiler_new_reg(pq_compiler* compiler)
+{
+    if(compiler->free_regs_sz) return compiler->free_regs[--compiler->free_regs_sz];
+    if(compiler->next_reg >= PQ_WAM_REGISTERS)
+    {
+        compiler->err = "compile error: the clause needs too many registers.";
+        return 0;
+    }
+    return compiler->next_reg++;
+}
+
+/**
+ * @brief Releases a register of a structure, it is reused by the next structure of the chunk.
+ *
+ * @param compiler The compiler that will be modified, upon failure the error is stored here.
+ * @param reg The register.
+ */
+static inline void pq_compiler_free_reg(pq_compiler* compiler, const uint32_t reg)
+{
+    if(pq_array_reserve((void**)&compiler->free_regs, &compiler->free_regs_cap, compiler->free_regs_sz + 1, sizeof(uint32_t)) != PQ_SUCCESS)
+        return; //the register is not reused.
+    compiler->free_regs[compiler->free_regs_sz++] = reg;
+}
+
+/**
+ * @brief Emits the instruction for an argument of a structure.
+ *
+ * @param compiler The compiler that will be modified, upon failure the error is stored here.
+ * @param arg The dereferenced argument.
+ * @param reg The register that holds a compound argument of a call, PQ_COMPILER_NO_REG in a head (the compound is queued).
+ * @param queue_sz The number of structures in the head queue, it is incremented if the argument is queued.
+ */
+static void pq_compiler_emit_unify(pq_compiler* compiler, const pq_term arg, const uint32_t reg, size_t* queue_sz)
+{
+    if(pq_compiler_is_var(arg))
+    {
+        pq_compile_var* var = pq_compiler_get_var(compiler, arg);
+        if(var->kind == PQ_VAR_VOID)
+        {   //consecutive void arguments share one instruction.
+            if(compiler->void_at + 1 == compiler->code_sz)
+            {
+                const pq_code word = compiler->code[compiler->void_at];
+                compiler->code[compiler->void_at] = pq_wam_make(PQ_WAM_UNIFY_VOID, pq_wam_get_a(word) + 1, 0);
+                return;
+            }
+            compiler->void_at = compiler->code_sz;
+            pq_compiler_emit(compiler, PQ_WAM_UNIFY_VOID, 1, 0);
+            return;
+        }
+        if(var->seen)
+        {
+            pq_compiler_emit(compiler, var->kind == PQ_VAR_PERM ? PQ_WAM_UNIFY_VALUE_Y : PQ_WAM_UNIFY_VALUE_X, var->reg, 0);
+            return;
+        }
+        var->seen = PQ_TRUE;
+        if(var->kind == PQ_VAR_TEMP) var->reg = pq_compiler_new_reg(compiler);
+        pq_compiler_emit(compiler, var->kind == PQ_VAR_PERM ? PQ_WAM_UNIFY_VARIABLE_Y : PQ_WAM_UNIFY_VARIABLE_X, var->reg, 0);
+        return;
+    }
+
+    switch(pq_term_get_tag(arg))
+    {
+    case PQ_TAG_STR:
+    case PQ_TAG_LIST:
+        if(reg != PQ_COMPILER_NO_REG)
+        {   //the structure was built before this one.
+            pq_compiler_emit(compiler, PQ_WAM_UNIFY_VALUE_X, reg, 0);
+            return;
+        }
+        if(pq_array_reserve((void**)&compiler->structs, &compiler->structs_cap, *queue_sz + 1, sizeof(pq_compile_struct)) != PQ_SUCCESS)
+        {
+            compiler->err = "compile error: not enough memory for the clause.";
+            return;
+        }
+        compiler->structs[*queue_sz].term = arg;
+        compiler->structs[*queue_sz].next = pq_compiler_new_reg(compiler);
+        pq_compiler_emit(compiler, PQ_WAM_UNIFY_VARIABLE_X, compiler->structs[*queue_sz].next, 0);
+        (*queue_sz)++;
+        return;
+
+    case PQ_TAG_ATOM:
+        if(pq_term_get_atom(arg) == PQ_ATOM_NIL)
+        {
+            pq_compiler_emit(compiler, PQ_WAM_UNIFY_NIL, 0, 0);
+            return;
+        }
+        //fallthrough
+    default:
+        pq_compiler_emit(compiler, PQ_WAM_UNIFY_CONSTANT, 0, 0);
+        pq_compiler_emit_constant(compiler, arg);
+        return;
+    }
+}
+
+/**
+ * @brief Emits the instructions that unify a head argument with its argument register.
+ * The nested structures are unified breadth first, each one from the temporary register it was read into.
+ *
+ * @param compiler The compiler that will be modified, upon failure the error is stored here.
+ * @param arg The argument.
+ * @param index The index of the argument.
+ * @param first_call The first call of the body, PQ_TERM_NONE if there is none.
+ */
+static void pq_compiler_emit_head_arg(pq_compiler* compiler, pq_term arg, const uint32_t index, const pq_term first_call)
+{
+    arg = pq_term_deref(arg);
+    if(pq_compiler_is_var(arg))
+    {
+        pq_compile_var* var = pq_compiler_get_var(compiler, arg);
+        if(var->kind == PQ_VAR_VOID) return;
+        if(var->seen)
+        {
+            pq_compiler_emit(compiler, var->kind == PQ_VAR_PERM ? PQ_WAM_GET_VALUE_Y : PQ_WAM_GET_VALUE_X, var->reg, index);
+            return;
+        }
+        var->seen = PQ_TRUE;
+        if(var->kind == PQ_VAR_PERM)
+        {
+            pq_compiler_emit(compiler, PQ_WAM_GET_VARIABLE_Y, var->reg, index);
+            return;
+        }
+
+        //the variable stays in its argument register if the first call does not overwrite it before its last use.
+        if(var->max_arg < (int32_t)index
+            || (var->max_arg == (int32_t)index && pq_term_deref(pq_term_get_arg(first_call, index)) == arg))
+        {
+            var->reg = index;
+            return;
+        }
+        var->reg = pq_compiler_new_reg(compiler);
+        pq_compiler_emit(compiler, PQ_WAM_GET_VARIABLE_X, var->reg, index);
+        return;
+    }
+
+    switch(pq_term_get_tag(arg))
+    {
+    case PQ_TAG_STR:
+    case PQ_TAG_LIST:
+        break;
+    case PQ_TAG_ATOM:
+        if(pq_term_get_atom(arg) == PQ_ATOM_NIL)
+        {
+            pq_compiler_emit(compiler, PQ_WAM_GET_NIL, index, 0);
+            return;
+        }
+        //fallthrough
+    default:
+        pq_compiler_emit(compiler, PQ_WAM_GET_CONSTANT, index, 0);
+        pq_compiler_emit_constant(compiler, arg);
+        return;
+    }
+
+    size_t queue_sz = 1;
+    compiler->structs[0].term = arg;
+    compiler->structs[0].next = index;
+    for(size_t i = 0; i < queue_sz && !compiler->err; i++)
+    {
+        const pq_term term = compiler->structs[i].term;
+        const uint32_t reg = compiler->structs[i].next;
+        if(i) pq_compiler_free_reg(compiler, reg);
+
+        if(pq_term_get_tag(term) == PQ_TAG_LIST) pq_compiler_emit(compiler, PQ_WAM_GET_LIST, reg, 0);
+        else
+        {
+            pq_compiler_emit(compiler, PQ_WAM_GET_STRUCTURE, reg, 0);
+            pq_compiler_emit_word(compiler, *pq_term_get_ptr(term));
+        }
+        const uint32_t arity = pq_term_get_arity(term);
+        for(uint32_t j = 0; j < arity; j++)
+            pq_compiler_emit_unify(compiler, pq_term_deref(pq_term_get_arg(term, j)), PQ_COMPILER_NO_REG, &queue_sz);
+    }
+}
+
+/**
+ * @brief Emits the instructions that build a structure in a register for a call.
+ * The nested structures are built first (post-order), each one in a temporary register.
+ *
+ * @param compiler The compiler that will be modified, upon failure the error is stored here.
+ * @param term The structure.
+ * @param target The register of the structure.
+ */
+static void pq_compiler_emit_build(pq_compiler* compiler, const pq_term term, const uint32_t target)
+{
+    size_t structs_sz = 1;
+    size_t regs_sz = 0;
+    compiler->structs[0].term = term;
+    compiler->structs[0].next = 0;
+    while(structs_sz && !compiler->err)
+    {
+        pq_compile_struct* top = &compiler->structs[structs_sz - 1];
+        const uint32_t arity = pq_term_get_arity(top->term);
+        while(top->next < arity && !pq_term_is_compound(pq_term_deref(pq_term_get_arg(top->term, top->next)))) top->next++;
+        if(top->next < arity)
+        {   //builds the nested structure first.
+            const pq_term sub = pq_term_deref(pq_term_get_arg(top->term, top->next++));
+            if(pq_array_reserve((void**)&compiler->structs, &compiler->structs_cap, structs_sz + 1, sizeof(pq_compile_struct)) != PQ_SUCCESS)
+            {
+                compiler->err = "compile error: not enough memory for the clause.";
+                return;
+            }
+            compiler->structs[structs_sz].term = sub;
+            compiler->structs[structs_sz].next = 0;
+            structs_sz++;
+            continue;
+        }
+
+        //every nested structure is built, their registers are the last ones on the register stack.
+        const pq_term done = top->term;
+        structs_sz--;
+        const uint32_t reg = structs_sz ? pq_compiler_new_reg(compiler) : target;
+        if(pq_term_get_tag(done) == PQ_TAG_LIST) pq_compiler_emit(compiler, PQ_WAM_PUT_LIST, reg, 0);
+        else
+        {
+            pq_compiler_emit(compiler, PQ_WAM_PUT_STRUCTURE, reg, 0);
+            pq_compiler_emit_word(compiler, *pq_term_get_ptr(done));
+        }
+
+        uint32_t nested = 0;
+        for(uint32_t j = 0; j < arity; j++) nested += pq_term_is_compound(pq_term_deref(pq_term_get_arg(done, j)));
+        size_t next_reg = regs_sz - nested;
+        for(uint32_t j = 0; j < arity; j++)
+        {
+            const pq_term arg = pq_term_deref(pq_term_get_arg(done, j));
+            if(pq_term_is_compound(arg))
+            {
+                pq_compiler_emit_unify(compiler, arg, compiler->regs[next_reg], NULL);
+                pq_compiler_free_reg(compiler, compiler->regs[next_reg++]);
+            }
+            else pq_compiler_emit_unify(compiler, arg, PQ_COMPILER_NO_REG, NULL);
+        }
+        regs_sz -= nested;
+
+        if(structs_sz)
+        {
+            if(pq_array_reserve((void**)&compiler->regs, &compiler->regs_cap, regs_sz + 1, sizeof(uint32_t)) != PQ_SUCCESS)
+            {
+                compiler->err = "compile error: not enough memory for the clause.";
+                return;
+            }
+            compiler->regs[regs_sz++] = reg;
+        }
+    }
+}
+
+/**
+ * @brief Emits the instruction that puts an argument of a call in its argument register.
+ *
+ * @param compiler The compiler that will be modified, upon failure the error is stored here.
+ * @param arg The argument.
+ * @param index The index of the argument.
+ */
+static void pq_compiler_emit_put_arg(pq_compiler* compiler, pq_term arg, const uint32_t index)
+{
+    arg = pq_term_deref(arg);
+    if(pq_compiler_is_var(arg))
+    {
+        pq_compile_var* var = pq_compiler_get_var(compiler, arg);
+        if(var->kind == PQ_VAR_VOID)
+        {
+            pq_compiler_emit(compiler, PQ_WAM_PUT_VARIABLE_X, index, index);
+            return;
+        }
+        if(var->seen)
+        {
+            if(var->kind == PQ_VAR_PERM) pq_compiler_emit(compiler, PQ_WAM_PUT_VALUE_Y, var->reg, index);
+            else if(var->reg != index) pq_compiler_emit(compiler, PQ_WAM_PUT_VALUE_X, var->reg, index);
+            return;
+        }
+        var->seen = PQ_TRUE;
+        if(var->kind == PQ_VAR_PERM)
+        {
+            pq_compiler_emit(compiler, PQ_WAM_PUT_VARIABLE_Y, var->reg, index);
+            return;
+        }
+        //the argument register is not overwritten before the call, later arguments use higher registers.
+        var->reg = index;
+        pq_compiler_emit(compiler, PQ_WAM_PUT_VARIABLE_X, index, index);
+        return;
+    }
+
+    switch(pq_term_get_tag(arg))
+    {
+    case PQ_TAG_STR:
+    case PQ_TAG_LIST:
+        pq_compiler_emit_build(compiler, arg, index);
+        return;
+    case PQ_TAG_ATOM:
+        if(pq_term_get_atom(arg) == PQ_ATOM_NIL)
+        {
+            pq_compiler_emit(compiler, PQ_WAM_PUT_NIL, index, 0);
+            return;
+        }
+        //fallthrough
+    default:
+        pq_compiler_emit(compiler, PQ_WAM_PUT_CONSTANT, index, 0);
+        pq_compiler_emit_constant(compiler, arg);
+        return;
+    }
+}
+
+/**
+ * @brief Emits the code of a clause after its goals and variables are known.
+ *
+ * @param compiler The compiler that will be modified, upon failure the error is stored here.
+ * @param head The head of the clause.
+ * @param perms The number of permanent variables.
+ */
+static void pq_compiler_emit_clause(pq_compiler* compiler, const pq_term head, const uint32_t perms)
+{
+    //the registers above the arguments of the head and of every call are free for the temporary variables.
+    uint32_t base = pq_term_get_arity(head);
+    size_t first_call = SIZE_MAX;
+    for(size_t i = 0; i < compiler->goals_sz; i++)
+    {
+        if(compiler->goals[i].kind != PQ_GOAL_CALL) continue;
+        if(first_call == SIZE_MAX) first_call = i;
+        const uint32_t arity = pq_term_get_arity(pq_term_deref(compiler->goals[i].term));
+        if(arity > base) base = arity;
+    }
+    if(base > PQ_WAM_REGISTERS)
+    {
+        compiler->err = "compile error: the clause needs too many registers.";
+        return;
+    }
+
+    //an environment is needed if a goal follows the first call, it keeps the continuation and the permanent variables.
+    const PQbool has_env = first_call != SIZE_MAX && first_call + 1 < compiler->goals_sz;
+
+    //a cut before the first call cuts to the choice point of the call directly (neck_cut), if its level is not passed to a call.
+    PQbool neck_cut = PQ_FALSE;
+    if(compiler->goals_sz && compiler->goals[0].kind == PQ_GOAL_GET_LEVEL)
+    {
+        const pq_compile_var* level = pq_compiler_get_var(compiler, pq_term_deref(compiler->goals[0].term));
+        neck_cut = level->kind != PQ_VAR_PERM && !level->in_call;
+    }
+
+    compiler->code_sz = 0;
+    compiler->void_at = SIZE_MAX;
+    compiler->next_reg = base;
+    compiler->free_regs_sz = 0;
+    if(has_env) pq_compiler_emit(compiler, PQ_WAM_ALLOCATE, perms, 0);
+
+    const pq_term first_call_term = first_call != SIZE_MAX ? pq_term_deref(compiler->goals[first_call].term) : PQ_TERM_NONE;
+    const uint32_t head_arity = pq_term_get_arity(head);
+    if(head_arity && pq_array_reserve((void**)&compiler->structs, &compiler->structs_cap, 1, sizeof(pq_compile_struct)) != PQ_SUCCESS)
+    {
+        compiler->err = "compile error: not enough memory for the clause.";
+        return;
+    }
+    for(uint32_t i = 0; i < head_arity && !compiler->err; i++)
+        pq_compiler_emit_head_arg(compiler, pq_term_get_arg(head, i), i, first_call_term);
+
+    PQbool ended = PQ_FALSE; //whether the last instruction leaves the clause.
+    for(size_t i = 0; i < compiler->goals_sz && !compiler->err && !ended; i++)
+    {
+        const pq_compile_goal* goal = &compiler->goals[i];
+        switch(goal->kind)
+        {
+        case PQ_GOAL_GET_LEVEL:
+        {
+            if(neck_cut) break;
+            pq_compile_var* var = pq_compiler_get_var(compiler, pq_term_deref(goal->term));
+            var->seen = PQ_TRUE;
+            if(var->kind == PQ_VAR_PERM) pq_compiler_emit(compiler, PQ_WAM_GET_LEVEL_Y, var->reg, 0);
+            else
+            {
+                var->reg = pq_compiler_new_reg(compiler);
+                pq_compiler_emit(compiler, PQ_WAM_GET_LEVEL_X, var->reg, 0);
+            }
+            break;
+        }
+
+        case PQ_GOAL_CUT:
+        {
+            const pq_compile_var* var = pq_compiler_get_var(compiler, pq_term_deref(goal->term));
+            if(neck_cut && var == pq_compiler_get_var(compiler, pq_term_deref(compiler->goals[0].term)))
+                pq_compiler_emit(compiler, PQ_WAM_NECK_CUT, 0, 0);
+            else pq_compiler_emit(compiler, var->kind == PQ_VAR_PERM ? PQ_WAM_CUT_Y : PQ_WAM_CUT_X, var->reg, 0);
+            break;
+        }
+
+        case PQ_GOAL_FAIL:
+            pq_compiler_emit(compiler, PQ_WAM_FAIL, 0, 0);
+            ended = PQ_TRUE;
+            break;
+
+        case PQ_GOAL_CALL:
+        {
+            const pq_term term = pq_term_deref(goal->term);
+            const uint32_t arity = pq_term_get_arity(term);
+            pq_pred* pred = pq_database_get_pred(compiler->db, pq_term_get_name(term), arity);
+            if(!pred)
+            {
+                compiler->err = "compile error: not enough memory for the predicate.";
+                return;
+            }
+            if(arity && pq_array_reserve((void**)&compiler->structs, &compiler->structs_cap, 1, sizeof(pq_compile_struct)) != PQ_SUCCESS)
+            {
+                compiler->err = "compile error: not enough memory for the clause.";
+                return;
+            }
+            for(uint32_t j = 0; j < arity && !compiler->err; j++) pq_compiler_emit_put_arg(compiler, pq_term_get_arg(term, j), j);
+
+            if(i + 1 == compiler->goals_sz)
+            {   //the last call reuses the continuation of the clause.
+                if(has_env) pq_compiler_emit(compiler, PQ_WAM_DEALLOCATE, 0, 0);
+                pq_compiler_emit(compiler, PQ_WAM_EXECUTE, 0, 0);
+                ended = PQ_TRUE;
+            }
+            else pq_compiler_emit(compiler, PQ_WAM_CALL, goal->live, 0);
+            pq_compiler_emit_word(compiler, pq_wam_make_ptr(pred));
+
+            //the call overwrites every X register, the next chunk starts above the arguments again.
+            compiler->next_reg = base;
+            compiler->free_regs_sz = 0;
+            break;
+        }
+        }
+    }
+
+    if(!ended)
+    {
+        if(has_env) pq_compiler_emit(compiler, PQ_WAM_DEALLOCATE, 0, 0);
+        pq_compiler_emit(compiler, PQ_WAM_PROCEED, 0, 0);
+    }
+    if(!compiler->err) compiler->code_sz = pq_wam_fuse(compiler->code, compiler->code_sz);
+}
+
+pq_compiler* pq_new_compiler(pq_database* db)
+{
+    pq_compiler* compiler = (pq_compiler*)calloc(1, sizeof(pq_compiler));
+    if(!compiler) return NULL;
+
+    compiler->db = db;
+    compiler->arena = pq_new_arena(0);
+    compiler->work = (pq_term*)malloc(64 * sizeof(pq_term));
+    if(!compiler->arena || !compiler->work)
+    {
+        pq_del_compiler(compiler);
+        return NULL;
+    }
+    compiler->work_cap = 64;
+    compiler->void_at = SIZE_MAX;
+    return compiler;
+}
+
+void pq_del_compiler(pq_compiler* compiler)
+{
+    if(!compiler) return;
+
+    pq_del_arena(compiler->arena);
+    free(compiler->code);
+    free(compiler->vars);
+    free(compiler->goals);
+    free(compiler->aux);
+    free(compiler->work);
+    free(compiler->pending);
+    free(compiler->structs);
+    free(compiler->regs);
+    free(compiler->free_regs);
+    free(compiler);
+}
+
+/**
+ * @brief Compiles one clause and adds it to the database, the auxiliary clauses it needs are queued.
+ *
+ * @param compiler The compiler that will be modified, upon failure the error is stored here.
+ * @param clause The clause term.
+ * @param cut_var The head argument that a cut cuts to, PQ_TERM_NONE if a cut cuts the clause itself.
+ * @return PQ_SUCCESS if the clause was added else PQ_FAILURE.
+ */
+static int pq_compiler_compile_clause(pq_compiler* compiler, const pq_term clause, const pq_term cut_var)
+{
+    pq_term head = pq_term_deref(clause);
+    pq_term body = pq_new_atom_term(PQ_ATOM_TRUE);
+    if(pq_compiler_is_functor(head, PQ_ATOM_NECK, 2))
+    {
+        body = pq_term_get_arg(head, 1);
+        head = pq_term_deref(pq_term_get_arg(head, 0));
+    }
+    else if(pq_compiler_is_functor(head, PQ_ATOM_NECK, 1))
+    {
+        compiler->err = "compile error: a directive is not a clause.";
+        return PQ_FAILURE;
+    }
+    if(!pq_term_is_atom(head) && !pq_term_is_compound(head))
+    {
+        compiler->err = "compile error: the head of a clause must be callable.";
+        return PQ_FAILURE;
+    }
+    if(pq_term_get_arity(head) > PQ_WAM_REGISTERS)
+    {
+        compiler->err = "compile error: the clause needs too many registers.";
+        return PQ_FAILURE;
+    }
+
+    pq_compiler_mark_vars(compiler, clause);
+    uint32_t perms = 0;
+    if(!compiler->err) pq_compiler_add_goals(compiler, body, cut_var);
+    if(!compiler->err) perms = pq_compiler_classify_vars(compiler, head);
+    if(!compiler->err) pq_compiler_emit_clause(compiler, head, perms);
+    pq_compiler_unmark_vars(compiler);
+    if(compiler->err) return PQ_FAILURE;
+
+    pq_pred* pred = pq_database_get_pred(compiler->db, pq_term_get_name(head), pq_term_get_arity(head));
+    if(pred && pred->tabled) pred = pred->tabled; //the clauses of a tabled predicate are evaluated by its table.
+    if(pred && pred->builtin)
+    {
+        compiler->err = "compile error: a builtin predicate cannot be modified.";
+        return PQ_FAILURE;
+    }
+    if(!pred || pq_database_add_clause(pred, compiler->code, compiler->code_sz) != PQ_SUCCESS)
+    {
+        compiler->err = "compile error: not enough memory for the predicate.";
+        return PQ_FAILURE;
+    }
+    return PQ_SUCCESS;
+}
+
+/**
+ * @brief Compiles a clause and the auxiliary clauses it needs.
+ *
+ * @param compiler The compiler that will be modified, upon failure the error is stored here.
+ * @param clause The clause term.
+ * @return PQ_SUCCESS if every clause was added else PQ_FAILURE.
+ */
+static int pq_compiler_compile_all(pq_compiler* compiler, const pq_term clause)
+{
+    compiler->err = NULL;
+    compiler->aux_sz = 0;
+    int result = pq_compiler_compile_clause(compiler, clause, PQ_TERM_NONE);
+    for(size_t i = 0; result == PQ_SUCCESS && i < compiler->aux_sz; i++)
+    {   //the clauses are compiled in the order they were queued, it is the order of the clauses of each auxiliary predicate.
+        const pq_compile_aux aux = compiler->aux[i];
+        result = pq_compiler_compile_clause(compiler, aux.clause, aux.cut_var);
+    }
+    compiler->aux_sz = 0;
+    pq_arena_reset(compiler->arena);
+    return result;
+}
+
+int pq_compiler_add_clause(pq_compiler* compiler, const pq_term clause)
+{
+    return pq_compiler_compile_all(compiler, clause);
+}
+
+pq_pred* pq_compiler_add_query(pq_compiler* compiler, const pq_atom name, const pq_term goal, const pq_term* vars, const uint32_t vars_sz)
+{
+    compiler->err = NULL;
+    pq_pred* pred = pq_database_get_pred(compiler->db, name, vars_sz);
+    if(!pred)
+    {
+        compiler->err = "compile error: not enough memory for the predicate.";
+        return NULL;
+    }
+    if(pq_database_clear_pred(compiler->db, pred) != PQ_SUCCESS)
+    {
+        compiler->err = "compile error: not enough memory for the predicate.";
+        return NULL;
+    }
+
+    pq_term args[2];
+    args[0] = pq_compiler_new_functor(compiler, name, vars_sz, vars);
+    args[1] = goal;
+    const pq_term clause = compiler->err ? PQ_TERM_NONE : pq_compiler_new_functor(compiler, PQ_ATOM_NECK, 2, args);
+    if(compiler->err) return NULL;
+    return pq_compiler_compile_all(compiler, clause) == PQ_SUCCESS ? pred : NULL;
+}
@@ -0,0 +1,181 @@
+/**
+ * @file pq_compiler.h
+ * @author Brandon Foster
+ * @brief poqer-lang compiler header.
+ * the pq_compiler struct compiles clauses into abstract machine instructions (see pq_wam.h) and adds them to a database.
+ * create/destroy the compiler with the pq_new_* and pq_del_* functions.
+ * compile a clause with pq_compiler_add_clause function, compile a query with pq_compiler_add_query function.
+ *
+ * the body of a clause is split into chunks, a chunk ends with a call.
+ * a variable that is used in more than one chunk is permanent (a Y register in the environment), else it is temporary (an X register).
+ * the control constructs (;)/2, (->)/2, and (\+)/1 are compiled into auxiliary predicates, a cut in them cuts the clause.
+ *
+ * @version 0.001
+ * @date 10-16-2026
+ * @copyright Brandon Foster (c) 2020-2021
+ */
+
+#ifndef _PQ_COMPILER_H
+#define _PQ_COMPILER_H
+#include "pq_globals.h"
+#include "pq_term.h"
+#include "pq_arena.h"
+#include "pq_wam.h"
+#include "pq_database.h"
+
+/**
+ * @brief The kinds of variables of a clause.
+ */
+typedef enum pq_compile_var_kind
+{
+    PQ_VAR_VOID, //occurs once, it needs no register.
+    PQ_VAR_TEMP, //occurs in one chunk, it is kept in an X register.
+    PQ_VAR_PERM //occurs in more than one chunk, it is kept in a Y register.
+} pq_compile_var_kind;
+
+/**
+ * @brief A variable of the clause that is being compiled.
+ */
+typedef struct pq_compile_var
+{
+    pq_term* cell; //the variable cell, it is marked with the index of the variable while the clause is compiled.
+    uint32_t total; //the number of occurrences in the clause as it was written.
+    uint32_t inner; //the number of occurrences in the control construct that is moved into an auxiliary predicate.
+    uint32_t occurrences; //the number of occurrences in the head and the goals.
+    uint32_t first_chunk;
+    uint32_t last_chunk;
+    int32_t max_arg; //the highest argument of the first call that the variable occurs in, -1 if it does not occur in it.
+    uint32_t reg; //the X or Y register.
+    uint8_t kind; //the pq_compile_var_kind of the variable.
+    PQbool seen; //whether an instruction for the variable was emitted.
+    PQbool in_call; //whether the variable is an argument of a call.
+} pq_compile_var;
+
+/**
+ * @brief The kinds of goals in the body of a clause.
+ */
+typedef enum pq_compile_goal_kind
+{
+    PQ_GOAL_CALL, //calls a predicate.
+    PQ_GOAL_GET_LEVEL, //stores the choice point of the call in a variable.
+    PQ_GOAL_CUT, //cuts to the choice point in a variable.
+    PQ_GOAL_FAIL
+} pq_compile_goal_kind;
+
+/**
+ * @brief A goal in the body of a clause.
+ */
+typedef struct pq_compile_goal
+{
+    pq_term term; //the goal of a call, the variable of a cut.
+    uint32_t chunk; //the chunk of the goal.
+    uint32_t live; //the number of permanent variables that are used after a call, the environment is trimmed to them.
+    uint8_t kind; //the pq_compile_goal_kind of the goal.
+} pq_compile_goal;
+
+/**
+ * @brief A clause of an auxiliary predicate that is waiting to be compiled.
+ */
+typedef struct pq_compile_aux
+{
+    pq_term clause;
+    pq_term cut_var; //the head argument that holds the choice point of the parent clause, a cut cuts to it. PQ_TERM_NONE if there is none.
+} pq_compile_aux;
+
+/**
+ * @brief An unfinished structure while the arguments of a head or a call are compiled.
+ */
+typedef struct pq_compile_struct
+{
+    pq_term term;
+    uint32_t next; //the next argument to build (a call), or the register that holds the structure (a head).
+} pq_compile_struct;
+
+/**
+ * @brief The structure of a poqer-lang compiler.
+ */
+typedef struct pq_compiler
+{   //these variables should only be read externally, not modified.
+
+    pq_database* db; //the database that the clauses are added to.
+    pq_arena* arena; //the terms that are created by the compiler (e.g. auxiliary clauses), deallocated after each clause.
+
+    //the code of the clause that is being compiled.
+    pq_code* code;
+    size_t code_sz;
+    size_t code_cap;
+    size_t void_at; //the index of the last unify_void instruction, it is extended by the next void variable if nothing was emitted after it.
+
+    //the variables of the clause.
+    pq_compile_var* vars;
+    size_t vars_sz;
+    size_t vars_cap;
+
+    //the goals of the body.
+    pq_compile_goal* goals;
+    size_t goals_sz;
+    size_t goals_cap;
+
+    //the auxiliary clauses that are waiting to be compiled.
+    pq_compile_aux* aux;
+    size_t aux_sz;
+    size_t aux_cap;
+    uint32_t aux_count; //the number of auxiliary predicates, it names the next one.
+
+    //the scratch memory, the terms are walked without recursion.
+    pq_term* work;
+    size_t work_cap;
+    pq_term* pending; //the goals of the body that are waiting to be flattened.
+    size_t pending_cap;
+    pq_compile_struct* structs;
+    size_t structs_cap;
+    uint32_t* regs; //the registers of the finished structures of a call.
+    size_t regs_cap;
+    uint32_t* free_regs; //the registers that can be reused.
+    size_t free_regs_sz;
+    size_t free_regs_cap;
+    uint32_t next_reg; //the lowest register that was never used by the chunk.
+
+    char* err;
+} pq_compiler;
+
+/**
+ * @brief Safe allocation for a pq_compiler struct, initializes the compiler, then returns the pointer.
+ *
+ * @param db The database that the clauses are added to.
+ * @return A pointer to the allocated pq_compiler struct.
+ */
+pq_compiler* pq_new_compiler(pq_database* db);
+
+/**
+ * @brief Safe deallocation of a pq_compiler struct, the database is not deallocated.
+ *
+ * @param compiler The compiler that will be deallocated.
+ */
+void pq_del_compiler(pq_compiler* compiler);
+
+/**
+ * @brief Compiles a clause and appends it to its predicate.
+ * The variable cells of the clause are marked while it is compiled, they are restored before returning.
+ * Upon failure, the error is stored in the compiler.
+ *
+ * @param compiler The compiler that will be used.
+ * @param clause The clause term, Head :- Body or a fact.
+ * @return PQ_SUCCESS if the clause was added else PQ_FAILURE.
+ */
+int pq_compiler_add_clause(pq_compiler* compiler, const pq_term clause);
+
+/**
+ * @brief Compiles a query into the only clause of a query predicate, the clause is Name(V1, ..., VN) :- Goal.
+ * Upon failure, the error is stored in the compiler.
+ *
+ * @param compiler The compiler that will be used.
+ * @param name The name of the query predicate (e.g. '$query'), its previous clause is retired.
+ * @param goal The goal of the query.
+ * @param vars The variables of the query that are read after it succeeds.
+ * @param vars_sz The number of variables.
+ * @return The query predicate, NULL if the query could not be compiled.
+ */
+pq_pred* pq_compiler_add_query(pq_compiler* compiler, const pq_atom name, const pq_term goal, const pq_term* vars, const uint32_t vars_sz);
+
+#endif
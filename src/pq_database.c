@@ -0,0 +1,914 @@
+/**
+ * @file pq_database.c
+ * @author Brandon Foster
+ * @brief poqer-lang clause database implementation.
+ *
+ * @version 0.001
+ * @date 10-16-2026
+ * @copyright Brandon Foster (c) 2020-2021
+ */
+
+#include "pq_database.h"
+
+#define PQ_DATABASE_INIT_SIZE 256
+
+/**
+ * @brief Gets the index of the first slot to probe for a predicate.
+ *
+ * @param db The database that will be used.
+ * @param name The name of the predicate.
+ * @param arity The arity of the predicate.
+ * @return The index of the slot.
+ */
+static inline uint32_t pq_database_hash(const pq_database* db, const pq_atom name, const uint32_t arity)
+{
+    //atom ids are dense, multiplicative hashing spreads them across the slots.
+    return ((name * 2654435761u) ^ (arity * 40503u)) & db->slot_mask;
+}
+
+/**
+ * @brief Doubles the number of slots and reinserts every predicate.
+ *
+ * @param db The database that will be modified.
+ * @return PQ_SUCCESS if the slots were reallocated else PQ_FAILURE.
+ */
+static int pq_database_grow(pq_database* db)
+{
+    const uint32_t old_size = db->slot_mask + 1;
+    const uint32_t size = old_size << 1;
+    pq_pred** old_preds = db->preds;
+    pq_pred** preds = (pq_pred**)calloc(size, sizeof(pq_pred*));
+    if(!preds) return PQ_FAILURE;
+
+    db->preds = preds;
+    db->slot_mask = size - 1;
+    for(uint32_t i = 0; i < old_size; ++i)
+    {
+        if(!old_preds[i]) continue;
+        uint32_t j = pq_database_hash(db, old_preds[i]->name, old_preds[i]->arity);
+        while(preds[j]) j = (j + 1) & db->slot_mask;
+        preds[j] = old_preds[i];
+    }
+    free(old_preds);
+    return PQ_SUCCESS;
+}
+
+pq_database* pq_new_database(void)
+{
+    pq_database* db = (pq_database*)malloc(sizeof(pq_database));
+    if(!db) return NULL;
+
+    db->preds = (pq_pred**)calloc(PQ_DATABASE_INIT_SIZE, sizeof(pq_pred*));
+    db->arena = pq_new_arena(0);
+    if(!db->preds || !db->arena)
+    {
+        free(db->preds);
+        pq_del_arena(db->arena);
+        free(db);
+        return NULL;
+    }
+    db->count = 0;
+    db->slot_mask = PQ_DATABASE_INIT_SIZE - 1;
+    db->retired = NULL;
+    db->retired_sz = 0;
+    db->retired_cap = 0;
+    return db;
+}
+
+void pq_del_database(pq_database* db)
+{
+    if(!db) return;
+
+    for(uint32_t i = 0; i <= db->slot_mask; ++i)
+    {
+        pq_pred* pred = db->preds[i];
+        if(!pred) continue;
+        for(uint32_t j = 0; j < pred->clauses_sz; ++j) free(pred->clauses[j].code);
+        free(pred->clauses);
+        free(pred->entry_block);
+        if(pred->jit)
+        {
+            for(size_t j = 0; j < pred->jit->indexes_sz; ++j) free(pred->jit->indexes[j].block);
+            free(pred->jit->rejected);
+            free(pred->jit->indexes);
+            free(pred->jit);
+        }
+    }
+    free(db->preds);
+    pq_database_free_retired(db);
+    free(db->retired);
+    pq_del_arena(db->arena);
+    free(db);
+}
+
+pq_pred* pq_database_lookup(const pq_database* db, const pq_atom name, const uint32_t arity)
+{
+    uint32_t i = pq_database_hash(db, name, arity);
+    for(;;)
+    {   //linear probing, the slots are never more than half full so an empty slot is always found.
+        pq_pred* pred = db->preds[i];
+        if(!pred) return NULL;
+        if(pred->name == name && pred->arity == arity) return pred;
+        i = (i + 1) & db->slot_mask;
+    }
+}
+
+pq_pred* pq_database_get_pred(pq_database* db, const pq_atom name, const uint32_t arity)
+{
+    pq_pred* pred = pq_database_lookup(db, name, arity);
+    if(pred) return pred;
+
+    if(db->count + 1 > (db->slot_mask + 1) >> 1 && pq_database_grow(db) != PQ_SUCCESS) return NULL;
+    pred = (pq_pred*)pq_arena_alloc(db->arena, sizeof(pq_pred));
+    if(!pred) return NULL;
+    pred->name = name;
+    pred->arity = arity;
+    pred->clauses = NULL;
+    pred->clauses_sz = 0;
+    pred->clauses_cap = 0;
+    pred->entry = NULL;
+    pred->entry_block = NULL;
+    pred->entry_sz = 0;
+    pred->jit = NULL;
+    pred->builtin = NULL;
+    pred->consult = 0;
+    pred->tabled = NULL;
+    pred->dirty = PQ_FALSE;
+
+    uint32_t i = pq_database_hash(db, name, arity);
+    while(db->preds[i]) i = (i + 1) & db->slot_mask;
+    db->preds[i] = pred;
+    db->count++;
+    return pred;
+}
+
+int pq_database_add_clause(pq_pred* pred, const pq_code* code, const size_t size)
+{
+    if(pred->clauses_sz == pred->clauses_cap)
+    {   //doubles the clauses.
+        const uint32_t cap = pred->clauses_cap ? pred->clauses_cap << 1 : 4;
+        pq_clause* clauses = (pq_clause*)realloc(pred->clauses, cap * sizeof(pq_clause));
+        if(!clauses) return PQ_FAILURE;
+        pred->clauses = clauses;
+        pred->clauses_cap = cap;
+    }
+
+    pq_code* copy = (pq_code*)malloc(size * sizeof(pq_code));
+    if(!copy) return PQ_FAILURE;
+    memcpy(copy, code, size * sizeof(pq_code));
+
+    pq_clause* clause = &pred->clauses[pred->clauses_sz++];
+    clause->code = copy;
+    clause->size = (uint32_t)size;
+    pred->dirty = PQ_TRUE;
+    return PQ_SUCCESS;
+}
+
+/**
+ * @brief Retires code that can still be running.
+ *
+ * @param db The database that will be modified.
+ * @param code The code.
+ * @return PQ_SUCCESS if the code was retired else PQ_FAILURE.
+ */
+static int pq_database_retire(pq_database* db, pq_code* code)
+{
+    if(pq_array_reserve((void**)&db->retired, &db->retired_cap, db->retired_sz + 1, sizeof(pq_code*)) != PQ_SUCCESS)
+        return PQ_FAILURE;
+    db->retired[db->retired_sz++] = code;
+    return PQ_SUCCESS;
+}
+
+/**
+ * @brief Drops the jit indexes of a predicate and its statistics, the code of the indexes is retired.
+ *
+ * @param db The database of the predicate.
+ * @param pred The predicate that will be modified.
+ * @return PQ_SUCCESS if the indexes were dropped else PQ_FAILURE.
+ */
+static int pq_database_jit_drop(pq_database* db, pq_pred* pred)
+{
+    pq_jit* jit = pred->jit;
+    if(!jit) return PQ_SUCCESS;
+    if(pq_array_reserve((void**)&db->retired, &db->retired_cap, db->retired_sz + jit->indexes_sz, sizeof(pq_code*)) != PQ_SUCCESS)
+        return PQ_FAILURE;
+    for(size_t i = 0; i < jit->indexes_sz; ++i) pq_database_retire(db, jit->indexes[i].block);
+    free(jit->rejected);
+    free(jit->indexes);
+    free(jit);
+    pred->jit = NULL;
+    return PQ_SUCCESS;
+}
+
+int pq_database_clear_pred(pq_database* db, pq_pred* pred)
+{
+    if(pq_database_jit_drop(db, pred) != PQ_SUCCESS) return PQ_FAILURE;
+    if(pq_array_reserve((void**)&db->retired, &db->retired_cap, db->retired_sz + pred->clauses_sz + 1, sizeof(pq_code*)) != PQ_SUCCESS)
+        return PQ_FAILURE;
+    for(uint32_t i = 0; i < pred->clauses_sz; ++i) pq_database_retire(db, pred->clauses[i].code);
+    if(pred->entry_block) pq_database_retire(db, pred->entry_block);
+    pred->clauses_sz = 0;
+    pred->entry_block = NULL;
+    pred->entry_sz = 0;
+    pred->entry = NULL;
+    pred->dirty = PQ_FALSE;
+    return PQ_SUCCESS;
+}
+
+int pq_database_move_clauses(pq_database* db, pq_pred* from, pq_pred* to)
+{
+    if(pq_database_clear_pred(db, to) != PQ_SUCCESS || pq_database_jit_drop(db, from) != PQ_SUCCESS) return PQ_FAILURE;
+    if(from->entry_block && pq_database_retire(db, from->entry_block) != PQ_SUCCESS) return PQ_FAILURE;
+
+    //the clause arrays are swapped, so from keeps the empty array of to.
+    pq_clause* clauses = to->clauses;
+    const uint32_t clauses_cap = to->clauses_cap;
+    to->clauses = from->clauses;
+    to->clauses_sz = from->clauses_sz;
+    to->clauses_cap = from->clauses_cap;
+    to->consult = from->consult;
+    to->dirty = to->clauses_sz != 0;
+    from->clauses = clauses;
+    from->clauses_sz = 0;
+    from->clauses_cap = clauses_cap;
+    from->entry_block = NULL;
+    from->entry_sz = 0;
+    from->entry = NULL;
+    from->dirty = PQ_FALSE;
+    return PQ_SUCCESS;
+}
+
+void pq_database_free_retired(pq_database* db)
+{
+    for(size_t i = 0; i < db->retired_sz; ++i) free(db->retired[i]);
+    db->retired_sz = 0;
+}
+
+//the key of a clause argument that matches every call, the argument is a variable.
+#define PQ_DATABASE_KEY_ANY PQ_TERM_NONE
+
+//the key of a list argument.
+#define PQ_DATABASE_KEY_LIST ((pq_term)PQ_TAG_LIST)
+
+//the key of a boxed constant argument (e.g. a float), it is compared by value so it is not hashed.
+#define PQ_DATABASE_KEY_BOX ((pq_term)PQ_TAG_BOX)
+
+//the predicates with fewer clauses are not worth the jit indexes.
+#define PQ_DATABASE_JIT_MIN_CLAUSES 8
+
+//the number of calls that must bind an argument before an index is built on it.
+#define PQ_DATABASE_JIT_MIN_CALLS 4
+
+//the calls between the reviews of the jit indexes, an index that was not used since the last review is dropped.
+#define PQ_DATABASE_JIT_REVIEW_CALLS 65536
+
+//an index is selective if a call with a key tries at most 1/4 of the clauses on average.
+#define PQ_DATABASE_MIN_SPEEDUP 4
+
+/**
+ * @brief The clauses of a predicate that have the same key, they are stored together in the order array of the index.
+ */
+typedef struct pq_index_group
+{
+    pq_term key; //the key of the clauses.
+    uint32_t start; //the index of the first clause of the group in the order array.
+    uint32_t count; //the number of clauses of the group.
+} pq_index_group;
+
+/**
+ * @brief Gets the key of a clause argument from the head instruction that reads its argument register.
+ * The temporary registers of the head are above the arguments, so an argument register is only read by the instruction of its argument.
+ *
+ * @param clause The clause.
+ * @param arg The index of the argument.
+ * @return The atom or small integer cell, the functor cell, PQ_DATABASE_KEY_LIST, PQ_DATABASE_KEY_BOX or PQ_DATABASE_KEY_ANY.
+ */
+static pq_term pq_database_clause_key(const pq_clause* clause, const uint32_t arg)
+{
+    for(const pq_code* code = clause->code;; code += pq_wam_sizes[pq_wam_get_op(*code)])
+    {
+        switch(pq_wam_get_op(*code))
+        {
+        case PQ_WAM_GET_VARIABLE_X:
+        case PQ_WAM_GET_VARIABLE_Y:
+        case PQ_WAM_GET_VALUE_X:
+        case PQ_WAM_GET_VALUE_Y:
+            if(pq_wam_get_b(*code) == arg) return PQ_DATABASE_KEY_ANY;
+            break;
+        case PQ_WAM_GET_CONSTANT:
+            if(pq_wam_get_a(*code) == arg) return pq_term_get_tag(code[1]) == PQ_TAG_BOX ? PQ_DATABASE_KEY_BOX : code[1];
+            break;
+        case PQ_WAM_GET_NIL:
+            if(pq_wam_get_a(*code) == arg) return pq_new_atom_term(PQ_ATOM_NIL);
+            break;
+        case PQ_WAM_GET_STRUCTURE:
+            if(pq_wam_get_a(*code) == arg) return code[1];
+            break;
+        case PQ_WAM_GET_LIST:
+        case PQ_WAM_GET_LIST_X_X:
+            if(pq_wam_get_a(*code) == arg) return PQ_DATABASE_KEY_LIST;
+            break;
+        case PQ_WAM_ALLOCATE:
+        case PQ_WAM_UNIFY_VARIABLE_X:
+        case PQ_WAM_UNIFY_VARIABLE_Y:
+        case PQ_WAM_UNIFY_VALUE_X:
+        case PQ_WAM_UNIFY_VALUE_Y:
+        case PQ_WAM_UNIFY_CONSTANT:
+        case PQ_WAM_UNIFY_NIL:
+        case PQ_WAM_UNIFY_VOID:
+        case PQ_WAM_UNIFY_VARIABLE_X_X:
+        case PQ_WAM_UNIFY_VALUE_VARIABLE_X:
+            break;
+        default:
+            //the head ended without reading the argument, it is a variable that stays in its register.
+            return PQ_DATABASE_KEY_ANY;
+        }
+    }
+}
+
+/**
+ * @brief Gets the key of a call argument.
+ *
+ * @param arg The argument.
+ * @return The atom or small integer cell, the functor cell, PQ_DATABASE_KEY_LIST, else PQ_DATABASE_KEY_ANY if it cannot be hashed.
+ */
+static inline pq_term pq_database_call_key(pq_term arg)
+{
+    arg = pq_term_deref(arg);
+    switch(pq_term_get_tag(arg))
+    {
+    case PQ_TAG_ATOM:
+    case PQ_TAG_INT:
+        return arg;
+    case PQ_TAG_LIST:
+        return PQ_DATABASE_KEY_LIST;
+    case PQ_TAG_STR:
+        return *pq_term_get_ptr(arg);
+    default:
+        return PQ_DATABASE_KEY_ANY;
+    }
+}
+
+/**
+ * @brief Combines the key of an argument into the key of a set of arguments.
+ *
+ * @param hash The key of the previous arguments, 0 for the first one.
+ * @param key The key of the argument.
+ * @return The combined key, two sets of keys can collide so an index only narrows the clauses that are tried.
+ */
+static inline pq_term pq_database_mix_key(const pq_term hash, const pq_term key)
+{
+    const pq_term mixed = (hash ^ key) * UINT64_C(0x9E3779B97F4A7C15);
+    return mixed ^ mixed >> 29;
+}
+
+/**
+ * @brief Gets the key of a set of arguments of a clause.
+ *
+ * @param clause The clause.
+ * @param args The arguments.
+ * @return The combined key, never 0, else PQ_DATABASE_KEY_ANY if an argument cannot be hashed.
+ */
+static pq_term pq_database_clause_args_key(const pq_clause* clause, const uint32_t args)
+{
+    pq_term hash = 0;
+    for(uint32_t i = 0; i < PQ_JIT_MAX_ARGS; ++i)
+    {
+        if(!(args >> i & 1)) continue;
+        const pq_term key = pq_database_clause_key(clause, i);
+        if(key == PQ_DATABASE_KEY_ANY || key == PQ_DATABASE_KEY_BOX) return PQ_DATABASE_KEY_ANY;
+        hash = pq_database_mix_key(hash, key);
+    }
+    return hash ? hash : 1;
+}
+
+/**
+ * @brief Gets the key of a set of arguments of a call, they are bound.
+ *
+ * @param call The argument registers.
+ * @param args The arguments.
+ * @return The combined key, never 0.
+ */
+static pq_term pq_database_call_args_key(const pq_term* call, const uint32_t args)
+{
+    pq_term hash = 0;
+    for(uint32_t i = 0; i < PQ_JIT_MAX_ARGS; ++i)
+        if(args >> i & 1) hash = pq_database_mix_key(hash, pq_database_call_key(call[i]));
+    return hash ? hash : 1;
+}
+
+/**
+ * @brief Groups the clauses by key, each group keeps the order of its clauses.
+ *
+ * @param keys The key of each clause.
+ * @param n The number of clauses.
+ * @param order The indexes of the clauses: first the ones with PQ_DATABASE_KEY_ANY, then the groups.
+ * @param groups The groups, there are at most n.
+ * @param groups_sz The number of groups.
+ * @param any_sz The number of clauses with PQ_DATABASE_KEY_ANY.
+ * @return PQ_SUCCESS if the clauses were grouped else PQ_FAILURE.
+ */
+static int pq_database_group(const pq_term* keys, const uint32_t n, uint32_t* order, pq_index_group* groups,
+    uint32_t* groups_sz, uint32_t* any_sz)
+{
+    //a temporary hash table finds the group of a key, a slot holds the index of a group plus 1.
+    size_t mask = 1;
+    while(mask < 2 * (size_t)n) mask = mask << 1 | 1;
+    uint32_t* slots = (uint32_t*)calloc(mask + 1, sizeof(uint32_t));
+    if(!slots) return PQ_FAILURE;
+
+    *groups_sz = 0;
+    *any_sz = 0;
+    for(uint32_t i = 0; i < n; ++i)
+    {
+        if(keys[i] == PQ_DATABASE_KEY_ANY)
+        {
+            (*any_sz)++;
+            continue;
+        }
+        size_t j = pq_wam_switch_hash(keys[i]) & mask;
+        while(slots[j] && groups[slots[j] - 1].key != keys[i]) j = (j + 1) & mask;
+        if(!slots[j])
+        {
+            groups[*groups_sz].key = keys[i];
+            groups[*groups_sz].count = 0;
+            slots[j] = ++*groups_sz;
+        }
+        groups[slots[j] - 1].count++;
+    }
+
+    uint32_t start = *any_sz;
+    for(uint32_t g = 0; g < *groups_sz; ++g)
+    {
+        groups[g].start = start;
+        start += groups[g].count;
+        groups[g].count = 0;
+    }
+    uint32_t any_at = 0;
+    for(uint32_t i = 0; i < n; ++i)
+    {
+        if(keys[i] == PQ_DATABASE_KEY_ANY)
+        {
+            order[any_at++] = i;
+            continue;
+        }
+        size_t j = pq_wam_switch_hash(keys[i]) & mask;
+        while(groups[slots[j] - 1].key != keys[i]) j = (j + 1) & mask;
+        pq_index_group* group = &groups[slots[j] - 1];
+        order[group->start + group->count++] = i;
+    }
+    free(slots);
+    return PQ_SUCCESS;
+}
+
+/**
+ * @brief Gets whether the keys of an index narrow the clauses that a call tries.
+ *
+ * @param n The number of clauses.
+ * @param any_sz The number of clauses that match every key.
+ * @param keys The number of distinct keys of the other clauses.
+ * @return PQ_TRUE if a call with a key tries at most 1/PQ_DATABASE_MIN_SPEEDUP of the clauses on average.
+ */
+static inline PQbool pq_database_is_selective(const uint32_t n, const uint32_t any_sz, const uint32_t keys)
+{
+    return keys && ((uint64_t)(n - any_sz) / keys + any_sz) * PQ_DATABASE_MIN_SPEEDUP <= n;
+}
+
+/**
+ * @brief Gets the number of words of the code that runs some clauses in order.
+ *
+ * @param count The number of clauses.
+ * @return The number of words, a single clause is run without a choice point so it needs none.
+ */
+static inline size_t pq_database_chain_size(const uint32_t count)
+{
+    return count > 1 ? 2 * (size_t)count : 0;
+}
+
+/**
+ * @brief Writes the code that runs some clauses in order: try the first clause, retry the middle ones, and trust the last one.
+ *
+ * @param pred The predicate of the clauses.
+ * @param indexes The indexes of the clauses in the order they are run.
+ * @param count The number of clauses.
+ * @param at The free code, it is advanced past the written words.
+ * @return The code that runs the clauses, the code of the clause if there is only one, NULL if there are none.
+ */
+static pq_code* pq_database_emit_chain(const pq_pred* pred, const uint32_t* indexes, const uint32_t count, pq_code** at)
+{
+    if(!count) return NULL;
+    if(count == 1) return pred->clauses[indexes[0]].code;
+
+    pq_code* code = *at;
+    for(uint32_t i = 0; i < count; ++i)
+    {
+        const pq_wam_opcode op = i == 0 ? PQ_WAM_TRY : i + 1 == count ? PQ_WAM_TRUST : PQ_WAM_RETRY;
+        code[2 * i] = pq_wam_make(op, pred->arity, 0);
+        code[2 * i + 1] = pq_wam_make_ptr(pred->clauses[indexes[i]].code);
+    }
+    *at += 2 * (size_t)count;
+    return code;
+}
+
+/**
+ * @brief Writes the code that runs the clauses of a group and the clauses that match every key, keeping the order of the clauses.
+ *
+ * @param pred The predicate of the clauses.
+ * @param group The indexes of the group.
+ * @param group_sz The number of indexes in group.
+ * @param any The indexes of the clauses that match every key.
+ * @param any_sz The number of indexes in any.
+ * @param merged The scratch memory for the merged indexes.
+ * @param at The free code, it is advanced past the written words.
+ * @return The code that runs the clauses (see pq_database_emit_chain).
+ */
+static pq_code* pq_database_emit_group(const pq_pred* pred, const uint32_t* group, const uint32_t group_sz,
+    const uint32_t* any, const uint32_t any_sz, uint32_t* merged, pq_code** at)
+{
+    uint32_t i = 0, j = 0, k = 0;
+    while(i < group_sz && j < any_sz) merged[k++] = group[i] < any[j] ? group[i++] : any[j++];
+    while(i < group_sz) merged[k++] = group[i++];
+    while(j < any_sz) merged[k++] = any[j++];
+    return pq_database_emit_chain(pred, merged, k, at);
+}
+
+/**
+ * @brief Gets the number of slots of a switch table.
+ *
+ * @param keys The number of keys.
+ * @return The number of slots, a power of 2 that is at most 3/4 full.
+ */
+static inline size_t pq_database_switch_slots(const uint32_t keys)
+{
+    size_t slots = 2;
+    while(slots * 3 < (size_t)keys * 4) slots <<= 1;
+    return slots;
+}
+
+/**
+ * @brief Writes an empty switch table.
+ *
+ * @param table The table.
+ * @param slots The number of slots.
+ * @param fallback The code of a key that is not in the table.
+ */
+static void pq_database_init_switch(pq_code* table, const size_t slots, const pq_code* fallback)
+{
+    table[0] = slots - 1;
+    table[1] = pq_wam_make_ptr(fallback);
+    memset(table + 2, 0, 2 * slots * sizeof(pq_code));
+}
+
+/**
+ * @brief Adds a key to a switch table.
+ *
+ * @param table The table.
+ * @param key The key, it is not in the table.
+ * @param code The code of the key.
+ */
+static void pq_database_add_switch(pq_code* table, const pq_term key, const pq_code* code)
+{
+    pq_code i = pq_wam_switch_hash(key) & table[0];
+    while(table[2 + 2 * i]) i = (i + 1) & table[0];
+    table[2 + 2 * i] = key;
+    table[3 + 2 * i] = pq_wam_make_ptr(code);
+}
+
+/**
+ * @brief The scratch memory to build an index of a predicate.
+ */
+typedef struct pq_index_scratch
+{
+    pq_term* keys; //the key of each clause.
+    uint32_t* order; //the indexes of the clauses grouped by key (see pq_database_group).
+    uint32_t* merged; //the indexes of the clauses of a chain.
+    pq_index_group* groups;
+} pq_index_scratch;
+
+/**
+ * @brief Allocates the scratch memory to build an index.
+ *
+ * @param scratch The scratch memory that will be allocated.
+ * @param n The number of clauses.
+ * @return PQ_SUCCESS if the memory was allocated else PQ_FAILURE, the memory must still be deallocated.
+ */
+static int pq_database_new_scratch(pq_index_scratch* scratch, const uint32_t n)
+{
+    scratch->keys = (pq_term*)malloc(n * sizeof(pq_term));
+    scratch->order = (uint32_t*)malloc(n * sizeof(uint32_t));
+    scratch->merged = (uint32_t*)malloc(n * sizeof(uint32_t));
+    scratch->groups = (pq_index_group*)malloc(n * sizeof(pq_index_group));
+    return scratch->keys && scratch->order && scratch->merged && scratch->groups ? PQ_SUCCESS : PQ_FAILURE;
+}
+
+static void pq_database_del_scratch(pq_index_scratch* scratch)
+{
+    free(scratch->keys);
+    free(scratch->order);
+    free(scratch->merged);
+    free(scratch->groups);
+}
+
+/**
+ * @brief Builds the entry of a predicate with the first argument index.
+ * switch_on_term selects the code by the type of A0, then switch_on_constant or switch_on_structure finds the clauses of its key in a hash table.
+ * The code of each key runs the clauses of the key and the clauses that match every call, in their order,
+ * a key with a single clause jumps to it without a choice point.
+ *
+ * @param pred The predicate, it has more than one clause.
+ * @param reserved The number of words that are reserved before the index.
+ * @param block The allocated entry, NULL if no clause has a first argument key (every clause matches every call).
+ * @param size The number of words in block.
+ * @param selective Whether a call with a first argument key tries few clauses (see pq_database_is_selective).
+ * @return PQ_SUCCESS if the index was built or not needed else PQ_FAILURE.
+ */
+static int pq_database_build_index(const pq_pred* pred, const size_t reserved, pq_code** block, size_t* size, PQbool* selective)
+{
+    *block = NULL;
+    *selective = PQ_FALSE;
+    const uint32_t n = pred->clauses_sz;
+    pq_index_scratch scratch;
+    int status = PQ_FAILURE;
+    uint32_t groups_sz, any_sz;
+    if(pq_database_new_scratch(&scratch, n) != PQ_SUCCESS) goto clean_up;
+    for(uint32_t i = 0; i < n; ++i) scratch.keys[i] = pq_database_clause_key(&pred->clauses[i], 0);
+    if(pq_database_group(scratch.keys, n, scratch.order, scratch.groups, &groups_sz, &any_sz) != PQ_SUCCESS) goto clean_up;
+    if(any_sz == n)
+    {
+        status = PQ_SUCCESS;
+        goto clean_up;
+    }
+    *selective = pq_database_is_selective(n, any_sz, groups_sz);
+
+    //the boxed constants and the lists are not hashed, the other groups are constants or functors.
+    const pq_index_group* box = NULL;
+    const pq_index_group* list = NULL;
+    uint32_t constants = 0, functors = 0;
+    for(uint32_t g = 0; g < groups_sz; ++g)
+    {
+        const pq_term key = scratch.groups[g].key;
+        if(key == PQ_DATABASE_KEY_BOX) box = &scratch.groups[g];
+        else if(key == PQ_DATABASE_KEY_LIST) list = &scratch.groups[g];
+        else if(pq_term_get_tag(key) == PQ_TAG_FUNCTOR) functors++;
+        else constants++;
+    }
+
+    //switch_on_term, the chain of every clause, the chains of the clauses that match every call and every constant,
+    //the list chain, switch_on_constant and its table, switch_on_structure and its table, then the chains of the groups.
+    const size_t table_slots[2] = {pq_database_switch_slots(constants), pq_database_switch_slots(functors)};
+    const uint32_t keys_sz[2] = {constants, functors};
+    *size = reserved + 5 + pq_database_chain_size(n) + pq_database_chain_size(any_sz)
+        + pq_database_chain_size(any_sz + (box ? box->count : 0)) + pq_database_chain_size(any_sz + (list ? list->count : 0));
+    for(int k = 0; k < 2; ++k) if(keys_sz[k]) *size += 4 + 2 * table_slots[k];
+    for(uint32_t g = 0; g < groups_sz; ++g) *size += pq_database_chain_size(scratch.groups[g].count + any_sz);
+
+    pq_code* code = (pq_code*)malloc(*size * sizeof(pq_code));
+    if(!code) goto clean_up;
+    pq_code* const entry = code + reserved;
+    pq_code* at = entry + 5;
+
+    for(uint32_t i = 0; i < n; ++i) scratch.merged[i] = i;
+    const uint32_t* any = scratch.order;
+    pq_code* const every = pq_database_emit_chain(pred, scratch.merged, n, &at);
+    pq_code* const any_code = pq_database_emit_chain(pred, any, any_sz, &at);
+    pq_code* const box_code = !box ? any_code
+        : pq_database_emit_group(pred, scratch.order + box->start, box->count, any, any_sz, scratch.merged, &at);
+    pq_code* const list_code = !list ? any_code
+        : pq_database_emit_group(pred, scratch.order + list->start, list->count, any, any_sz, scratch.merged, &at);
+
+    pq_code* tables[2] = {NULL, NULL}; //the constant and functor tables.
+    pq_code* switches[2] = {box_code, any_code}; //the code of a constant and of a structure A0.
+    for(int k = 0; k < 2; ++k)
+    {
+        if(!keys_sz[k]) continue;
+        at[0] = pq_wam_make(k ? PQ_WAM_SWITCH_ON_STRUCTURE : PQ_WAM_SWITCH_ON_CONSTANT, 0, 0);
+        at[1] = pq_wam_make_ptr(at + 2);
+        tables[k] = at + 2;
+        pq_database_init_switch(tables[k], table_slots[k], switches[k]); //a key that is not in the table.
+        switches[k] = at;
+        at += 4 + 2 * table_slots[k];
+    }
+    for(uint32_t g = 0; g < groups_sz; ++g)
+    {
+        const pq_index_group* group = &scratch.groups[g];
+        if(group == box || group == list) continue;
+        pq_database_add_switch(tables[pq_term_get_tag(group->key) == PQ_TAG_FUNCTOR], group->key,
+            pq_database_emit_group(pred, scratch.order + group->start, group->count, any, any_sz, scratch.merged, &at));
+    }
+
+    entry[0] = pq_wam_make(PQ_WAM_SWITCH_ON_TERM, 0, 0);
+    entry[1] = pq_wam_make_ptr(every);
+    entry[2] = pq_wam_make_ptr(switches[0]);
+    entry[3] = pq_wam_make_ptr(list_code);
+    entry[4] = pq_wam_make_ptr(switches[1]);
+    *block = code;
+    status = PQ_SUCCESS;
+
+clean_up:
+    pq_database_del_scratch(&scratch);
+    return status;
+}
+
+int pq_database_build_entry(pq_database* db, pq_pred* pred)
+{
+    //the jit indexes and a choice point can still point into the old code.
+    if(pq_database_jit_drop(db, pred) != PQ_SUCCESS) return PQ_FAILURE;
+    if(pred->entry_block && pq_database_retire(db, pred->entry_block) != PQ_SUCCESS) return PQ_FAILURE;
+    pred->entry_block = NULL;
+    pred->entry_sz = 0;
+    pred->entry = NULL;
+
+    if(pred->clauses_sz == 1) pred->entry = pred->clauses[0].code;
+    else if(pred->clauses_sz > 1)
+    {   //a large predicate starts with switch_on_args, the calls that the first argument cannot narrow use the jit indexes.
+        const size_t reserved = pred->arity > 1 && pred->clauses_sz >= PQ_DATABASE_JIT_MIN_CLAUSES ? 2 : 0;
+        pq_code* code = NULL;
+        size_t size = 0;
+        PQbool selective = PQ_FALSE;
+        if(pred->arity && pq_database_build_index(pred, reserved, &code, &size, &selective) != PQ_SUCCESS) return PQ_FAILURE;
+        if(!code)
+        {   //no clause can be skipped, try the first clause, retry the middle ones, and trust the last one.
+            size = reserved + 2 * (size_t)pred->clauses_sz;
+            code = (pq_code*)malloc(size * sizeof(pq_code));
+            if(!code) return PQ_FAILURE;
+            pq_code* at = code + reserved;
+            for(uint32_t i = 0; i < pred->clauses_sz; ++i)
+            {
+                const pq_wam_opcode op = i == 0 ? PQ_WAM_TRY : i + 1 == pred->clauses_sz ? PQ_WAM_TRUST : PQ_WAM_RETRY;
+                *at++ = pq_wam_make(op, pred->arity, 0);
+                *at++ = pq_wam_make_ptr(pred->clauses[i].code);
+            }
+        }
+        if(reserved)
+        {
+            code[0] = pq_wam_make(PQ_WAM_SWITCH_ON_ARGS, selective, 0);
+            code[1] = pq_wam_make_ptr(pred);
+        }
+        pred->entry = pred->entry_block = code;
+        pred->entry_sz = size;
+    }
+    pred->dirty = PQ_FALSE;
+    return PQ_SUCCESS;
+}
+
+/**
+ * @brief Builds a jit index on a set of arguments, if their keys are selective.
+ *
+ * @param pred The predicate, it has more than one clause.
+ * @param args The arguments.
+ * @param index The index that will be initialized.
+ * @param selective Whether the keys are selective, the index is only built if they are.
+ * @return PQ_SUCCESS if the index was built or the keys are not selective else PQ_FAILURE.
+ */
+static int pq_database_jit_build(const pq_pred* pred, const uint32_t args, pq_jit_index* index, PQbool* selective)
+{
+    *selective = PQ_FALSE;
+    const uint32_t n = pred->clauses_sz;
+    pq_index_scratch scratch;
+    int status = PQ_FAILURE;
+    uint32_t groups_sz, any_sz;
+    if(pq_database_new_scratch(&scratch, n) != PQ_SUCCESS) goto clean_up;
+    for(uint32_t i = 0; i < n; ++i) scratch.keys[i] = pq_database_clause_args_key(&pred->clauses[i], args);
+    if(pq_database_group(scratch.keys, n, scratch.order, scratch.groups, &groups_sz, &any_sz) != PQ_SUCCESS) goto clean_up;
+    if(!pq_database_is_selective(n, any_sz, groups_sz))
+    {
+        status = PQ_SUCCESS;
+        goto clean_up;
+    }
+    *selective = PQ_TRUE;
+
+    //the switch table, the chain of the clauses that match every key, then the chains of the groups.
+    const size_t slots = pq_database_switch_slots(groups_sz);
+    size_t size = 2 + 2 * slots + pq_database_chain_size(any_sz);
+    for(uint32_t g = 0; g < groups_sz; ++g) size += pq_database_chain_size(scratch.groups[g].count + any_sz);
+    pq_code* code = (pq_code*)malloc(size * sizeof(pq_code));
+    if(!code) goto clean_up;
+
+    pq_code* at = code + 2 + 2 * slots;
+    const uint32_t* any = scratch.order;
+    pq_database_init_switch(code, slots, pq_database_emit_chain(pred, any, any_sz, &at));
+    for(uint32_t g = 0; g < groups_sz; ++g)
+    {
+        const pq_index_group* group = &scratch.groups[g];
+        pq_database_add_switch(code, group->key,
+            pq_database_emit_group(pred, scratch.order + group->start, group->count, any, any_sz, scratch.merged, &at));
+    }
+
+    index->args = args;
+    index->keys = groups_sz;
+    index->block = code;
+    index->size = size;
+    index->hits = 0;
+    status = PQ_SUCCESS;
+
+clean_up:
+    pq_database_del_scratch(&scratch);
+    return status;
+}
+
+/**
+ * @brief Builds a jit index for a call, on the first selective argument that the calls often bind, else on all of them combined.
+ *
+ * @param pred The predicate.
+ * @param bound The arguments that the call binds.
+ * @return The new index, NULL if no index is worth building.
+ */
+static pq_jit_index* pq_database_jit_new_index(pq_pred* pred, const uint32_t bound)
+{
+    pq_jit* jit = pred->jit;
+    uint32_t frequent = 0; //the bound arguments that the calls often bind.
+    for(uint32_t i = 0; i < PQ_JIT_MAX_ARGS; ++i)
+        if(bound >> i & 1 && jit->bound[i] >= PQ_DATABASE_JIT_MIN_CALLS) frequent |= UINT32_C(1) << i;
+
+    uint32_t candidates[PQ_JIT_MAX_ARGS + 1];
+    uint32_t candidates_sz = 0;
+    for(uint32_t i = 0; i < PQ_JIT_MAX_ARGS; ++i)
+        if(frequent >> i & 1) candidates[candidates_sz++] = UINT32_C(1) << i;
+    if(candidates_sz > 1) candidates[candidates_sz++] = frequent;
+
+    for(uint32_t c = 0; c < candidates_sz; ++c)
+    {
+        const uint32_t args = candidates[c];
+        PQbool rejected = PQ_FALSE;
+        for(size_t i = 0; i < jit->rejected_sz && !rejected; ++i) rejected = jit->rejected[i] == args;
+        if(rejected) continue;
+
+        pq_jit_index index;
+        PQbool selective;
+        if(pq_array_reserve((void**)&jit->indexes, &jit->indexes_cap, jit->indexes_sz + 1, sizeof(pq_jit_index)) != PQ_SUCCESS
+            || pq_array_reserve((void**)&jit->rejected, &jit->rejected_cap, jit->rejected_sz + 1, sizeof(uint32_t)) != PQ_SUCCESS
+            || pq_database_jit_build(pred, args, &index, &selective) != PQ_SUCCESS)
+            return NULL;
+        if(!selective)
+        {
+            jit->rejected[jit->rejected_sz++] = args;
+            continue;
+        }
+        jit->indexes[jit->indexes_sz] = index;
+        return &jit->indexes[jit->indexes_sz++];
+    }
+    return NULL;
+}
+
+/**
+ * @brief Drops the jit indexes that were not used since the last review, and halves the statistics so they follow the recent calls.
+ *
+ * @param db The database of the predicate.
+ * @param jit The jit indexes of the predicate.
+ */
+static void pq_database_jit_review(pq_database* db, pq_jit* jit)
+{
+    size_t kept = 0;
+    for(size_t i = 0; i < jit->indexes_sz; ++i)
+    {
+        pq_jit_index* index = &jit->indexes[i];
+        if(!index->hits && pq_database_retire(db, index->block) == PQ_SUCCESS) continue;
+        index->hits = 0;
+        jit->indexes[kept++] = *index;
+    }
+    jit->indexes_sz = kept;
+    for(uint32_t i = 0; i < PQ_JIT_MAX_ARGS; ++i) jit->bound[i] >>= 1;
+    jit->calls = 0;
+}
+
+PQbool pq_database_jit_select(pq_database* db, pq_pred* pred, const pq_term* args, pq_code** code)
+{
+    if(!pred->jit && !(pred->jit = (pq_jit*)calloc(1, sizeof(pq_jit)))) return PQ_FALSE;
+    pq_jit* jit = pred->jit;
+    if(++jit->calls >= PQ_DATABASE_JIT_REVIEW_CALLS) pq_database_jit_review(db, jit);
+
+    //the arguments of the call that can be hashed.
+    const uint32_t arity = pred->arity < PQ_JIT_MAX_ARGS ? pred->arity : PQ_JIT_MAX_ARGS;
+    uint32_t bound = 0;
+    for(uint32_t i = 0; i < arity; ++i)
+    {
+        if(pq_database_call_key(args[i]) == PQ_DATABASE_KEY_ANY) continue;
+        bound |= UINT32_C(1) << i;
+        jit->bound[i]++;
+    }
+    if(!bound) return PQ_FALSE;
+
+    //the index with the most keys whose arguments are bound, else a new one.
+    pq_jit_index* best = NULL;
+    for(size_t i = 0; i < jit->indexes_sz; ++i)
+    {
+        pq_jit_index* index = &jit->indexes[i];
+        if(!(index->args & ~bound) && (!best || index->keys > best->keys)) best = index;
+    }
+    if(!best && !(best = pq_database_jit_new_index(pred, bound))) return PQ_FALSE;
+
+    best->hits++;
+    *code = pq_wam_switch_lookup(best->block, pq_database_call_args_key(args, best->args));
+    return PQ_TRUE;
+}
+
+size_t pq_database_index_memory(const pq_pred* pred)
+{
+    size_t size = pred->entry_sz * sizeof(pq_code);
+    const pq_jit* jit = pred->jit;
+    if(!jit) return size;
+
+    size += sizeof(pq_jit) + jit->indexes_cap * sizeof(pq_jit_index) + jit->rejected_cap * sizeof(uint32_t);
+    for(size_t i = 0; i < jit->indexes_sz; ++i) size += jit->indexes[i].size * sizeof(pq_code);
+    return size;
+}
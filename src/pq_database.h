@@ -0,0 +1,238 @@
+/**
+ * @file pq_database.h
+ * @author Brandon Foster
+ * @brief poqer-lang clause database header.
+ * the pq_database struct maps a name and an arity to a predicate, and a predicate stores the compiled code of its clauses.
+ * create/destroy the database with the pq_new_* and pq_del_* functions.
+ * find or create a predicate with pq_database_get_pred function, add the compiled clauses with pq_database_add_clause function.
+ * get the code that is called for a predicate with pq_database_get_entry function.
+ *
+ * @version 0.001
+ * @date 10-16-2026
+ * @copyright Brandon Foster (c) 2020-2021
+ */
+
+#ifndef _PQ_DATABASE_H
+#define _PQ_DATABASE_H
+#include "pq_globals.h"
+#include "pq_atom.h"
+#include "pq_arena.h"
+#include "pq_wam.h"
+#include <stdlib.h>
+
+/**
+ * @brief The compiled code of a clause.
+ */
+typedef struct pq_clause
+{
+    pq_code* code;
+    uint32_t size; //the number of words in code.
+} pq_clause;
+
+struct pq_machine;
+
+/**
+ * @brief The results of a builtin predicate.
+ */
+typedef enum pq_builtin_result
+{
+    PQ_BUILTIN_FAIL, //the builtin failed, or raised the error stored in the machine.
+    PQ_BUILTIN_TRUE, //the builtin succeeded.
+    PQ_BUILTIN_JUMP //the builtin loaded the argument registers of another predicate that is called in its place (e.g. call/N).
+} pq_builtin_result;
+
+/**
+ * @brief A predicate that is implemented in c, it runs to completion without a choice point.
+ *
+ * @param machine The machine that is running, the predicate to jump to is stored here.
+ * @param args The argument registers.
+ * @return The pq_builtin_result.
+ */
+typedef pq_builtin_result (*pq_builtin_fn)(struct pq_machine* machine, pq_term* args);
+
+//the number of arguments that the jit indexes can use, a set of arguments is a bit mask.
+#define PQ_JIT_MAX_ARGS 32
+
+/**
+ * @brief An index that was built at runtime on the arguments that the calls bind, its key combines the keys of the arguments.
+ */
+typedef struct pq_jit_index
+{
+    uint32_t args; //the arguments of the key, bit i is the argument i.
+    uint32_t keys; //the number of distinct keys.
+    pq_code* block; //the switch table (see pq_wam_switch_lookup), followed by the code of each key.
+    size_t size; //the number of words in block.
+    uint64_t hits; //the calls that used the index since the last review.
+} pq_jit_index;
+
+/**
+ * @brief The statistics of the calls that the first argument index cannot narrow, and the indexes that were built for them.
+ */
+typedef struct pq_jit
+{
+    uint64_t calls; //the calls since the last review.
+    uint32_t bound[PQ_JIT_MAX_ARGS]; //the calls that bound each argument, it is halved by each review.
+    uint32_t* rejected; //the sets of arguments whose keys are not selective, no index is built on them.
+    size_t rejected_sz;
+    size_t rejected_cap;
+    pq_jit_index* indexes;
+    size_t indexes_sz;
+    size_t indexes_cap;
+} pq_jit;
+
+/**
+ * @brief A predicate, the clauses with the same name and arity.
+ */
+typedef struct pq_pred
+{
+    pq_atom name;
+    uint32_t arity;
+    pq_clause* clauses; //the clauses in the order they were added.
+    uint32_t clauses_sz; //the number of clauses.
+    uint32_t clauses_cap; //the number of clauses allocated.
+    pq_code* entry; //the code that selects the clauses (e.g. try, retry, trust with the arity), NULL if there are no clauses.
+    pq_code* entry_block; //the allocated code of entry, NULL if entry is the code of the only clause.
+    size_t entry_sz; //the number of words in entry_block.
+    pq_jit* jit; //the jit indexes, NULL until a call needs them.
+    pq_builtin_fn builtin; //the c implementation, NULL if the predicate is defined by clauses.
+    uint32_t consult; //the consult that added the clauses, 0 if none, a later consult replaces them (e.g. reloading a file).
+    struct pq_pred* tabled; //the predicate that holds the clauses of a tabled predicate (see table/1), NULL if it is not tabled.
+    PQbool dirty; //whether the clauses changed since entry was built.
+} pq_pred;
+
+/**
+ * @brief The structure of a poqer-lang clause database.
+ */
+typedef struct pq_database
+{   //these variables should only be read externally, not modified.
+
+    pq_pred** preds; //open addressing hash set keyed by name and arity, an empty slot is NULL.
+    uint32_t count; //the number of predicates.
+    uint32_t slot_mask; //the number of slots minus 1, the number of slots is a power of 2.
+    pq_arena* arena; //the predicates and the boxed constants of the code, a predicate is never moved.
+
+    //the code that was replaced while it could still be running, it is deallocated by pq_database_free_retired.
+    pq_code** retired;
+    size_t retired_sz;
+    size_t retired_cap;
+} pq_database;
+
+/**
+ * @brief Safe allocation for a pq_database struct, initializes the empty database, then returns the pointer.
+ *
+ * @return A pointer to the allocated pq_database struct.
+ */
+pq_database* pq_new_database(void);
+
+/**
+ * @brief Safe deallocation of a pq_database struct, the code of every clause is deallocated.
+ *
+ * @param db The database that will be deallocated.
+ */
+void pq_del_database(pq_database* db);
+
+/**
+ * @brief Finds a predicate.
+ *
+ * @param db The database that will be used.
+ * @param name The name of the predicate.
+ * @param arity The arity of the predicate.
+ * @return The predicate, NULL if it was never created.
+ */
+pq_pred* pq_database_lookup(const pq_database* db, const pq_atom name, const uint32_t arity);
+
+/**
+ * @brief Finds a predicate, it is created without clauses if it does not exist (e.g. a call to a predicate that is defined later).
+ *
+ * @param db The database that will be modified.
+ * @param name The name of the predicate.
+ * @param arity The arity of the predicate.
+ * @return The predicate, NULL if there is not enough memory.
+ */
+pq_pred* pq_database_get_pred(pq_database* db, const pq_atom name, const uint32_t arity);
+
+/**
+ * @brief Appends a clause to a predicate, the code is copied.
+ *
+ * @param pred The predicate that will be modified.
+ * @param code The compiled code of the clause.
+ * @param size The number of words in code.
+ * @return PQ_SUCCESS if the clause was added else PQ_FAILURE.
+ */
+int pq_database_add_clause(pq_pred* pred, const pq_code* code, const size_t size);
+
+/**
+ * @brief Removes every clause of a predicate.
+ * The code is retired, since it can still be running.
+ *
+ * @param db The database of the predicate.
+ * @param pred The predicate that will be modified.
+ * @return PQ_SUCCESS if the clauses were removed else PQ_FAILURE.
+ */
+int pq_database_clear_pred(pq_database* db, pq_pred* pred);
+
+/**
+ * @brief Moves the clauses of a predicate to another predicate with the same arity, its clauses are removed (e.g. table/1).
+ * The code of a clause does not name its predicate, so the clauses are not compiled again.
+ *
+ * @param db The database of the predicates.
+ * @param from The predicate whose clauses are moved, it has no clauses after.
+ * @param to The predicate that receives the clauses.
+ * @return PQ_SUCCESS if the clauses were moved else PQ_FAILURE.
+ */
+int pq_database_move_clauses(pq_database* db, pq_pred* from, pq_pred* to);
+
+/**
+ * @brief Builds the code that selects the clauses of a predicate, if the clauses changed.
+ * The clauses are indexed by their first argument (switch_on_term, switch_on_constant and switch_on_structure),
+ * so a call only tries the clauses that can match it, and a call that matches a single clause creates no choice point.
+ * The old entry block is retired, since a choice point can still point into it.
+ *
+ * @param db The database of the predicate.
+ * @param pred The predicate that will be used.
+ * @return PQ_SUCCESS if the entry is built else PQ_FAILURE.
+ */
+int pq_database_build_entry(pq_database* db, pq_pred* pred);
+
+/**
+ * @brief Selects the clauses of a call with the jit indexes, it is run by switch_on_args.
+ * The statistics of the predicate are updated, an index is built on the bound arguments if they are selective,
+ * and the indexes that were not used since the last review are dropped.
+ *
+ * @param db The database of the predicate.
+ * @param pred The predicate that is called.
+ * @param args The argument registers.
+ * @param code The code that runs the clauses that can match the call, NULL if none can.
+ * @return PQ_TRUE if an index selected the clauses, else PQ_FALSE and every clause must be tried.
+ */
+PQbool pq_database_jit_select(pq_database* db, pq_pred* pred, const pq_term* args, pq_code** code);
+
+/**
+ * @brief Gets the memory that the indexes of a predicate use, the first argument index and the jit indexes.
+ *
+ * @param pred The predicate that will be used.
+ * @return The number of bytes.
+ */
+size_t pq_database_index_memory(const pq_pred* pred);
+
+/**
+ * @brief Deallocates the code that was replaced, it must only be called when no code is running (e.g. after a query).
+ *
+ * @param db The database that will be modified.
+ */
+void pq_database_free_retired(pq_database* db);
+
+/**
+ * @brief Gets the code that is run when a predicate is called.
+ *
+ * @param db The database of the predicate.
+ * @param pred The predicate that will be used.
+ * @return The entry code of the predicate, NULL if it has no clauses or there is not enough memory.
+ */
+static inline pq_code* pq_database_get_entry(pq_database* db, pq_pred* pred)
+{
+    if(pred->dirty && pq_database_build_entry(db, pred) != PQ_SUCCESS) return NULL;
+    return pred->entry;
+}
+
+#endif
@@ -0,0 +1,328 @@
+/**
+ * @file pq_float.c
+ * @author Brandon Foster
+ * @brief poqer-lang float literal conversion implementation.
+ * the fast paths are Clinger's (an exact mantissa times an exact power of 10) and Eisel-Lemire's (a truncated 128-bit power of five).
+ * Eisel-Lemire rounds every mantissa of at most 19 digits correctly, a longer literal is rounded with its first 19 digits and
+ * with the next mantissa up, and only if the two floats differ is it converted exactly.
+ *
+ * @version 0.001
+ * @date 10-16-2026
+ * @copyright Brandon Foster (c) 2020-2021
+ */
+
+#include "pq_float.h"
+#include "pq_bigint.h"
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+//the number of digits of a mantissa that fits in 64 bits.
+#define PQ_FLOAT_MANTISSA_DIGITS 19
+
+//the number of significant digits of the exact conversion, a float is halfway between two floats in at most 767 digits.
+#define PQ_FLOAT_EXACT_DIGITS 800
+
+//the room of the magnitudes of the exact conversion, the digits times the power of 10 of the smallest float plus the shift.
+#define PQ_FLOAT_EXACT_LIMBS 64
+
+//the bits of a float.
+#define PQ_FLOAT_MANTISSA_BITS 52
+#define PQ_FLOAT_EXP_BIAS 1023
+#define PQ_FLOAT_INF_EXP 0x7FF
+
+//the powers of 10 that are exact floats.
+static const PQflt pq_float_pow10[] =
+{
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+//the parts of a float literal, its digits are referenced in the lexeme.
+typedef struct pq_float_decimal
+{
+    const char* int_digits;
+    size_t int_len;
+    const char* frac_digits;
+    size_t frac_len;
+    int64_t exp;            //the exponent of the literal, clamped to a range that cannot overflow.
+    uint64_t mantissa;      //the first PQ_FLOAT_MANTISSA_DIGITS significant digits.
+    int64_t exp10;          //the literal is mantissa * 10^exp10 if it is not truncated.
+    PQbool truncated;       //whether a nonzero digit is after the mantissa.
+    char suffix;            //'I' for the infinity (1.0Inf), 'N' for not-a-number (1.5NaN), else 0.
+} pq_float_decimal;
+
+/**
+ * @brief Adds the digits of a part of a literal to its mantissa.
+ *
+ * @param dec The parts of the literal.
+ * @param digits The digits.
+ * @param len The number of digits.
+ * @param frac Whether the digits are the fraction.
+ * @param digit_count The number of significant digits of the mantissa so far.
+ */
+static inline void pq_float_add_digits(pq_float_decimal* dec, const char* digits, const size_t len, const PQbool frac, unsigned* digit_count)
+{
+    for(size_t i = 0; i < len; ++i)
+    {
+        const unsigned digit = (unsigned)(digits[i] - '0');
+        if(*digit_count < PQ_FLOAT_MANTISSA_DIGITS)
+        {   //the leading zeros are not significant, but a digit of the fraction always scales the mantissa.
+            if(*digit_count || digit)
+            {
+                dec->mantissa = dec->mantissa * 10 + digit;
+                ++*digit_count;
+            }
+            if(frac) --dec->exp10;
+        }
+        else
+        {   //a dropped digit of the integer part scales the mantissa.
+            if(!frac) ++dec->exp10;
+            dec->truncated |= digit != 0;
+        }
+    }
+}
+
+/**
+ * @brief Splits a float literal into its parts.
+ *
+ * @param dec The parts that will be initialized.
+ * @param str The literal.
+ * @param len The number of characters of the literal.
+ */
+static void pq_float_parse(pq_float_decimal* dec, const char* str, const size_t len)
+{
+    const char* p = str;
+    const char* end = str + len;
+    dec->int_digits = p;
+    while(p < end && *p >= '0' && *p <= '9') ++p;
+    dec->int_len = (size_t)(p - dec->int_digits);
+
+    dec->frac_digits = p;
+    dec->frac_len = 0;
+    if(p < end && '.' == *p)
+    {
+        dec->frac_digits = ++p;
+        while(p < end && *p >= '0' && *p <= '9') ++p;
+        dec->frac_len = (size_t)(p - dec->frac_digits);
+    }
+
+    dec->suffix = p < end && ('I' == *p || 'N' == *p) ? *p : 0;
+    dec->exp = 0;
+    if(p < end && ('e' == *p || 'E' == *p))
+    {
+        PQbool neg = PQ_FALSE;
+        if(++p < end && ('+' == *p || '-' == *p)) neg = '-' == *p++;
+        for(; p < end; ++p)
+            if(dec->exp < 1000000000) dec->exp = dec->exp * 10 + (*p - '0');
+        if(neg) dec->exp = -dec->exp;
+    }
+
+    unsigned digit_count = 0;
+    dec->mantissa = 0;
+    dec->exp10 = dec->exp;
+    dec->truncated = PQ_FALSE;
+    pq_float_add_digits(dec, dec->int_digits, dec->int_len, PQ_FALSE, &digit_count);
+    pq_float_add_digits(dec, dec->frac_digits, dec->frac_len, PQ_TRUE, &digit_count);
+}
+
+static inline PQflt pq_float_from_bits(const uint64_t bits)
+{
+    PQflt val;
+    memcpy(&val, &bits, sizeof(val));
+    return val;
+}
+
+/**
+ * @brief Converts a mantissa times a power of 10 into the bits of the nearest float (Eisel-Lemire).
+ * the mantissa is multiplied by the 128 most significant bits of the power of five, the power of two is added to the exponent.
+ * the product has enough correct bits to round every mantissa of 64 bits (Mushtak and Lemire).
+ *
+ * @param q The power of 10.
+ * @param w The mantissa.
+ * @return The bits of the float.
+ */
+static uint64_t pq_float_eisel_lemire(const int64_t q, uint64_t w)
+{
+    if(!w || q < PQ_FLOAT_POW5_MIN) return 0;
+    if(q > PQ_FLOAT_POW5_MAX) return (uint64_t)PQ_FLOAT_INF_EXP << PQ_FLOAT_MANTISSA_BITS;
+
+    const unsigned lz = pq_bigint_clz(w);
+    w <<= lz;
+    const uint64_t* pow5 = pq_float_pow5_128 + 2 * (q - PQ_FLOAT_POW5_MIN);
+    uint64_t hi;
+    uint64_t lo = pq_bigint_mul_wide(w, pow5[0], &hi);
+    if((hi & 0x1FF) == 0x1FF)
+    {   //the bits below the 55 bits of the rounding are all ones, the low half of the power could carry into them.
+        uint64_t lo_hi;
+        pq_bigint_mul_wide(w, pow5[1], &lo_hi);
+        lo += lo_hi;
+        hi += lo < lo_hi;
+    }
+
+    //the 54 bits of the mantissa and the rounding bit, the top bit of the product is 0 or 1.
+    const unsigned upper_bit = (unsigned)(hi >> 63);
+    const unsigned shift = upper_bit + 64 - PQ_FLOAT_MANTISSA_BITS - 3;
+    uint64_t mantissa = hi >> shift;
+    int64_t power2 = (((152170 + 65536) * q) >> 16) + 63 + upper_bit - lz + PQ_FLOAT_EXP_BIAS;
+    if(power2 <= 0)
+    {   //a subnormal, the rounding can carry into the smallest exponent, which is the same bits.
+        if(-power2 + 1 >= 64) return 0;
+        mantissa >>= -power2 + 1;
+        mantissa += mantissa & 1;
+        return mantissa >> 1;
+    }
+
+    //exactly halfway between two floats, which only happens for small powers, rounds to even.
+    if(lo <= 1 && q >= -4 && q <= 23 && (mantissa & 3) == 1 && (mantissa << shift) == hi) mantissa &= ~(uint64_t)1;
+    mantissa += mantissa & 1;
+    mantissa >>= 1;
+    if(mantissa >= (uint64_t)2 << PQ_FLOAT_MANTISSA_BITS)
+    {
+        mantissa = (uint64_t)1 << PQ_FLOAT_MANTISSA_BITS;
+        ++power2;
+    }
+    mantissa &= ~((uint64_t)1 << PQ_FLOAT_MANTISSA_BITS);
+    if(power2 >= PQ_FLOAT_INF_EXP) return (uint64_t)PQ_FLOAT_INF_EXP << PQ_FLOAT_MANTISSA_BITS;
+    return mantissa | (uint64_t)power2 << PQ_FLOAT_MANTISSA_BITS;
+}
+
+/**
+ * @brief Rounds a magnitude times a power of two to the nearest float.
+ *
+ * @param a The magnitude.
+ * @param n The size of the magnitude, it is not 0.
+ * @param e2 The power of two.
+ * @param sticky Whether the exact value is a little more than the magnitude.
+ * @return The float.
+ */
+static PQflt pq_float_round(const pq_limb* a, const size_t n, int64_t e2, PQbool sticky)
+{
+    //the top 64 bits, the bits below them are sticky.
+    const unsigned lz = pq_bigint_clz(a[n - 1]);
+    uint64_t m = a[n - 1] << lz;
+    if(n > 1)
+    {
+        if(lz) m |= a[n - 2] >> (64 - lz);
+        sticky |= (a[n - 2] << lz) != 0;
+        for(size_t i = 0; i + 2 < n && !sticky; ++i) sticky = a[i] != 0;
+    }
+    e2 += (int64_t)(n * 64) - lz - 64;
+
+    //a normal float keeps 53 bits, a subnormal keeps the bits down to 2^-1074.
+    const int64_t exp = e2 + 63;
+    if(exp > PQ_FLOAT_EXP_BIAS) return HUGE_VAL;
+    int64_t drop = 64 - PQ_FLOAT_MANTISSA_BITS - 1;
+    if(exp < 1 - PQ_FLOAT_EXP_BIAS) drop += 1 - PQ_FLOAT_EXP_BIAS - exp;
+    if(drop > 64) return 0.0;
+
+    const uint64_t kept = drop < 64 ? m >> drop : 0;
+    const uint64_t rest = drop < 64 ? m & (((uint64_t)1 << drop) - 1) : m;
+    const uint64_t half = (uint64_t)1 << (drop - 1);
+    const PQbool up = rest > half || (rest == half && (sticky || (kept & 1)));
+    return ldexp((PQflt)(kept + up), (int)(e2 + drop));
+}
+
+/**
+ * @brief Converts the parts of a float literal exactly with bignums.
+ * the digits after the first PQ_FLOAT_EXACT_DIGITS are replaced by a sticky digit, they cannot change the rounding.
+ *
+ * @param dec The parts of the literal.
+ * @return The float.
+ */
+static PQflt pq_float_from_decimal_exact(const pq_float_decimal* dec)
+{
+    pq_limb n[PQ_FLOAT_EXACT_LIMBS];
+    size_t nn = 0;
+    int64_t exp10 = dec->exp;
+    int64_t digit_count = 0;
+    PQbool sticky = PQ_FALSE;
+    pq_limb chunk = 0;
+    pq_limb scale = 1;
+    for(int part = 0; part < 2; ++part)
+    {
+        const char* digits = part ? dec->frac_digits : dec->int_digits;
+        const size_t len = part ? dec->frac_len : dec->int_len;
+        for(size_t i = 0; i < len; ++i)
+        {
+            const unsigned digit = (unsigned)(digits[i] - '0');
+            if(digit_count < PQ_FLOAT_EXACT_DIGITS)
+            {
+                if(digit_count || digit)
+                {   //the digits are added in chunks that fit in a limb.
+                    chunk = chunk * 10 + digit;
+                    scale *= 10;
+                    ++digit_count;
+                    if(scale == 10000000000000000000ull)
+                    {
+                        nn = pq_bigint_mul_limb_add(n, nn, scale, chunk);
+                        chunk = 0;
+                        scale = 1;
+                    }
+                }
+                if(part) --exp10;
+            }
+            else
+            {
+                if(!part) ++exp10;
+                sticky |= digit != 0;
+            }
+        }
+    }
+    if(scale > 1) nn = pq_bigint_mul_limb_add(n, nn, scale, chunk);
+    if(sticky)
+    {
+        nn = pq_bigint_mul_limb_add(n, nn, 10, 1);
+        --exp10;
+        ++digit_count;
+    }
+
+    //10^(exp10 + digit_count - 1) <= value < 10^(exp10 + digit_count).
+    if(!nn || exp10 + digit_count < -324) return 0.0;
+    if(exp10 + digit_count > 310) return HUGE_VAL;
+    if(exp10 >= 0)
+    {
+        for(int64_t i = 0; i < exp10; ++i) nn = pq_bigint_mul_limb_add(n, nn, 10, 0);
+        return pq_float_round(n, nn, 0, PQ_FALSE);
+    }
+
+    //the quotient of the digits by the power of 10 is scaled to 66 bits at least, the remainder is sticky.
+    pq_limb m[PQ_FLOAT_EXACT_LIMBS];
+    size_t mn = 1;
+    m[0] = 1;
+    for(int64_t i = 0; i < -exp10; ++i) mn = pq_bigint_mul_limb_add(m, mn, 10, 0);
+    const int64_t n_bits = (int64_t)nn * 64 - pq_bigint_clz(n[nn - 1]);
+    const int64_t m_bits = (int64_t)mn * 64 - pq_bigint_clz(m[mn - 1]);
+    const int64_t s = m_bits - n_bits + 66;
+    if(s > 0) nn = pq_bigint_shift_left(n, n, nn, (size_t)s);
+    else if(s < 0) mn = pq_bigint_shift_left(m, m, mn, (size_t)-s);
+
+    pq_limb q[PQ_FLOAT_EXACT_LIMBS];
+    pq_limb r[PQ_FLOAT_EXACT_LIMBS];
+    pq_limb scratch[2 * PQ_FLOAT_EXACT_LIMBS + 2];
+    size_t qn;
+    size_t rn;
+    pq_bigint_divmod(q, &qn, r, &rn, n, nn, m, mn, scratch);
+    return pq_float_round(q, qn, -s, rn != 0);
+}
+
+PQflt pq_float_from_decimal(const char* str, const size_t len)
+{
+    pq_float_decimal dec;
+    pq_float_parse(&dec, str, len);
+    if(dec.suffix) return 'I' == dec.suffix ? HUGE_VAL : NAN;
+    if(!dec.mantissa) return 0.0;
+
+#if FLT_EVAL_METHOD == 0
+    if(!dec.truncated && dec.mantissa <= (uint64_t)1 << 53 && dec.exp10 >= -22 && dec.exp10 <= 22)
+    {   //the mantissa and the power of 10 are exact floats, so their product or quotient is rounded once.
+        const PQflt val = (PQflt)dec.mantissa;
+        return dec.exp10 < 0 ? val / pq_float_pow10[-dec.exp10] : val * pq_float_pow10[dec.exp10];
+    }
+#endif
+
+    //a truncated literal is between its mantissa and the next one, if both round to the same float so does the literal.
+    const uint64_t bits = pq_float_eisel_lemire(dec.exp10, dec.mantissa);
+    if(dec.truncated && bits != pq_float_eisel_lemire(dec.exp10, dec.mantissa + 1)) return pq_float_from_decimal_exact(&dec);
+    return pq_float_from_bits(bits);
+}
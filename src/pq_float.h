@@ -0,0 +1,36 @@
+/**
+ * @file pq_float.h
+ * @author Brandon Foster
+ * @brief poqer-lang float literal conversion header.
+ * a float literal is converted to the nearest PQflt (ties to even) from the characters of its lexeme, it is never copied.
+ * most literals are converted by the Eisel-Lemire algorithm, a 64-bit mantissa times the 128-bit power of five of the exponent.
+ * the literals that it cannot round for sure are converted exactly with bignums.
+ *
+ * @version 0.001
+ * @date 10-16-2026
+ * @copyright Brandon Foster (c) 2020-2021
+ */
+
+#ifndef _PQ_FLOAT_H
+#define _PQ_FLOAT_H
+#include "pq_globals.h"
+
+//the range of the power of five table, a decimal exponent below it is 0 and above it is infinity.
+#define PQ_FLOAT_POW5_MIN (-342)
+#define PQ_FLOAT_POW5_MAX 308
+
+//the 128 most significant bits of the powers of five, generated by tools/pq_gen_float_tables.py.
+extern const uint64_t pq_float_pow5_128[];
+
+/**
+ * @brief Converts a float literal into the nearest float.
+ *
+ * @param str The literal, the digits of the integer part, then optionally a '.' and the digits of the fraction,
+ * then optionally an 'e' or 'E', a '+' or '-', and the digits of the exponent. the scanner states validated it.
+ * the fraction can be followed by "Inf" for the infinity or by "NaN" for not-a-number instead (e.g. 1.0Inf and 1.5NaN).
+ * @param len The number of characters of the literal.
+ * @return The float, infinity if it is too large.
+ */
+PQflt pq_float_from_decimal(const char* str, const size_t len);
+
+#endif
@@ -0,0 +1,424 @@
+/**
+ * @file pq_gc.c
+ * @author Brandon Foster
+ * @brief poqer-lang heap garbage collector implementation.
+ * a sliding mark-compact collector for the heap of the query that is running, the heap of an outer query is never moved.
+ * the live cells keep their order, so the heap is still split by the choice points and a variable is still older than the newer cells.
+ *
+ * the roots are the argument registers of the call, the permanent variables that the code after each continuation reads
+ * (the code of a clause has no jumps, so it is scanned until the environment is deallocated, a variable that is written first is dead),
+ * the saved arguments of the choice points, the variables of the query, and the older cells that the query bound (they are trailed).
+ *
+ * the current computation is marked first, then the choice points from the newest to the oldest.
+ * a trailed cell that is not marked when its choice point is reached is only read after backtracking, which unbinds it,
+ * so it is unbound now and its trail entry is dropped (early reset).
+ * a reference to a bound variable that is newer than every choice point is replaced by the value, it is never unbound (variable shunting).
+ *
+ * @version 0.001
+ * @date 10-16-2026
+ * @copyright Brandon Foster (c) 2020-2021
+ */
+
+#include "pq_machine.h"
+#include <time.h>
+
+/**
+ * @brief The state of a collection.
+ */
+typedef struct pq_gc_state
+{
+    pq_machine* m;
+    pq_term* lo; //the bottom of the heap of the query, the cell i of the collected heap is the bit i of the marks.
+    pq_term* hi; //the top of the heap.
+    pq_term* shunt; //the bound variables at or above it are never unbound, NULL while the choice points are marked.
+    size_t sz; //the number of slots on the marking stack (machine->pdl).
+    PQbool ok; //whether the scratch memory was allocated.
+} pq_gc_state;
+
+static inline unsigned pq_gc_popcount(uint64_t bits)
+{
+#if defined(__GNUC__)
+    return (unsigned)__builtin_popcountll(bits);
+#else
+    unsigned count = 0;
+    for(; bits; bits &= bits - 1) ++count;
+    return count;
+#endif
+}
+
+static inline PQbool pq_gc_in_heap(const pq_gc_state* s, const pq_term* cell)
+{
+    return cell >= s->lo && cell < s->hi;
+}
+
+static inline PQbool pq_gc_is_marked(const pq_gc_state* s, const pq_term* cell)
+{
+    const size_t i = (size_t)(cell - s->lo);
+    return (PQbool)(s->m->gc.marks[i >> 6] >> (i & 63) & 1);
+}
+
+static inline void pq_gc_set_mark(pq_gc_state* s, const pq_term* cell)
+{
+    const size_t i = (size_t)(cell - s->lo);
+    s->m->gc.marks[i >> 6] |= (uint64_t)1 << (i & 63);
+}
+
+//the bits of the stack cells: the environments that were scanned and the permanent variables that are roots.
+static inline PQbool pq_gc_test_and_set_seen(pq_gc_state* s, const void* cell)
+{
+    const size_t i = (size_t)((const pq_term*)cell - s->m->stack);
+    const uint64_t bit = (uint64_t)1 << (i & 63);
+    const PQbool seen = (s->m->gc.seen[i >> 6] & bit) != 0;
+    s->m->gc.seen[i >> 6] |= bit;
+    return seen;
+}
+
+static inline void pq_gc_push(pq_gc_state* s, pq_term* slot)
+{
+    if(s->sz == s->m->pdl_cap && pq_array_reserve((void**)&s->m->pdl, &s->m->pdl_cap, s->sz + 1, sizeof(pq_term)) != PQ_SUCCESS)
+    {
+        s->ok = PQ_FALSE;
+        return;
+    }
+    s->m->pdl[s->sz++] = (pq_term)(uintptr_t)slot;
+}
+
+/**
+ * @brief Adds a root that is outside of the collected heap, it is marked and updated when the heap moves.
+ *
+ * @param s The state of the collection.
+ * @param slot The cell of the root.
+ */
+static inline void pq_gc_add_root(pq_gc_state* s, pq_term* slot)
+{
+    pq_gc* gc = &s->m->gc;
+    if(pq_array_reserve((void**)&gc->roots, &gc->roots_cap, gc->roots_sz + 1, sizeof(pq_term*)) != PQ_SUCCESS)
+    {
+        s->ok = PQ_FALSE;
+        return;
+    }
+    gc->roots[gc->roots_sz++] = slot;
+    pq_gc_push(s, slot);
+}
+
+/**
+ * @brief Marks the cells that the slots on the marking stack reach.
+ *
+ * @param s The state of the collection.
+ */
+static void pq_gc_mark(pq_gc_state* s)
+{
+    while(s->sz)
+    {
+        pq_term* slot = (pq_term*)(uintptr_t)s->m->pdl[--s->sz];
+        pq_term term = *slot;
+        if(s->shunt)
+        {   //the slot holds the value of the variable, the variable can be reclaimed.
+            while(pq_term_get_tag(term) == PQ_TAG_REF && pq_term_get_ptr(term) >= s->shunt && pq_term_get_ptr(term) < s->hi
+                && *pq_term_get_ptr(term) != term)
+                term = *pq_term_get_ptr(term);
+            *slot = term;
+        }
+
+        pq_term* cell = pq_term_get_ptr(term);
+        switch(pq_term_get_tag(term))
+        {
+        case PQ_TAG_REF:
+            if(!pq_gc_in_heap(s, cell) || pq_gc_is_marked(s, cell)) break;
+            pq_gc_set_mark(s, cell);
+            if(*cell != term) pq_gc_push(s, cell);
+            break;
+        case PQ_TAG_LIST:
+            if(!pq_gc_in_heap(s, cell)) break;
+            for(uint32_t i = 0; i < 2; ++i)
+            {   //a reference can mark the head or the tail alone.
+                if(pq_gc_is_marked(s, cell + i)) continue;
+                pq_gc_set_mark(s, cell + i);
+                pq_gc_push(s, cell + i);
+            }
+            break;
+        case PQ_TAG_STR:
+        {
+            if(!pq_gc_in_heap(s, cell) || pq_gc_is_marked(s, cell)) break;
+            const uint32_t arity = pq_term_get_arity(term);
+            pq_gc_set_mark(s, cell);
+            for(uint32_t i = 1; i <= arity; ++i)
+            {
+                if(pq_gc_is_marked(s, cell + i)) continue;
+                pq_gc_set_mark(s, cell + i);
+                pq_gc_push(s, cell + i);
+            }
+            break;
+        }
+        case PQ_TAG_BOX:
+        {
+            if(!pq_gc_in_heap(s, cell) || pq_gc_is_marked(s, cell)) break;
+            const size_t size = (size_t)(*cell >> 32);
+            for(size_t i = 0; i <= size; ++i) pq_gc_set_mark(s, cell + i);
+            break;
+        }
+        default:
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Adds the permanent variables of a chain of environments that are read after their continuation.
+ * The chain stops at the frame below the query, or at an environment that was scanned, the older ones were scanned with it.
+ *
+ * @param s The state of the collection.
+ * @param e The environment.
+ * @param cp The continuation, the code that runs in e.
+ */
+static void pq_gc_add_frames(pq_gc_state* s, pq_frame* e, const pq_code* cp)
+{
+    pq_gc* gc = &s->m->gc;
+    const pq_frame* bottom = s->m->base->e;
+    while(e && e != bottom)
+    {
+        const size_t words = ((size_t)e->size >> 6) + 1;
+        if(pq_array_reserve((void**)&gc->written, &gc->written_cap, words, sizeof(uint64_t)) != PQ_SUCCESS)
+        {
+            s->ok = PQ_FALSE;
+            return;
+        }
+        memset(gc->written, 0, words * sizeof(uint64_t));
+
+        for(PQbool done = PQ_FALSE; !done; cp += pq_wam_sizes[pq_wam_get_op(*cp)])
+        {
+            const uint32_t y = pq_wam_get_a(*cp);
+            switch(pq_wam_get_op(*cp))
+            {
+            case PQ_WAM_GET_VARIABLE_Y:
+            case PQ_WAM_PUT_VARIABLE_Y:
+            case PQ_WAM_UNIFY_VARIABLE_Y:
+            case PQ_WAM_GET_LEVEL_Y:
+                gc->written[y >> 6] |= (uint64_t)1 << (y & 63);
+                break;
+            case PQ_WAM_GET_VALUE_Y:
+            case PQ_WAM_PUT_VALUE_Y:
+            case PQ_WAM_UNIFY_VALUE_Y:
+            case PQ_WAM_CUT_Y:
+                if(gc->written[y >> 6] >> (y & 63) & 1) break;
+                if(!pq_gc_test_and_set_seen(s, &e->y[y])) pq_gc_add_root(s, &e->y[y]);
+                break;
+            case PQ_WAM_DEALLOCATE:
+            case PQ_WAM_EXECUTE:
+            case PQ_WAM_PROCEED:
+            case PQ_WAM_FAIL:
+            case PQ_WAM_HALT:
+                done = PQ_TRUE;
+                break;
+            default:
+                break;
+            }
+        }
+
+        if(pq_gc_test_and_set_seen(s, e)) return;
+        cp = e->cp;
+        e = e->prev;
+    }
+}
+
+/**
+ * @brief Gets the address of a cell after the compaction.
+ *
+ * @param s The state of the collection, the marks are counted.
+ * @param cell A cell of the collected heap, or its top.
+ * @return The bottom of the heap plus the number of marked cells below the cell.
+ */
+static inline pq_term* pq_gc_forward(const pq_gc_state* s, const pq_term* cell)
+{
+    const size_t i = (size_t)(cell - s->lo);
+    const uint64_t below = s->m->gc.marks[i >> 6] & (((uint64_t)1 << (i & 63)) - 1);
+    return s->lo + s->m->gc.counts[i >> 6] + pq_gc_popcount(below);
+}
+
+static inline pq_term pq_gc_relocate(const pq_gc_state* s, const pq_term term)
+{
+    switch(pq_term_get_tag(term))
+    {
+    case PQ_TAG_REF:
+    case PQ_TAG_STR:
+    case PQ_TAG_LIST:
+    case PQ_TAG_BOX:
+        if(pq_gc_in_heap(s, pq_term_get_ptr(term))) return pq_make_ptr_term(pq_gc_forward(s, pq_term_get_ptr(term)), pq_term_get_tag(term));
+        return term;
+    default:
+        return term;
+    }
+}
+
+//a dropped trail entry is tagged until the trail is compacted, the cells are aligned so the lowest bit is free.
+static inline PQbool pq_gc_is_dropped(const pq_term* cell)
+{
+    return ((uintptr_t)cell & 1) != 0;
+}
+
+static inline pq_term* pq_gc_drop(const pq_term* cell)
+{
+    return (pq_term*)((uintptr_t)cell | 1);
+}
+
+static inline pq_term* pq_gc_undrop(const pq_term* cell)
+{
+    return (pq_term*)((uintptr_t)cell & ~(uintptr_t)1);
+}
+
+/**
+ * @brief Marks the cells that a choice point reads after backtracking, its trail entries are reset early or dropped first.
+ *
+ * @param s The state of the collection, the newer computation is marked.
+ * @param b The choice point.
+ * @param tr The top of the trail of b, the bottom of the newer choice point.
+ */
+static void pq_gc_mark_choice(pq_gc_state* s, pq_choice* b, const size_t tr)
+{
+    pq_machine* m = s->m;
+    for(size_t i = b->tr; i < tr; ++i)
+    {
+        pq_term* cell = m->trail[i];
+        if(cell < s->lo) pq_gc_add_root(s, cell);
+        else if(cell >= b->h) m->trail[i] = pq_gc_drop(cell); //the cell is popped by the backtracking, the entry is useless.
+        else if(!pq_gc_is_marked(s, cell))
+        {
+            *cell = pq_make_ptr_term(cell, PQ_TAG_REF);
+            m->trail[i] = pq_gc_drop(cell);
+        }
+    }
+    for(uint64_t i = 0; i < b->arity; ++i) pq_gc_add_root(s, &b->args[i]);
+    pq_gc_add_frames(s, b->e, b->cp);
+    pq_gc_mark(s);
+}
+
+/**
+ * @brief Moves the marked cells to the bottom of the collected heap, and updates the roots, the trail, and the choice points.
+ *
+ * @param s The state of the collection, the heap is marked.
+ * @return The number of marked cells.
+ */
+static size_t pq_gc_compact(pq_gc_state* s)
+{
+    pq_machine* m = s->m;
+    pq_gc* gc = &m->gc;
+    const size_t words = ((size_t)(s->hi - s->lo) >> 6) + 1;
+    size_t live = 0;
+    for(size_t w = 0; w < words; ++w)
+    {
+        gc->counts[w] = live;
+        live += pq_gc_popcount(gc->marks[w]);
+    }
+
+    for(size_t i = 0; i < gc->roots_sz; ++i) *gc->roots[i] = pq_gc_relocate(s, *gc->roots[i]);
+
+    //the kept trail entries are moved down, the choice points are the newest first so their trail tops are walked backwards.
+    size_t k = m->base->tr;
+    size_t c = gc->choices_sz;
+    for(size_t i = m->base->tr; i < m->tr; ++i)
+    {
+        for(; c && gc->choices[c - 1]->tr == i; --c) gc->choices[c - 1]->tr = k;
+        const pq_term* cell = m->trail[i];
+        if(pq_gc_is_dropped(cell)) continue;
+        m->trail[k++] = pq_gc_in_heap(s, cell) ? pq_gc_forward(s, cell) : (pq_term*)cell;
+    }
+    for(; c; --c) gc->choices[c - 1]->tr = k;
+    m->tr = k;
+    for(size_t i = 0; i < gc->choices_sz; ++i) gc->choices[i]->h = pq_gc_forward(s, gc->choices[i]->h);
+
+    //the cells slide down in order, a box is copied with its raw data.
+    pq_term* to = s->lo;
+    const size_t n = (size_t)(s->hi - s->lo);
+    for(size_t i = 0; i < n; ++i)
+    {
+        if(!(gc->marks[i >> 6] >> (i & 63) & 1)) continue;
+        const pq_term cell = s->lo[i];
+        if(pq_term_get_tag(cell) == PQ_TAG_BOX_HEADER)
+        {
+            const size_t size = (size_t)(cell >> 32);
+            memmove(to, &s->lo[i], (size + 1) * sizeof(pq_term));
+            to += size + 1;
+            i += size;
+            continue;
+        }
+        *to++ = pq_gc_relocate(s, cell);
+    }
+    return live;
+}
+
+int pq_machine_gc(pq_machine* machine, const uint32_t arity)
+{
+    if(!machine->depth) return PQ_SUCCESS;
+
+    const clock_t start = clock();
+    pq_gc* gc = &machine->gc;
+    pq_gc_state s = { machine, machine->base->h, machine->h, machine->b->h, 0, PQ_TRUE };
+    const pq_term* top = pq_machine_stack_top(machine, machine->e, machine->cp, machine->b);
+    const size_t words = ((size_t)(s.hi - s.lo) >> 6) + 1;
+    const size_t stack_words = ((size_t)(top - machine->stack) >> 6) + 1;
+    if(pq_array_reserve((void**)&gc->marks, &gc->marks_cap, words, sizeof(uint64_t)) != PQ_SUCCESS
+        || pq_array_reserve((void**)&gc->counts, &gc->counts_cap, words, sizeof(size_t)) != PQ_SUCCESS
+        || pq_array_reserve((void**)&gc->seen, &gc->seen_cap, stack_words, sizeof(uint64_t)) != PQ_SUCCESS)
+    {
+        machine->err = "resource error: not enough memory for the garbage collector.";
+        return PQ_FAILURE;
+    }
+    memset(gc->marks, 0, words * sizeof(uint64_t));
+    memset(gc->seen, 0, stack_words * sizeof(uint64_t));
+    gc->roots_sz = 0;
+    gc->choices_sz = 0;
+
+    //the current computation, the variables of the query are the bottom of the heap.
+    for(pq_term* cell = machine->answers; cell < machine->answers + machine->answers_sz; ++cell)
+    {
+        pq_gc_set_mark(&s, cell);
+        pq_gc_push(&s, cell);
+    }
+    for(uint32_t i = 0; i < arity; ++i) pq_gc_add_root(&s, &machine->x[i]);
+    pq_gc_add_frames(&s, machine->e, machine->cp);
+    pq_gc_mark(&s);
+
+    //the choice points, the newest first.
+    s.shunt = NULL;
+    size_t tr = machine->tr;
+    for(pq_choice* b = machine->b; s.ok; b = b->prev)
+    {
+        if(pq_array_reserve((void**)&gc->choices, &gc->choices_cap, gc->choices_sz + 1, sizeof(pq_choice*)) != PQ_SUCCESS)
+        {
+            s.ok = PQ_FALSE;
+            break;
+        }
+        gc->choices[gc->choices_sz++] = b;
+        pq_gc_mark_choice(&s, b, tr);
+        tr = b->tr;
+        if(b == machine->base) break;
+    }
+    if(!s.ok)
+    {   //nothing moved, the reset cells and the shunted references are still valid.
+        for(size_t i = machine->base->tr; i < machine->tr; ++i) machine->trail[i] = pq_gc_undrop(machine->trail[i]);
+        machine->err = "resource error: not enough memory for the garbage collector.";
+        return PQ_FAILURE;
+    }
+
+    const size_t live = pq_gc_compact(&s);
+    machine->h = s.lo + live;
+    gc->count++;
+    gc->reclaimed += (uint64_t)(s.hi - machine->h) * sizeof(pq_term);
+    gc->time += (double)(clock() - start) / CLOCKS_PER_SEC;
+    pq_machine_set_gc_policy(machine, gc->min, gc->growth);
+    return PQ_SUCCESS;
+}
+
+void pq_machine_set_gc_policy(pq_machine* machine, const size_t min, const uint32_t growth)
+{
+    pq_gc* gc = &machine->gc;
+    gc->min = min;
+    gc->growth = growth;
+
+    //the heap can grow by half of the free cells at most, so a full heap is not collected by every call.
+    size_t room = (size_t)((uint64_t)(machine->h - machine->heap) * growth / 100);
+    if(room < min) room = min;
+    const size_t free = (size_t)(machine->heap_end - machine->h);
+    if(room > free / 2) room = free / 2;
+    gc->limit = machine->h + room;
+}
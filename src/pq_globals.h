@@ -12,6 +12,9 @@
 #ifndef _PQ_GLOBALS_H
 #define _PQ_GLOBALS_H
 #include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
 
 #ifdef __gnu_linux__
 #define PQ_OS_LINUX 1
@@ -35,4 +38,50 @@ typedef int64_t     PQint;
 //poqer-lang extra typedefs
 typedef uint16_t pq_priority;
 
+/**
+ * @brief A utf8 string that is not null-terminated.
+ * the characters are not owned by the lexeme, they usually reference the scanner's buffer.
+ */
+typedef struct pq_lexeme
+{
+    PQstr str; //the first character of the lexeme.
+    size_t len; //the number of bytes in the lexeme.
+} pq_lexeme;
+
+//creates a lexeme from a string literal.
+#define PQ_LEXEME_LITERAL(literal) ((pq_lexeme){ (literal), sizeof(literal) - 1 })
+
+static inline pq_lexeme pq_make_lexeme(PQstr str, const size_t len)
+{
+    pq_lexeme lexeme = { str, len };
+    return lexeme;
+}
+
+/**
+ * @brief Grows a malloc'd array to hold at least need items, the capacity is doubled so appending is amortized constant time.
+ * 
+ * @param items A pointer to the array, NULL for an empty array.
+ * @param cap A pointer to the number of items allocated.
+ * @param need The number of items needed.
+ * @param item_sz The number of bytes in an item.
+ * @return PQ_SUCCESS if the array holds need items else PQ_FAILURE, the array is unchanged.
+ */
+static inline int pq_array_reserve(void** items, size_t* cap, const size_t need, const size_t item_sz)
+{
+    if(need <= *cap) return PQ_SUCCESS;
+
+    size_t new_cap = *cap ? *cap : 64;
+    while(new_cap < need) new_cap <<= 1;
+    void* new_items = realloc(*items, new_cap * item_sz);
+    if(!new_items) return PQ_FAILURE;
+    *items = new_items;
+    *cap = new_cap;
+    return PQ_SUCCESS;
+}
+
+static inline PQbool pq_lexeme_equals_cstr(const pq_lexeme lexeme, const char* cstr)
+{
+    return strncmp(lexeme.str, cstr, lexeme.len) == 0 && cstr[lexeme.len] == '\0';
+}
+
 #endif
\ No newline at end of file
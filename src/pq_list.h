@@ -76,6 +76,7 @@ static inline void pq_list_push_back(pq_list* list, void* item)
     pq_list_node* node = (pq_list_node*)malloc(sizeof(pq_list_node));
     node->item = item;
     node->prev = list->nil->prev;
+    node->prev->next = node;
     list->nil->prev = node;
     node->next = list->nil;
     list->size++;
@@ -86,6 +87,7 @@ static inline void pq_list_push_forward(pq_list* list, void* item)
     pq_list_node* node = (pq_list_node*)malloc(sizeof(pq_list_node));
     node->item = item;
     node->next = list->nil->next;
+    node->next->prev = node;
     list->nil->next = node;
     node->prev = list->nil;
     list->size++;
@@ -0,0 +1,1447 @@
+/**
+ * @file pq_machine.c
+ * @author Brandon Foster
+ * @brief poqer-lang abstract machine implementation.
+ * the instructions are dispatched with computed gotos where the compiler supports them (GCC and clang),
+ * every instruction jumps to the next one through the label table, so each has its own indirect branch.
+ * define PQ_MACHINE_NO_THREADING to use the portable switch instead.
+ *
+ * @version 0.001
+ * @date 10-16-2026
+ * @copyright Brandon Foster (c) 2020-2021
+ */
+
+#include "pq_machine.h"
+#include "pq_bigint.h"
+#include "pq_mapped_file.h"
+#include <stdio.h>
+
+#if defined(__GNUC__) && !defined(PQ_MACHINE_NO_THREADING)
+  #define PQ_MACHINE_THREADED 1
+#else
+  #define PQ_MACHINE_THREADED 0
+#endif
+
+//the number of cells of the frame below a query, it saves the registers of the outer query.
+#define PQ_MACHINE_BASE_SIZE 7
+
+//the number of cells of an environment and a choice point, without their variables and arguments.
+#define PQ_MACHINE_FRAME_CELLS (sizeof(pq_frame) / sizeof(pq_term))
+#define PQ_MACHINE_CHOICE_CELLS (sizeof(pq_choice) / sizeof(pq_term))
+
+//the code that ends a query, halt_true is the continuation of the query and halt_fail is the alternative of its base choice point.
+//a continuation follows a call, which keeps the variables of the frame below the query (see pq_machine_stack_top).
+static const pq_code pq_machine_halt_code[3] = {
+    (pq_code)PQ_WAM_CALL | (pq_code)PQ_MACHINE_BASE_SIZE << 8, 0, (pq_code)PQ_WAM_HALT | (pq_code)1 << 8 };
+static const pq_code* const pq_machine_halt_true = &pq_machine_halt_code[2];
+static const pq_code pq_machine_halt_fail[1] = { (pq_code)PQ_WAM_HALT };
+
+//the code that backtracks into the last choice point, it is run by pq_machine_redo.
+static const pq_code pq_machine_redo_code[1] = { (pq_code)PQ_WAM_FAIL };
+
+static void pq_machine_default_output(const char* str)
+{
+    fputs(str, stdout);
+}
+
+pq_machine* pq_new_machine(const size_t heap_sz, const size_t stack_sz)
+{
+    pq_machine* machine = (pq_machine*)calloc(1, sizeof(pq_machine));
+    if(!machine) return NULL;
+
+    const size_t heap_cells = heap_sz ? heap_sz : PQ_MACHINE_HEAP_SIZE;
+    const size_t stack_cells = stack_sz ? stack_sz : PQ_MACHINE_STACK_SIZE;
+    machine->db = pq_new_database();
+    machine->compiler = machine->db ? pq_new_compiler(machine->db) : NULL;
+    machine->ops = pq_new_op_table();
+    machine->heap = (pq_term*)malloc(heap_cells * sizeof(pq_term));
+    machine->stack = (pq_term*)malloc(stack_cells * sizeof(pq_term));
+    machine->x = (pq_term*)malloc(PQ_WAM_REGISTERS * sizeof(pq_term));
+    machine->writer = machine->ops && machine->heap ? pq_new_writer(machine->ops, machine->heap) : NULL;
+    machine->tables = pq_new_table_space();
+    if(!machine->compiler || !machine->ops || !machine->heap || !machine->stack || !machine->x || !machine->writer || !machine->tables)
+    {
+        pq_del_machine(machine);
+        return NULL;
+    }
+    machine->heap_end = machine->heap + heap_cells;
+    machine->stack_end = machine->stack + stack_cells;
+    machine->h = machine->heap;
+    machine->output = pq_machine_default_output;
+    pq_machine_set_gc_policy(machine, PQ_MACHINE_GC_MIN, PQ_MACHINE_GC_GROWTH);
+
+    if(pq_builtins_init(machine) != PQ_SUCCESS)
+    {
+        pq_del_machine(machine);
+        return NULL;
+    }
+    return machine;
+}
+
+void pq_del_machine(pq_machine* machine)
+{
+    if(!machine) return;
+
+    if(machine->compiler) pq_del_compiler(machine->compiler);
+    if(machine->db) pq_del_database(machine->db);
+    if(machine->ops) pq_del_op_table(machine->ops);
+    if(machine->writer) pq_del_writer(machine->writer);
+    if(machine->tables) pq_del_table_space(machine->tables);
+    for(uint32_t i = 0; machine->calls && i <= machine->calls_mask; ++i) free(machine->calls[i].shape);
+    free(machine->calls);
+    free(machine->shape);
+    free(machine->pdl);
+    free(machine->marked);
+    free(machine->numbers);
+    free(machine->gc.marks);
+    free(machine->gc.counts);
+    free(machine->gc.seen);
+    free(machine->gc.written);
+    free(machine->gc.roots);
+    free(machine->gc.choices);
+    free(machine->trail);
+    free(machine->x);
+    free(machine->stack);
+    free(machine->heap);
+    free(machine);
+}
+
+void pq_machine_set_pred_error(pq_machine* machine, const char* format, const pq_atom name, const uint32_t arity)
+{
+    snprintf(machine->err_buffer, sizeof(machine->err_buffer), format, pq_atom_get_cstr(name), arity);
+    machine->err = machine->err_buffer;
+}
+
+/**
+ * @brief Checks if two constants are identical, the boxed constants are compared by their data.
+ *
+ * @param a The first constant.
+ * @param b The second constant.
+ * @return true if the constants are identical else false.
+ */
+static inline PQbool pq_machine_same_constant(const pq_term a, const pq_term b)
+{
+    if(a == b) return PQ_TRUE;
+    if(pq_term_get_tag(a) != PQ_TAG_BOX || pq_term_get_tag(b) != PQ_TAG_BOX) return PQ_FALSE;
+
+    const pq_term* x = pq_term_get_ptr(a);
+    const pq_term* y = pq_term_get_ptr(b);
+    return x[0] == y[0] && !memcmp(x + 1, y + 1, (x[0] >> 32) * sizeof(pq_term));
+}
+
+/**
+ * @brief Reserves room for more cells on the scratch stack.
+ *
+ * @param machine The machine that will be modified, upon failure the error is stored here.
+ * @param need The number of cells needed.
+ * @return PQ_SUCCESS if the room was reserved else PQ_FAILURE.
+ */
+static inline int pq_machine_reserve_pdl(pq_machine* machine, const size_t need)
+{
+    if(need <= machine->pdl_cap) return PQ_SUCCESS;
+    if(pq_array_reserve((void**)&machine->pdl, &machine->pdl_cap, need, sizeof(pq_term)) == PQ_SUCCESS) return PQ_SUCCESS;
+    machine->err = "resource error: not enough memory for the term.";
+    return PQ_FAILURE;
+}
+
+/**
+ * @brief Checks if a term contains a variable or a structure.
+ *
+ * @param machine The machine that will be used, upon failure the error is stored here.
+ * @param target The dereferenced unbound variable, or the structure that is built.
+ * @param term The term.
+ * @param base The number of cells of the scratch stack that are in use, they are kept.
+ * @return true if the term contains the target, or there is not enough memory.
+ */
+static PQbool pq_machine_occurs(pq_machine* machine, const pq_term target, const pq_term term, const size_t base)
+{
+    size_t sz = base;
+    if(pq_machine_reserve_pdl(machine, sz + 1) != PQ_SUCCESS) return PQ_TRUE;
+    machine->pdl[sz++] = term;
+    while(sz > base)
+    {
+        const pq_term sub = pq_term_deref(machine->pdl[--sz]);
+        if(sub == target) return PQ_TRUE;
+        if(!pq_term_is_compound(sub)) continue;
+
+        const uint32_t arity = pq_term_get_arity(sub);
+        if(pq_machine_reserve_pdl(machine, sz + arity) != PQ_SUCCESS) return PQ_TRUE;
+        memcpy(&machine->pdl[sz], pq_term_get_args(sub), arity * sizeof(pq_term));
+        sz += arity;
+    }
+    return PQ_FALSE;
+}
+
+/**
+ * @brief Runs the occurs check of a binding, if the machine does it (see pq_occurs_check).
+ *
+ * @param machine The machine that will be used, upon failure the error is stored here.
+ * @param target The dereferenced unbound variable that is bound, or the structure that is built.
+ * @param term The term that is bound to the variable, or written into the structure.
+ * @param base The number of cells of the scratch stack that are in use, they are kept.
+ * @return true if the binding is allowed else false, the unification fails.
+ */
+static inline PQbool pq_machine_can_bind(pq_machine* machine, const pq_term target, const pq_term term, const size_t base)
+{
+    if(machine->occurs_check == PQ_OCCURS_CHECK_FALSE || !pq_machine_occurs(machine, target, term, base)) return PQ_TRUE;
+    if(!machine->err && machine->occurs_check == PQ_OCCURS_CHECK_ERROR)
+        machine->err = "occurs check error: a variable cannot be bound to a term that contains it.";
+    return PQ_FALSE;
+}
+
+//the word of switch_on_term that holds the code for each tag of A0: variable, constant, list or structure.
+static const uint8_t pq_machine_switch_words[8] = {
+    1, //PQ_TAG_REF
+    2, //PQ_TAG_ATOM
+    2, //PQ_TAG_INT
+    4, //PQ_TAG_STR
+    3, //PQ_TAG_LIST
+    2, //PQ_TAG_BOX
+    1, 1 //a functor or box header is never an argument.
+};
+
+/**
+ * @brief Runs the code from machine->p until the query halts.
+ * The registers are cached in locals, they are stored before a builtin is called and loaded after it returns.
+ *
+ * @param m The machine that will be used.
+ * @return The pq_machine_result.
+ */
+#if PQ_MACHINE_THREADED
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wpedantic" //the label addresses and the computed gotos are a GNU extension.
+#endif
+static pq_machine_result pq_machine_run(pq_machine* m)
+{
+    pq_code* P = m->p;
+    pq_term* H = m->h;
+    size_t TR = m->tr;
+    pq_frame* E = m->e;
+    pq_choice* B = m->b;
+    pq_choice* B0 = m->b0;
+    pq_code* CP = m->cp;
+    pq_term* HB = B->h; //the heap top of the last choice point, the older variables are trailed when they are bound.
+    pq_term* const X = m->x;
+    pq_term* S = NULL; //the next argument of the structure that is read.
+    PQbool write = PQ_FALSE; //whether the unify instructions build a structure instead of reading it.
+    pq_term built = PQ_TERM_NONE; //the structure that is built, a value that contains it would make it cyclic (see pq_occurs_check).
+    pq_code W; //the first word of the instruction.
+    pq_pred* pred = NULL;
+    pq_term t;
+
+#define PQ_A pq_wam_get_a(W)
+#define PQ_B pq_wam_get_b(W)
+#define PQ_SYNC() (m->p = P, m->h = H, m->tr = TR, m->e = E, m->b = B, m->b0 = B0, m->cp = CP)
+#define PQ_LOAD() (H = m->h, TR = m->tr, E = m->e, B = m->b, B0 = m->b0, CP = m->cp, HB = B->h)
+#define PQ_NEED_HEAP(n) if((size_t)(m->heap_end - H) < (size_t)(n)) goto heap_full
+#define PQ_BIND(cell, val) \
+    do { \
+        pq_term* bind_cell_ = (cell); \
+        *bind_cell_ = (val); \
+        if(bind_cell_ < HB) \
+        { \
+            if(TR >= m->trail_cap && pq_array_reserve((void**)&m->trail, &m->trail_cap, TR + 1, sizeof(pq_term*)) != PQ_SUCCESS) \
+                goto trail_full; \
+            m->trail[TR++] = bind_cell_; \
+        } \
+    } while(0)
+#define PQ_UNIFY(x, y) \
+    do { \
+        const pq_term unify_a_ = (x); \
+        const pq_term unify_b_ = (y); \
+        if(unify_a_ != unify_b_) \
+        { \
+            m->tr = TR; \
+            m->b = B; \
+            const PQbool unified_ = pq_machine_unify(m, unify_a_, unify_b_); \
+            TR = m->tr; \
+            if(!unified_) goto fail_or_error; \
+        } \
+    } while(0)
+#define PQ_CHECK_WRITE(val) \
+    do { \
+        if(m->occurs_check != PQ_OCCURS_CHECK_FALSE && built != PQ_TERM_NONE && !pq_machine_can_bind(m, built, (val), 0)) \
+            goto fail_or_error; \
+    } while(0)
+#define PQ_GET_CONSTANT(reg, c) \
+    do { \
+        t = pq_term_deref(reg); \
+        if(pq_term_is_var(t)) PQ_BIND(pq_term_get_ptr(t), c); \
+        else if(!pq_machine_same_constant(t, c)) goto fail; \
+    } while(0)
+#define PQ_NEW_VAR(dest) \
+    do { \
+        *H = pq_make_ptr_term(H, PQ_TAG_REF); \
+        dest = *H++; \
+    } while(0)
+
+#if PQ_MACHINE_THREADED
+    static const void* const labels[PQ_WAM_OPCODE_COUNT] = {
+  #define PQ_WAM_LABEL(id, name, size) &&L_##id,
+        PQ_WAM_INSTRUCTIONS(PQ_WAM_LABEL)
+  #undef PQ_WAM_LABEL
+    };
+  #define PQ_CASE(id) L_##id:
+  #define PQ_NEXT() do { W = *P; goto *labels[W & 0xFF]; } while(0)
+
+    PQ_NEXT();
+#else
+  #define PQ_CASE(id) case id:
+  #define PQ_NEXT() goto dispatch
+
+dispatch:
+    W = *P;
+    switch((int)pq_wam_get_op(W))
+    {
+#endif
+
+    /* head arguments */
+
+    PQ_CASE(PQ_WAM_GET_VARIABLE_X)
+        X[PQ_A] = X[PQ_B];
+        P += 1;
+        PQ_NEXT();
+
+    PQ_CASE(PQ_WAM_GET_VARIABLE_Y)
+        E->y[PQ_A] = X[PQ_B];
+        P += 1;
+        PQ_NEXT();
+
+    PQ_CASE(PQ_WAM_GET_VALUE_X)
+        PQ_UNIFY(X[PQ_A], X[PQ_B]);
+        P += 1;
+        PQ_NEXT();
+
+    PQ_CASE(PQ_WAM_GET_VALUE_Y)
+        PQ_UNIFY(E->y[PQ_A], X[PQ_B]);
+        P += 1;
+        PQ_NEXT();
+
+    PQ_CASE(PQ_WAM_GET_CONSTANT)
+        PQ_GET_CONSTANT(X[PQ_A], P[1]);
+        P += 2;
+        PQ_NEXT();
+
+    PQ_CASE(PQ_WAM_GET_NIL)
+        PQ_GET_CONSTANT(X[PQ_A], pq_new_atom_term(PQ_ATOM_NIL));
+        P += 1;
+        PQ_NEXT();
+
+    PQ_CASE(PQ_WAM_GET_STRUCTURE)
+    {
+        const pq_term functor = P[1];
+        t = pq_term_deref(X[PQ_A]);
+        if(pq_term_get_tag(t) == PQ_TAG_STR)
+        {
+            if(*pq_term_get_ptr(t) != functor) goto fail;
+            S = pq_term_get_ptr(t) + 1;
+            write = PQ_FALSE;
+        }
+        else if(pq_term_is_var(t))
+        {   //the arguments are written by the unify instructions.
+            PQ_NEED_HEAP(1 + ((functor & 0xFFFFFFFFu) >> PQ_TERM_TAG_BITS));
+            *H = functor;
+            built = pq_make_ptr_term(H, PQ_TAG_STR);
+            PQ_BIND(pq_term_get_ptr(t), built);
+            H++;
+            write = PQ_TRUE;
+        }
+        else goto fail;
+        P += 2;
+        PQ_NEXT();
+    }
+
+    PQ_CASE(PQ_WAM_GET_LIST)
+        t = pq_term_deref(X[PQ_A]);
+        if(pq_term_get_tag(t) == PQ_TAG_LIST)
+        {
+            S = pq_term_get_ptr(t);
+            write = PQ_FALSE;
+        }
+        else if(pq_term_is_var(t))
+        {
+            PQ_NEED_HEAP(2);
+            built = pq_make_ptr_term(H, PQ_TAG_LIST);
+            PQ_BIND(pq_term_get_ptr(t), built);
+            write = PQ_TRUE;
+        }
+        else goto fail;
+        P += 1;
+        PQ_NEXT();
+
+    /* call arguments */
+
+    PQ_CASE(PQ_WAM_PUT_VARIABLE_X)
+        PQ_NEED_HEAP(1);
+        PQ_NEW_VAR(X[PQ_A]);
+        X[PQ_B] = X[PQ_A];
+        P += 1;
+        PQ_NEXT();
+
+    PQ_CASE(PQ_WAM_PUT_VARIABLE_Y)
+        PQ_NEED_HEAP(1);
+        PQ_NEW_VAR(E->y[PQ_A]);
+        X[PQ_B] = E->y[PQ_A];
+        P += 1;
+        PQ_NEXT();
+
+    PQ_CASE(PQ_WAM_PUT_VALUE_X)
+        X[PQ_B] = X[PQ_A];
+        P += 1;
+        PQ_NEXT();
+
+    PQ_CASE(PQ_WAM_PUT_VALUE_Y)
+        X[PQ_B] = E->y[PQ_A];
+        P += 1;
+        PQ_NEXT();
+
+    PQ_CASE(PQ_WAM_PUT_CONSTANT)
+        X[PQ_A] = P[1];
+        P += 2;
+        PQ_NEXT();
+
+    PQ_CASE(PQ_WAM_PUT_NIL)
+        X[PQ_A] = pq_new_atom_term(PQ_ATOM_NIL);
+        P += 1;
+        PQ_NEXT();
+
+    PQ_CASE(PQ_WAM_PUT_STRUCTURE)
+    {
+        const pq_term functor = P[1];
+        PQ_NEED_HEAP(1 + ((functor & 0xFFFFFFFFu) >> PQ_TERM_TAG_BITS));
+        *H = functor;
+        X[PQ_A] = pq_make_ptr_term(H, PQ_TAG_STR);
+        H++;
+        write = PQ_TRUE;
+        built = PQ_TERM_NONE; //a new structure is not bound, it cannot be cyclic.
+        P += 2;
+        PQ_NEXT();
+    }
+
+    PQ_CASE(PQ_WAM_PUT_LIST)
+        PQ_NEED_HEAP(2);
+        X[PQ_A] = pq_make_ptr_term(H, PQ_TAG_LIST);
+        write = PQ_TRUE;
+        built = PQ_TERM_NONE;
+        P += 1;
+        PQ_NEXT();
+
+    /* arguments of a structure, the heap was reserved by the get or put instruction */
+
+    PQ_CASE(PQ_WAM_UNIFY_VARIABLE_X)
+        if(write) PQ_NEW_VAR(X[PQ_A]);
+        else X[PQ_A] = *S++;
+        P += 1;
+        PQ_NEXT();
+
+    PQ_CASE(PQ_WAM_UNIFY_VARIABLE_Y)
+        if(write) PQ_NEW_VAR(E->y[PQ_A]);
+        else E->y[PQ_A] = *S++;
+        P += 1;
+        PQ_NEXT();
+
+    PQ_CASE(PQ_WAM_UNIFY_VALUE_X)
+        if(write)
+        {
+            PQ_CHECK_WRITE(X[PQ_A]);
+            *H++ = X[PQ_A];
+        }
+        else
+        {
+            PQ_UNIFY(X[PQ_A], *S);
+            S++;
+        }
+        P += 1;
+        PQ_NEXT();
+
+    PQ_CASE(PQ_WAM_UNIFY_VALUE_Y)
+        if(write)
+        {
+            PQ_CHECK_WRITE(E->y[PQ_A]);
+            *H++ = E->y[PQ_A];
+        }
+        else
+        {
+            PQ_UNIFY(E->y[PQ_A], *S);
+            S++;
+        }
+        P += 1;
+        PQ_NEXT();
+
+    PQ_CASE(PQ_WAM_UNIFY_CONSTANT)
+        if(write) *H++ = P[1];
+        else PQ_GET_CONSTANT(*S++, P[1]);
+        P += 2;
+        PQ_NEXT();
+
+    PQ_CASE(PQ_WAM_UNIFY_NIL)
+        if(write) *H++ = pq_new_atom_term(PQ_ATOM_NIL);
+        else PQ_GET_CONSTANT(*S++, pq_new_atom_term(PQ_ATOM_NIL));
+        P += 1;
+        PQ_NEXT();
+
+    PQ_CASE(PQ_WAM_UNIFY_VOID)
+        if(write)
+        {
+            for(uint32_t i = 0; i < PQ_A; ++i, ++H) *H = pq_make_ptr_term(H, PQ_TAG_REF);
+        }
+        else S += PQ_A;
+        P += 1;
+        PQ_NEXT();
+
+    /* control */
+
+    PQ_CASE(PQ_WAM_ALLOCATE)
+    {
+        pq_term* top = pq_machine_stack_top(m, E, CP, B);
+        if((size_t)(m->stack_end - top) < PQ_MACHINE_FRAME_CELLS + PQ_A) goto stack_full;
+        pq_frame* frame = (pq_frame*)top;
+        frame->prev = E;
+        frame->cp = CP;
+        frame->size = PQ_A;
+        E = frame;
+        P += 1;
+        PQ_NEXT();
+    }
+
+    PQ_CASE(PQ_WAM_DEALLOCATE)
+        CP = E->cp;
+        E = E->prev;
+        P += 1;
+        PQ_NEXT();
+
+    PQ_CASE(PQ_WAM_CALL)
+        CP = P + 2;
+        pred = (pq_pred*)pq_wam_get_ptr(P[1]);
+        goto call;
+
+    PQ_CASE(PQ_WAM_EXECUTE)
+        pred = (pq_pred*)pq_wam_get_ptr(P[1]);
+        goto call;
+
+    PQ_CASE(PQ_WAM_PROCEED)
+        P = CP;
+        PQ_NEXT();
+
+    PQ_CASE(PQ_WAM_FAIL)
+        goto fail;
+
+    PQ_CASE(PQ_WAM_HALT)
+        PQ_SYNC();
+        return PQ_A ? PQ_MACHINE_TRUE : PQ_MACHINE_FAIL;
+
+    /* clause selection */
+
+    PQ_CASE(PQ_WAM_TRY)
+    {
+        pq_term* top = pq_machine_stack_top(m, E, CP, B);
+        if((size_t)(m->stack_end - top) < PQ_MACHINE_CHOICE_CELLS + PQ_A) goto stack_full;
+        pq_choice* choice = (pq_choice*)top;
+        choice->prev = B;
+        choice->alt = P + 2;
+        choice->h = H;
+        choice->tr = TR;
+        choice->e = E;
+        choice->cp = CP;
+        choice->arity = PQ_A;
+        memcpy(choice->args, X, PQ_A * sizeof(pq_term));
+        B = choice;
+        HB = H;
+        P = (pq_code*)pq_wam_get_ptr(P[1]);
+        PQ_NEXT();
+    }
+
+    PQ_CASE(PQ_WAM_RETRY)
+        B->alt = P + 2;
+        P = (pq_code*)pq_wam_get_ptr(P[1]);
+        PQ_NEXT();
+
+    PQ_CASE(PQ_WAM_TRUST)
+        B = B->prev;
+        HB = B->h;
+        P = (pq_code*)pq_wam_get_ptr(P[1]);
+        PQ_NEXT();
+
+    PQ_CASE(PQ_WAM_SWITCH_ON_TERM)
+        t = pq_term_deref(X[0]);
+        P = (pq_code*)pq_wam_get_ptr(P[pq_machine_switch_words[pq_term_get_tag(t)]]);
+        if(!P) goto fail;
+        PQ_NEXT();
+
+    PQ_CASE(PQ_WAM_SWITCH_ON_CONSTANT)
+        P = pq_wam_switch_lookup((const pq_code*)pq_wam_get_ptr(P[1]), pq_term_deref(X[0]));
+        if(!P) goto fail;
+        PQ_NEXT();
+
+    PQ_CASE(PQ_WAM_SWITCH_ON_STRUCTURE)
+        P = pq_wam_switch_lookup((const pq_code*)pq_wam_get_ptr(P[1]), *pq_term_get_ptr(pq_term_deref(X[0])));
+        if(!P) goto fail;
+        PQ_NEXT();
+
+    PQ_CASE(PQ_WAM_SWITCH_ON_ARGS)
+    {   //the first argument index narrows the call if it is selective and A0 is bound, else the jit indexes may narrow it.
+        pq_code* code;
+        if((PQ_A && !pq_term_is_var(pq_term_deref(X[0])))
+            || !pq_database_jit_select(m->db, (pq_pred*)pq_wam_get_ptr(P[1]), X, &code))
+        {
+            P += 2;
+            PQ_NEXT();
+        }
+        P = code;
+        if(!P) goto fail;
+        PQ_NEXT();
+    }
+
+    /* cut, a level is the offset of a choice point from the stack */
+
+    PQ_CASE(PQ_WAM_NECK_CUT)
+        if(B > B0)
+        {
+            B = B0;
+            HB = B->h;
+        }
+        P += 1;
+        PQ_NEXT();
+
+    PQ_CASE(PQ_WAM_GET_LEVEL_X)
+        X[PQ_A] = (pq_term)((char*)B0 - (char*)m->stack) << PQ_TERM_TAG_BITS | PQ_TAG_INT;
+        P += 1;
+        PQ_NEXT();
+
+    PQ_CASE(PQ_WAM_GET_LEVEL_Y)
+        E->y[PQ_A] = (pq_term)((char*)B0 - (char*)m->stack) << PQ_TERM_TAG_BITS | PQ_TAG_INT;
+        P += 1;
+        PQ_NEXT();
+
+    PQ_CASE(PQ_WAM_CUT_X)
+        t = X[PQ_A];
+        goto cut;
+
+    PQ_CASE(PQ_WAM_CUT_Y)
+        t = E->y[PQ_A];
+        goto cut;
+
+    /* superinstructions */
+
+    PQ_CASE(PQ_WAM_GET_LIST_X_X)
+        t = pq_term_deref(X[PQ_A]);
+        if(pq_term_get_tag(t) == PQ_TAG_LIST)
+        {
+            X[PQ_B & 0xFFFF] = pq_term_get_ptr(t)[0];
+            X[PQ_B >> 16] = pq_term_get_ptr(t)[1];
+        }
+        else if(pq_term_is_var(t))
+        {
+            PQ_NEED_HEAP(2);
+            PQ_BIND(pq_term_get_ptr(t), pq_make_ptr_term(H, PQ_TAG_LIST));
+            PQ_NEW_VAR(X[PQ_B & 0xFFFF]);
+            PQ_NEW_VAR(X[PQ_B >> 16]);
+        }
+        else goto fail;
+        P += 1;
+        PQ_NEXT();
+
+    PQ_CASE(PQ_WAM_UNIFY_VARIABLE_X_X)
+        if(write)
+        {
+            PQ_NEW_VAR(X[PQ_A]);
+            PQ_NEW_VAR(X[PQ_B]);
+        }
+        else
+        {
+            X[PQ_A] = S[0];
+            X[PQ_B] = S[1];
+            S += 2;
+        }
+        P += 1;
+        PQ_NEXT();
+
+    PQ_CASE(PQ_WAM_UNIFY_VALUE_VARIABLE_X)
+        if(write)
+        {
+            PQ_CHECK_WRITE(X[PQ_A]);
+            *H++ = X[PQ_A];
+            PQ_NEW_VAR(X[PQ_B]);
+        }
+        else
+        {
+            PQ_UNIFY(X[PQ_A], *S);
+            X[PQ_B] = S[1];
+            S += 2;
+        }
+        P += 1;
+        PQ_NEXT();
+
+    PQ_CASE(PQ_WAM_PUT_VALUE_X_X)
+        X[PQ_B] = X[PQ_A];
+        X[P[1] >> 32] = X[P[1] & 0xFFFFFFFFu];
+        P += 2;
+        PQ_NEXT();
+
+#if !PQ_MACHINE_THREADED
+    default:
+        m->err = "system error: unknown instruction.";
+        goto error;
+    }
+#endif
+
+call:
+    m->inferences++;
+    B0 = B;
+    if(H >= m->gc.limit)
+    {   //a call is a safe point, the live registers are its arguments.
+        PQ_SYNC();
+        if(pq_machine_gc(m, pred->arity) != PQ_SUCCESS) goto error;
+        PQ_LOAD();
+    }
+    if(pred->builtin)
+    {
+        PQ_SYNC();
+        m->jump = NULL;
+        switch(pred->builtin(m, X))
+        {
+        case PQ_BUILTIN_TRUE:
+            PQ_LOAD();
+            P = CP;
+            PQ_NEXT();
+        case PQ_BUILTIN_JUMP:
+            PQ_LOAD();
+            pred = m->jump;
+            goto call;
+        default:
+            PQ_LOAD();
+            if(m->halted) return PQ_MACHINE_HALT;
+            goto fail_or_error;
+        }
+    }
+    P = pq_database_get_entry(m->db, pred);
+    if(!P)
+    {
+        if(pred->clauses_sz) m->err = "resource error: not enough memory for the predicate.";
+        else pq_machine_set_pred_error(m, "existence error: unknown procedure %s/%u.", pred->name, pred->arity);
+        goto error;
+    }
+    PQ_NEXT();
+
+cut:
+{
+    pq_choice* level = (pq_choice*)((char*)m->stack + (t >> PQ_TERM_TAG_BITS));
+    if(B > level)
+    {
+        B = level;
+        HB = B->h;
+    }
+    P += 1;
+    PQ_NEXT();
+}
+
+fail_or_error:
+    if(m->err) goto error;
+fail:
+    H = B->h;
+    while(TR > B->tr)
+    {
+        pq_term* cell = m->trail[--TR];
+        *cell = pq_make_ptr_term(cell, PQ_TAG_REF);
+    }
+    E = B->e;
+    CP = B->cp;
+    B0 = B->prev;
+    memcpy(X, B->args, B->arity * sizeof(pq_term));
+    HB = H;
+    P = B->alt;
+    PQ_NEXT();
+
+heap_full:
+    m->err = "resource error: the heap is full.";
+    goto error;
+stack_full:
+    m->err = "resource error: the stack is full.";
+    goto error;
+trail_full:
+    m->err = "resource error: the trail is full.";
+error:
+    PQ_SYNC();
+    return PQ_MACHINE_ERROR;
+
+#undef PQ_A
+#undef PQ_B
+#undef PQ_SYNC
+#undef PQ_LOAD
+#undef PQ_NEED_HEAP
+#undef PQ_BIND
+#undef PQ_UNIFY
+#undef PQ_CHECK_WRITE
+#undef PQ_GET_CONSTANT
+#undef PQ_NEW_VAR
+#undef PQ_CASE
+#undef PQ_NEXT
+}
+#if PQ_MACHINE_THREADED
+  #pragma GCC diagnostic pop
+#endif
+
+pq_machine_result pq_machine_solve(pq_machine* machine, const pq_term goal, const pq_term* vars, const uint32_t vars_sz)
+{
+    machine->err = NULL;
+    machine->halted = PQ_FALSE;
+    if(!machine->depth)
+    {   //nothing is running, the memory areas are emptied.
+        machine->h = machine->heap;
+        machine->tr = 0;
+        machine->e = NULL;
+        machine->b = NULL;
+        pq_machine_set_gc_policy(machine, machine->gc.min, machine->gc.growth);
+    }
+
+    //the frame below the query saves the registers of the outer query, they are restored by pq_machine_end_query.
+    pq_term* top = pq_machine_stack_top(machine, machine->e, machine->cp, machine->b);
+    if((size_t)(machine->stack_end - top) < PQ_MACHINE_FRAME_CELLS + PQ_MACHINE_BASE_SIZE + PQ_MACHINE_CHOICE_CELLS)
+    {
+        machine->err = "resource error: the stack is full.";
+        return PQ_MACHINE_ERROR;
+    }
+    if((size_t)(machine->heap_end - machine->h) < vars_sz)
+    {
+        machine->err = "resource error: the heap is full.";
+        return PQ_MACHINE_ERROR;
+    }
+    pq_frame* frame = (pq_frame*)top;
+    pq_choice* base = (pq_choice*)((pq_term*)frame->y + PQ_MACHINE_BASE_SIZE);
+    frame->prev = machine->e;
+    frame->cp = NULL;
+    frame->size = PQ_MACHINE_BASE_SIZE;
+    frame->y[0] = (pq_term)(uintptr_t)machine->cp;
+    frame->y[1] = (pq_term)(uintptr_t)machine->b0;
+    frame->y[2] = (pq_term)(uintptr_t)machine->base;
+    frame->y[3] = (pq_term)(uintptr_t)machine->answers;
+    frame->y[4] = (pq_term)(uintptr_t)machine->p;
+    frame->y[5] = (pq_term)machine->tables->stack_sz;
+    frame->y[6] = (pq_term)machine->answers_sz;
+
+    base->prev = machine->b;
+    base->alt = (pq_code*)pq_machine_halt_fail;
+    base->h = machine->h;
+    base->tr = machine->tr;
+    base->e = frame;
+    base->cp = (pq_code*)pq_machine_halt_true;
+    base->arity = 0;
+
+    machine->e = frame;
+    machine->b = base;
+    machine->b0 = base;
+    machine->base = base;
+    machine->cp = (pq_code*)pq_machine_halt_true;
+    machine->answers = machine->h;
+    machine->answers_sz = vars_sz;
+    machine->depth++;
+
+    //the query predicate of a nested query must not replace the one that is running.
+    pq_atom name = PQ_ATOM_QUERY_PRED;
+    if(machine->depth > 1)
+    {
+        char buffer[32];
+        snprintf(buffer, sizeof(buffer), "$query%u", machine->depth);
+        name = pq_atom_intern(pq_make_lexeme(buffer, strlen(buffer)));
+    }
+    pq_pred* pred = name != PQ_ATOM_NONE ? pq_compiler_add_query(machine->compiler, name, goal, vars, vars_sz) : NULL;
+    if(!pred)
+    {
+        machine->err = machine->compiler->err ? machine->compiler->err : "resource error: not enough memory for the query.";
+        return PQ_MACHINE_ERROR;
+    }
+    machine->p = pq_database_get_entry(machine->db, pred);
+    if(!machine->p)
+    {
+        machine->err = "resource error: not enough memory for the query.";
+        return PQ_MACHINE_ERROR;
+    }
+
+    for(uint32_t i = 0; i < vars_sz; ++i) machine->x[i] = pq_machine_new_var(machine);
+    return pq_machine_run(machine);
+}
+
+pq_machine_result pq_machine_redo(pq_machine* machine)
+{
+    if(!machine->depth || machine->b == machine->base) return PQ_MACHINE_FAIL;
+
+    machine->err = NULL;
+    machine->p = (pq_code*)pq_machine_redo_code;
+    return pq_machine_run(machine);
+}
+
+void pq_machine_end_query(pq_machine* machine)
+{
+    if(!machine->depth) return;
+
+    pq_choice* base = machine->base;
+    while(machine->tr > base->tr)
+    {
+        pq_term* cell = machine->trail[--machine->tr];
+        *cell = pq_make_ptr_term(cell, PQ_TAG_REF);
+    }
+    machine->h = base->h;
+
+    const pq_frame* frame = base->e;
+    machine->e = frame->prev;
+    machine->b = base->prev;
+    machine->cp = (pq_code*)(uintptr_t)frame->y[0];
+    machine->b0 = (pq_choice*)(uintptr_t)frame->y[1];
+    machine->base = (pq_choice*)(uintptr_t)frame->y[2];
+    machine->answers = (pq_term*)(uintptr_t)frame->y[3];
+    machine->p = (pq_code*)(uintptr_t)frame->y[4];
+    machine->answers_sz = (uint32_t)frame->y[6];
+    pq_table_space_reset(machine->tables, (size_t)frame->y[5]); //the evaluations that the query started were stopped by an error.
+    if(!--machine->depth) pq_database_free_retired(machine->db);
+}
+
+PQbool pq_machine_unify(pq_machine* machine, const pq_term a, const pq_term b)
+{
+    //the pairs of arguments that are left are on the scratch stack, the first pair is unified without it.
+    pq_term x = pq_term_deref(a);
+    pq_term y = pq_term_deref(b);
+    size_t sz = 0;
+    for(;;)
+    {
+        if(x == y) goto next;
+
+        //the younger variable is bound to the older one, so fewer bindings are trailed.
+        if(pq_term_is_var(x) && (!pq_term_is_var(y) || pq_term_get_ptr(y) < pq_term_get_ptr(x)))
+        {
+            const pq_term var = x;
+            x = y;
+            y = var;
+        }
+        if(pq_term_is_var(y))
+        {
+            if(pq_term_is_compound(x) && !pq_machine_can_bind(machine, y, x, sz)) return PQ_FALSE;
+            if(pq_machine_bind(machine, pq_term_get_ptr(y), x) != PQ_SUCCESS) return PQ_FALSE;
+            goto next;
+        }
+
+        const pq_term_tag tag = pq_term_get_tag(x);
+        if(tag != pq_term_get_tag(y)) return PQ_FALSE;
+        switch(tag)
+        {
+        case PQ_TAG_BOX:
+            if(!pq_machine_same_constant(x, y)) return PQ_FALSE;
+            goto next;
+
+        case PQ_TAG_LIST:
+        case PQ_TAG_STR:
+        {
+            const uint32_t arity = pq_term_get_arity(x);
+            if(tag == PQ_TAG_STR && *pq_term_get_ptr(x) != *pq_term_get_ptr(y)) return PQ_FALSE;
+            if(pq_machine_reserve_pdl(machine, sz + 2 * (size_t)arity) != PQ_SUCCESS) return PQ_FALSE;
+
+            //the arguments after the first are pushed in reverse, so a list is unified with a constant stack.
+            const pq_term* xs = pq_term_get_args(x);
+            const pq_term* ys = pq_term_get_args(y);
+            for(uint32_t i = arity; i-- > 1;)
+            {
+                machine->pdl[sz++] = xs[i];
+                machine->pdl[sz++] = ys[i];
+            }
+            x = pq_term_deref(xs[0]);
+            y = pq_term_deref(ys[0]);
+            continue;
+        }
+
+        default: //atoms and small integers are identical only if their cells are.
+            return PQ_FALSE;
+        }
+
+    next:
+        if(!sz) return PQ_TRUE;
+        y = pq_term_deref(machine->pdl[--sz]);
+        x = pq_term_deref(machine->pdl[--sz]);
+    }
+}
+
+/**
+ * @brief Gets the class of a term in the standard order of terms.
+ *
+ * @param term The dereferenced term.
+ * @return 0 for a variable, 1 for a number, 2 for an atom, 3 for a compound.
+ */
+static inline int pq_machine_order_class(const pq_term term)
+{
+    switch(pq_term_get_tag(term))
+    {
+    case PQ_TAG_REF: return 0;
+    case PQ_TAG_INT:
+    case PQ_TAG_BOX: return 1;
+    case PQ_TAG_ATOM: return 2;
+    default: return 3;
+    }
+}
+
+/**
+ * @brief Compares two numbers by their value, a float is before an integer of the same value.
+ *
+ * @param a The first number.
+ * @param b The second number.
+ * @return -1, 0, or 1.
+ */
+static int pq_machine_compare_numbers(const pq_term a, const pq_term b)
+{
+    const PQbool a_int = pq_term_is_integer(a);
+    const PQbool b_int = pq_term_is_integer(b);
+    if(a_int && b_int)
+    {
+        if(pq_term_is_bigint(a) || pq_term_is_bigint(b)) return pq_bigint_compare_terms(a, b);
+        const PQint x = pq_term_get_int(a);
+        const PQint y = pq_term_get_int(b);
+        return x < y ? -1 : x > y;
+    }
+
+    const PQflt x = a_int ? pq_bigint_term_to_float(a) : pq_term_get_float(a);
+    const PQflt y = b_int ? pq_bigint_term_to_float(b) : pq_term_get_float(b);
+    if(x != y) return x < y ? -1 : 1;
+    return a_int == b_int ? 0 : (a_int ? 1 : -1);
+}
+
+/**
+ * @brief Compares the names of two atoms by their bytes.
+ *
+ * @param a The first atom.
+ * @param b The second atom.
+ * @return A negative number, 0, or a positive number.
+ */
+static int pq_machine_compare_names(const pq_atom a, const pq_atom b)
+{
+    if(a == b) return 0;
+
+    const pq_lexeme x = pq_atom_get_name(a);
+    const pq_lexeme y = pq_atom_get_name(b);
+    const int diff = memcmp(x.str, y.str, x.len < y.len ? x.len : y.len);
+    if(diff) return diff;
+    return x.len < y.len ? -1 : x.len > y.len;
+}
+
+int pq_machine_compare(pq_machine* machine, const pq_term a, const pq_term b)
+{
+    size_t sz = 0;
+    if(pq_machine_reserve_pdl(machine, 2) != PQ_SUCCESS) return 0;
+    machine->pdl[sz++] = a;
+    machine->pdl[sz++] = b;
+
+    while(sz)
+    {
+        const pq_term y = pq_term_deref(machine->pdl[--sz]);
+        const pq_term x = pq_term_deref(machine->pdl[--sz]);
+        if(x == y) continue;
+
+        const int x_class = pq_machine_order_class(x);
+        const int y_class = pq_machine_order_class(y);
+        if(x_class != y_class) return x_class < y_class ? -1 : 1;
+
+        int diff = 0;
+        switch(x_class)
+        {
+        case 0: //variables are ordered by age.
+            diff = pq_term_get_ptr(x) < pq_term_get_ptr(y) ? -1 : 1;
+            break;
+        case 1:
+            diff = pq_machine_compare_numbers(x, y);
+            break;
+        case 2:
+            diff = pq_machine_compare_names(pq_term_get_atom(x), pq_term_get_atom(y));
+            break;
+        default:
+        {   //compounds are ordered by arity, then name, then arguments from left to right.
+            const uint32_t arity = pq_term_get_arity(x);
+            if(arity != pq_term_get_arity(y)) return arity < pq_term_get_arity(y) ? -1 : 1;
+            diff = pq_machine_compare_names(pq_term_get_name(x), pq_term_get_name(y));
+            if(diff) break;
+            if(pq_machine_reserve_pdl(machine, sz + 2 * (size_t)arity) != PQ_SUCCESS) return 0;
+
+            const pq_term* xs = pq_term_get_args(x);
+            const pq_term* ys = pq_term_get_args(y);
+            for(uint32_t i = arity; i-- > 0;)
+            {
+                machine->pdl[sz++] = xs[i];
+                machine->pdl[sz++] = ys[i];
+            }
+            break;
+        }
+        }
+        if(diff) return diff < 0 ? -1 : 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Checks if a goal is a control construct, which must be compiled to be called.
+ *
+ * @param goal The dereferenced goal.
+ * @return true if the goal is a control construct else false.
+ */
+static PQbool pq_machine_is_control(const pq_term goal)
+{
+    if(pq_term_is_atom(goal)) return pq_term_get_atom(goal) == PQ_ATOM_CUT;
+    if(pq_term_get_tag(goal) != PQ_TAG_STR) return PQ_FALSE;
+
+    const pq_atom name = pq_term_get_name(goal);
+    const uint32_t arity = pq_term_get_arity(goal);
+    return (arity == 2 && (name == PQ_ATOM_COMMA || name == PQ_ATOM_SEMICOLON || name == PQ_ATOM_IF_THEN))
+        || (arity == 1 && name == PQ_ATOM_NOT_PROVABLE);
+}
+
+/**
+ * @brief Writes the shape of a goal in pre-order into machine->shape, and its variables into machine->pdl.
+ * A variable is written as PQ_TERM_NONE followed by its index, a list cell as a list tag without a pointer,
+ * a compound as its functor cell, and a boxed constant as its cells. The shape of two goals is the same only if
+ * they are the same up to the renaming of their variables.
+ * The variable cells are marked while the goal is walked, they are restored before returning.
+ *
+ * @param machine The machine that will be modified, upon failure the error is stored here.
+ * @param goal The goal.
+ * @param shape_sz The number of cells of the shape.
+ * @param vars_sz The number of variables.
+ * @return PQ_SUCCESS if the shape was written else PQ_FAILURE.
+ */
+static int pq_machine_get_shape(pq_machine* machine, const pq_term goal, size_t* shape_sz, uint32_t* vars_sz)
+{
+    //the variables are stored at the bottom of the scratch stack, the work stack is on top of them.
+    size_t work_sz = 0;
+    size_t marked_sz = 0;
+    size_t sz = 0;
+    int status = PQ_SUCCESS;
+    pq_term* work = NULL;
+    size_t work_cap = 0;
+
+    if(pq_array_reserve((void**)&work, &work_cap, 1, sizeof(pq_term)) != PQ_SUCCESS) status = PQ_FAILURE;
+    else work[work_sz++] = goal;
+
+    while(work_sz && status == PQ_SUCCESS)
+    {
+        const pq_term term = pq_term_deref(work[--work_sz]);
+        const pq_term_tag tag = pq_term_get_tag(term);
+        const uint32_t arity = pq_term_get_arity(term);
+        if(pq_array_reserve((void**)&machine->shape, &machine->shape_cap, sz + 3, sizeof(pq_term)) != PQ_SUCCESS
+            || pq_array_reserve((void**)&work, &work_cap, work_sz + arity, sizeof(pq_term)) != PQ_SUCCESS)
+        {
+            status = PQ_FAILURE;
+            break;
+        }
+
+        switch(tag)
+        {
+        case PQ_TAG_REF:
+            if(pq_array_reserve((void**)&machine->marked, &machine->marked_cap, marked_sz + 1, sizeof(pq_term*)) != PQ_SUCCESS
+                || pq_machine_reserve_pdl(machine, marked_sz + 1) != PQ_SUCCESS)
+            {
+                status = PQ_FAILURE;
+                break;
+            }
+            //the cell is marked with the index of the variable, a marked cell is not dereferenced past.
+            machine->pdl[marked_sz] = term;
+            machine->marked[marked_sz] = pq_term_get_ptr(term);
+            *pq_term_get_ptr(term) = (pq_term)marked_sz << 32 | PQ_TAG_FUNCTOR;
+            machine->shape[sz++] = PQ_TERM_NONE;
+            machine->shape[sz++] = (pq_term)marked_sz++;
+            break;
+        case PQ_TAG_FUNCTOR: //a marked variable.
+            machine->shape[sz++] = PQ_TERM_NONE;
+            machine->shape[sz++] = term >> 32;
+            break;
+        case PQ_TAG_BOX:
+        {
+            const size_t n = (size_t)(*pq_term_get_ptr(term) >> 32) + 1;
+            if(pq_array_reserve((void**)&machine->shape, &machine->shape_cap, sz + n, sizeof(pq_term)) != PQ_SUCCESS)
+            {
+                status = PQ_FAILURE;
+                break;
+            }
+            memcpy(&machine->shape[sz], pq_term_get_ptr(term), n * sizeof(pq_term));
+            sz += n;
+            break;
+        }
+        case PQ_TAG_LIST:
+        case PQ_TAG_STR:
+        {
+            machine->shape[sz++] = tag == PQ_TAG_LIST ? (pq_term)PQ_TAG_LIST : *pq_term_get_ptr(term);
+            const pq_term* args = pq_term_get_args(term);
+            for(uint32_t i = arity; i-- > 0;) work[work_sz++] = args[i];
+            break;
+        }
+        default:
+            machine->shape[sz++] = term;
+            break;
+        }
+    }
+
+    for(size_t i = 0; i < marked_sz; ++i) *machine->marked[i] = pq_make_ptr_term(machine->marked[i], PQ_TAG_REF);
+    free(work);
+    if(status != PQ_SUCCESS)
+    {
+        machine->err = "resource error: not enough memory for the goal.";
+        return PQ_FAILURE;
+    }
+    if(marked_sz > PQ_WAM_REGISTERS)
+    {
+        machine->err = "resource error: the goal has too many variables.";
+        return PQ_FAILURE;
+    }
+    *shape_sz = sz;
+    *vars_sz = (uint32_t)marked_sz;
+    return PQ_SUCCESS;
+}
+
+/**
+ * @brief Finds or compiles the predicate of a control construct for call/N, the predicates are cached by the shape of the goal.
+ *
+ * @param machine The machine that will be modified, upon failure the error is stored here.
+ * @param goal The control construct.
+ * @param vars_sz The number of variables of the goal, they are stored in machine->pdl in the order of the arguments of the predicate.
+ * @return The predicate, NULL upon failure.
+ */
+static pq_pred* pq_machine_get_call_pred(pq_machine* machine, const pq_term goal, uint32_t* vars_sz)
+{
+    size_t shape_sz;
+    if(pq_machine_get_shape(machine, goal, &shape_sz, vars_sz) != PQ_SUCCESS) return NULL;
+
+    const uint32_t hash = pq_atom_hash(pq_make_lexeme((const char*)machine->shape, shape_sz * sizeof(pq_term))) | 1;
+    if(machine->calls)
+    {
+        for(uint32_t slot = hash & machine->calls_mask; machine->calls[slot].hash; slot = (slot + 1) & machine->calls_mask)
+        {
+            const pq_call_entry* entry = &machine->calls[slot];
+            if(entry->hash == hash && entry->shape_sz == shape_sz && !memcmp(entry->shape, machine->shape, shape_sz * sizeof(pq_term)))
+                return entry->pred;
+        }
+    }
+
+    if(!machine->calls || (machine->calls_count + 1) * 4 > (machine->calls_mask + 1) * 3)
+    {   //keeps the load factor at most 3/4.
+        const uint32_t count = machine->calls ? (machine->calls_mask + 1) * 2 : 64;
+        pq_call_entry* calls = (pq_call_entry*)calloc(count, sizeof(pq_call_entry));
+        if(!calls)
+        {
+            machine->err = "resource error: not enough memory for the goal.";
+            return NULL;
+        }
+        for(uint32_t i = 0; machine->calls && i <= machine->calls_mask; ++i)
+        {
+            if(!machine->calls[i].hash) continue;
+            uint32_t slot = machine->calls[i].hash & (count - 1);
+            while(calls[slot].hash) slot = (slot + 1) & (count - 1);
+            calls[slot] = machine->calls[i];
+        }
+        free(machine->calls);
+        machine->calls = calls;
+        machine->calls_mask = count - 1;
+    }
+
+    pq_term* shape = (pq_term*)malloc(shape_sz * sizeof(pq_term));
+    char name[32];
+    snprintf(name, sizeof(name), "$call%u", machine->calls_sz++);
+    const pq_atom atom = pq_atom_intern(pq_make_lexeme(name, strlen(name)));
+    pq_pred* pred = shape && atom != PQ_ATOM_NONE ? pq_compiler_add_query(machine->compiler, atom, goal, machine->pdl, *vars_sz) : NULL;
+    if(!pred)
+    {
+        free(shape);
+        machine->err = machine->compiler->err ? machine->compiler->err : "resource error: not enough memory for the goal.";
+        return NULL;
+    }
+
+    memcpy(shape, machine->shape, shape_sz * sizeof(pq_term));
+    uint32_t slot = hash & machine->calls_mask;
+    while(machine->calls[slot].hash) slot = (slot + 1) & machine->calls_mask;
+    machine->calls[slot].shape = shape;
+    machine->calls[slot].shape_sz = (uint32_t)shape_sz;
+    machine->calls[slot].hash = hash;
+    machine->calls[slot].pred = pred;
+    machine->calls_count++;
+    return pred;
+}
+
+pq_builtin_result pq_machine_call(pq_machine* machine, pq_term goal, const pq_term* extra, const uint32_t extra_sz)
+{
+    goal = pq_term_deref(goal);
+    if(pq_term_is_var(goal))
+    {
+        machine->err = "instantiation error: the goal is unbound.";
+        return PQ_BUILTIN_FAIL;
+    }
+    if(!pq_term_is_atom(goal) && !pq_term_is_compound(goal))
+    {
+        machine->err = "type error: the goal is not callable.";
+        return PQ_BUILTIN_FAIL;
+    }
+
+    const pq_atom name = pq_term_get_name(goal);
+    const uint32_t arity = pq_term_get_arity(goal);
+    if(extra_sz)
+    {   //the goal is rebuilt with the extra arguments appended.
+        if(arity + extra_sz > PQ_WAM_REGISTERS)
+        {
+            machine->err = "representation error: the goal has too many arguments.";
+            return PQ_BUILTIN_FAIL;
+        }
+        pq_term* cells = pq_machine_alloc(machine, 1 + (size_t)arity + extra_sz);
+        if(!cells) return PQ_BUILTIN_FAIL;
+        cells[0] = pq_make_functor_cell(name, arity + extra_sz);
+        if(arity) memcpy(cells + 1, pq_term_get_args(goal), arity * sizeof(pq_term));
+        memcpy(cells + 1 + arity, extra, extra_sz * sizeof(pq_term));
+        goal = pq_make_ptr_term(cells, PQ_TAG_STR);
+    }
+
+    if(pq_machine_is_control(goal))
+    {
+        uint32_t vars_sz;
+        machine->jump = pq_machine_get_call_pred(machine, goal, &vars_sz);
+        if(!machine->jump) return PQ_BUILTIN_FAIL;
+        if(vars_sz) memcpy(machine->x, machine->pdl, vars_sz * sizeof(pq_term));
+        return PQ_BUILTIN_JUMP;
+    }
+
+    machine->jump = pq_database_get_pred(machine->db, name, arity + extra_sz);
+    if(!machine->jump)
+    {
+        machine->err = "resource error: not enough memory for the predicate.";
+        return PQ_BUILTIN_FAIL;
+    }
+    if(arity + extra_sz) memmove(machine->x, pq_term_get_args(goal), (arity + extra_sz) * sizeof(pq_term));
+    return PQ_BUILTIN_JUMP;
+}
+
+/**
+ * @brief Runs a directive of a consulted text, its errors and failure are written as warnings.
+ *
+ * @param machine The machine that will be modified.
+ * @param goal The goal of the directive.
+ */
+static void pq_machine_run_directive(pq_machine* machine, const pq_term goal)
+{
+    const pq_machine_result result = pq_machine_solve(machine, goal, NULL, 0);
+    if(result == PQ_MACHINE_ERROR)
+    {
+        pq_machine_print(machine, "warning: the directive raised an error, ");
+        pq_machine_print(machine, machine->err);
+        pq_machine_print(machine, "\n");
+    }
+    else if(result == PQ_MACHINE_FAIL) pq_machine_print(machine, "warning: the directive failed.\n");
+    pq_machine_end_query(machine);
+    if(result == PQ_MACHINE_HALT) machine->halted = PQ_TRUE;
+    machine->err = NULL;
+}
+
+/**
+ * @brief Compiles the clauses of the input of a parser, the directives are run when they are read.
+ * A clause with a syntax error is reported with its position and skipped up to its end token, the following clauses are still read.
+ *
+ * @param machine The machine that will be modified.
+ * @param parser The parser, its input is set.
+ * @param name The name of the input in the syntax errors (e.g. the path of the file).
+ * @return PQ_SUCCESS, the input was consulted.
+ */
+static int pq_machine_consult(pq_machine* machine, pq_parser* parser, const char* name)
+{
+    const uint32_t consult = ++machine->consults;
+    if(!machine->tables->stack_sz) pq_table_space_clear(machine->tables); //the answers can change with the clauses.
+    pq_term clause;
+    while(!machine->halted)
+    {
+        clause = pq_parser_next_clause(parser);
+        if(parser->err)
+        {   //file:line:column: message, like a compiler.
+            snprintf(machine->err_buffer, sizeof(machine->err_buffer), "%s:%lu:%lu: %s\n", name,
+                (unsigned long)parser->scanner->tok_ln, (unsigned long)parser->scanner->tok_col, parser->err);
+            pq_machine_print(machine, machine->err_buffer);
+            pq_parser_skip_clause(parser);
+            pq_parser_clear_terms(parser);
+            continue;
+        }
+        if(clause == PQ_TERM_NONE) break;
+
+        clause = pq_term_deref(clause);
+        const pq_atom name = pq_term_get_name(clause);
+        const uint32_t arity = pq_term_get_arity(clause);
+        if(pq_term_get_tag(clause) == PQ_TAG_STR && arity == 1 && (name == PQ_ATOM_NECK || name == PQ_ATOM_QUERY))
+        {
+            if(!pq_machine_is_parser_directive(clause)) pq_machine_run_directive(machine, pq_term_deref(pq_term_get_arg(clause, 0)));
+        }
+        else
+        {   //the first clause of a predicate replaces the clauses of an earlier consult (e.g. the library, or the file consulted again).
+            const pq_term head = arity == 2 && name == PQ_ATOM_NECK ? pq_term_deref(pq_term_get_arg(clause, 0)) : clause;
+            pq_pred* pred = pq_term_is_atom(head) || pq_term_is_compound(head)
+                ? pq_database_lookup(machine->db, pq_term_get_name(head), pq_term_get_arity(head)) : NULL;
+            if(pred && pred->tabled) pred = pred->tabled;
+            if(pred && pred->consult != consult && pred->clauses_sz && !pred->builtin)
+                pq_database_clear_pred(machine->db, pred);
+            if(pq_compiler_add_clause(machine->compiler, clause) != PQ_SUCCESS)
+            {
+                pq_machine_print(machine, "warning: the clause was skipped, ");
+                pq_machine_print(machine, machine->compiler->err);
+                pq_machine_print(machine, "\n");
+            }
+            else if(pred || (pred = pq_database_lookup(machine->db, pq_term_get_name(head), pq_term_get_arity(head))))
+                pred->consult = consult;
+        }
+        pq_parser_clear_terms(parser);
+    }
+    return PQ_SUCCESS;
+}
+
+/**
+ * @brief Maps a source file, the ".pl" extension is added to the path if the file cannot be read as named.
+ *
+ * @param file The mapped file will be stored here.
+ * @param path The path of the file, with or without its extension.
+ * @return PQ_SUCCESS if the file was mapped else PQ_FAILURE.
+ */
+static int pq_machine_map_source(pq_mapped_file* file, const char* path)
+{
+    if(pq_map_file(file, path) == PQ_SUCCESS) return PQ_SUCCESS;
+
+    const size_t len = strlen(path);
+    char* with_ext = (char*)malloc(len + 4);
+    if(!with_ext) return PQ_FAILURE;
+    memcpy(with_ext, path, len);
+    memcpy(with_ext + len, ".pl", 4);
+    const int status = pq_map_file(file, with_ext);
+    free(with_ext);
+    return status;
+}
+
+int pq_machine_consult_file(pq_machine* machine, const char* path)
+{
+    pq_mapped_file file;
+    if(pq_machine_map_source(&file, path) != PQ_SUCCESS)
+    {
+        machine->err = "existence error: could not read the file.";
+        return PQ_FAILURE;
+    }
+
+    //a parser per file, so a directive can consult another file.
+    pq_parser* parser = pq_new_parser();
+    if(!parser)
+    {
+        pq_unmap_file(&file);
+        machine->err = "resource error: not enough memory for the parser.";
+        return PQ_FAILURE;
+    }
+    pq_parser_share_ops(parser, machine->ops);
+    pq_scanner_set_buffer_view(parser->scanner, file.buffer, file.buffer_sz);
+    const int status = pq_machine_consult(machine, parser, path);
+    pq_del_parser(parser);
+    pq_unmap_file(&file);
+    return status;
+}
+
+int pq_machine_consult_text(pq_machine* machine, const char* text)
+{
+    pq_parser* parser = pq_new_parser();
+    if(!parser)
+    {
+        machine->err = "resource error: not enough memory for the parser.";
+        return PQ_FAILURE;
+    }
+    pq_parser_share_ops(parser, machine->ops);
+    pq_scanner_set_buffer_view(parser->scanner, text, strlen(text));
+    const int status = pq_machine_consult(machine, parser, "text");
+    pq_del_parser(parser);
+    return status;
+}
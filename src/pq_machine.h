@@ -0,0 +1,504 @@
+/**
+ * @file pq_machine.h
+ * @author Brandon Foster
+ * @brief poqer-lang abstract machine header.
+ * the pq_machine struct runs the code of the compiler (see pq_wam.h), it owns the database, the compiler, and the operators of its parsers.
+ * create/destroy the machine with the pq_new_* and pq_del_* functions.
+ * run a query with pq_machine_solve function, get the next answer with pq_machine_redo function, finish it with pq_machine_end_query function.
+ *
+ * the memory areas:
+ * the heap holds every term that is built by the code, it is popped on backtracking and its garbage is collected (see pq_machine_gc).
+ * the stack holds the environments (permanent variables and continuations) and the choice points.
+ * the trail holds the heap cells that were bound after the last choice point, they are unbound on backtracking.
+ *
+ * @version 0.001
+ * @date 10-16-2026
+ * @copyright Brandon Foster (c) 2020-2021
+ */
+
+#ifndef _PQ_MACHINE_H
+#define _PQ_MACHINE_H
+#include "pq_globals.h"
+#include "pq_term.h"
+#include "pq_wam.h"
+#include "pq_database.h"
+#include "pq_compiler.h"
+#include "pq_parser.h"
+#include "pq_op_table.h"
+#include "pq_writer.h"
+#include "pq_table.h"
+
+//the default sizes of the memory areas, in cells.
+#define PQ_MACHINE_HEAP_SIZE ((size_t)1 << 23)
+#define PQ_MACHINE_STACK_SIZE ((size_t)1 << 21)
+
+//the highest number of arguments of call/N.
+#define PQ_MACHINE_CALL_MAX 8
+
+//the default policy of the garbage collector (see pq_machine_set_gc_policy).
+#define PQ_MACHINE_GC_MIN ((size_t)1 << 20)
+#define PQ_MACHINE_GC_GROWTH 100
+
+/**
+ * @brief An environment, the frame of a clause that calls more than one goal.
+ */
+typedef struct pq_frame
+{
+    struct pq_frame* prev; //the environment of the caller.
+    pq_code* cp; //the continuation, the code after the call of the clause.
+    uint64_t size; //the number of permanent variables.
+    pq_term y[]; //the permanent variables.
+} pq_frame;
+
+/**
+ * @brief A choice point, the state that is restored when a goal fails.
+ */
+typedef struct pq_choice
+{
+    struct pq_choice* prev; //the previous choice point, it is also the cut level of the clauses that are tried.
+    pq_code* alt; //the code of the next alternative (e.g. a retry instruction).
+    pq_term* h; //the top of the heap.
+    size_t tr; //the top of the trail.
+    pq_frame* e; //the environment.
+    pq_code* cp; //the continuation.
+    uint64_t arity; //the number of saved argument registers.
+    pq_term args[]; //the saved argument registers.
+} pq_choice;
+
+/**
+ * @brief The results of running a query.
+ */
+typedef enum pq_machine_result
+{
+    PQ_MACHINE_FAIL, //the query has no more answers.
+    PQ_MACHINE_TRUE, //the query has an answer, its variables are bound.
+    PQ_MACHINE_ERROR, //the query raised the error stored in the machine.
+    PQ_MACHINE_HALT //halt/0 was called.
+} pq_machine_result;
+
+/**
+ * @brief The values of the occurs_check flag, whether a variable can be bound to a term that contains it (a cyclic term).
+ */
+typedef enum pq_occurs_check
+{
+    PQ_OCCURS_CHECK_FALSE, //the binding is not checked, it is the fastest.
+    PQ_OCCURS_CHECK_TRUE, //the unification fails.
+    PQ_OCCURS_CHECK_ERROR //the unification raises an error.
+} pq_occurs_check;
+
+/**
+ * @brief The kinds of numbers that are evaluated by arithmetic.
+ */
+typedef enum pq_number_kind
+{
+    PQ_NUMBER_INT,
+    PQ_NUMBER_FLOAT,
+    PQ_NUMBER_BIG //an integer that does not fit in a PQint.
+} pq_number_kind;
+
+/**
+ * @brief A number that is evaluated by arithmetic.
+ */
+typedef struct pq_number
+{
+    pq_number_kind kind;
+    union
+    {
+        PQint i;
+        PQflt f;
+        const pq_term* big; //the box of the bignum, a term or a result on top of the heap.
+    } val;
+} pq_number;
+
+/**
+ * @brief An entry of the cache of the goals that call/N compiled, keyed by the shape of the goal.
+ */
+typedef struct pq_call_entry
+{
+    pq_term* shape; //the goal in pre-order, the variables are numbered (see pq_machine_get_shape).
+    uint32_t shape_sz; //the number of cells in shape.
+    uint32_t hash; //the hash of shape, 0 for an empty entry.
+    pq_pred* pred; //the predicate whose clause is '$call'(V1, ..., VN) :- Goal.
+} pq_call_entry;
+
+/**
+ * @brief The garbage collector of the heap (see pq_machine_gc).
+ */
+typedef struct pq_gc
+{
+    //the policy, the heap grows by max(min, live * growth / 100) cells between two collections.
+    size_t min;
+    uint32_t growth;
+    pq_term* limit; //a call collects the heap when its top reaches the limit.
+
+    //the statistics.
+    uint64_t count; //the number of collections.
+    uint64_t reclaimed; //the number of bytes that were reclaimed.
+    double time; //the seconds of processor time.
+
+    //the scratch memory.
+    uint64_t* marks; //a bit for each cell of the collected heap, it is set if the cell is live.
+    size_t marks_cap;
+    size_t* counts; //the number of live cells below each word of marks.
+    size_t counts_cap;
+    uint64_t* seen; //a bit for each cell of the stack, the environments that were scanned and the permanent variables that are roots.
+    size_t seen_cap;
+    uint64_t* written; //a bit for each permanent variable of the environment that is scanned, it is set if the variable is written first.
+    size_t written_cap;
+    pq_term** roots; //the cells outside of the collected heap that point into it, they are updated when the heap moves.
+    size_t roots_sz;
+    size_t roots_cap;
+    pq_choice** choices; //the choice points of the query, the newest first.
+    size_t choices_sz;
+    size_t choices_cap;
+} pq_gc;
+
+/**
+ * @brief The structure of a poqer-lang abstract machine.
+ */
+typedef struct pq_machine
+{   //these variables should only be read externally, not modified.
+
+    pq_database* db; //the predicates.
+    pq_compiler* compiler; //compiles consulted clauses and queries.
+    pq_op_table* ops; //the operators, shared by the parsers of consult/1 and the writer (see pq_parser_share_ops).
+    pq_writer* writer; //the text of write/1 and the answers.
+    pq_table_space* tables; //the answers of the tabled predicates (see table/1).
+
+    //the memory areas.
+    pq_term* heap;
+    pq_term* heap_end;
+    pq_term* stack;
+    pq_term* stack_end;
+    pq_term** trail;
+    size_t trail_cap;
+
+    //the registers, they are cached in locals while the code runs and stored here before a builtin is called.
+    pq_term* h; //the top of the heap.
+    size_t tr; //the top of the trail.
+    pq_frame* e; //the current environment.
+    pq_choice* b; //the last choice point.
+    pq_choice* b0; //the last choice point before the current call, a cut in the called clause cuts to it.
+    pq_code* cp; //the continuation.
+    pq_code* p; //the next instruction, where a query resumes.
+    pq_term* x; //the X registers, the argument registers are the first ones.
+
+    //the query that is running.
+    pq_choice* base; //the choice point below the query, the query fails when it is reached.
+    pq_term* answers; //the heap cells of the variables of the query.
+    uint32_t answers_sz; //the number of variables of the query.
+    uint32_t depth; //the number of queries that are running, a directive of a consulted file is a query inside a query.
+
+    pq_pred* jump; //the predicate that a builtin jumps to (e.g. call/N).
+    uint64_t inferences; //the number of calls since the machine was created.
+    uint32_t consults; //the number of consults, it identifies the consult that added the clauses of a predicate.
+    pq_gc gc; //the garbage collector of the heap.
+    pq_occurs_check occurs_check; //the occurs check of the unifications, it can be set at any time.
+
+    //the scratch memory, unification and comparison walk terms without recursion.
+    pq_term* pdl;
+    size_t pdl_cap;
+    pq_term** marked; //the variable cells that are marked while a term is walked (e.g. copy_term/2), they are restored after.
+    size_t marked_cap;
+    pq_number* numbers; //the values of the subexpressions that arithmetic evaluated.
+    size_t numbers_cap;
+
+    //the cache of call/N.
+    pq_call_entry* calls;
+    uint32_t calls_count;
+    uint32_t calls_mask; //the number of entries minus 1, the number of entries is a power of 2.
+    pq_term* shape; //the shape of the last goal of call/N.
+    size_t shape_cap;
+    uint32_t calls_sz; //the number of goals that were compiled by call/N, it names the next one.
+
+    void (*output)(const char* str); //writes the text of write/1 and the warnings of consult/1.
+    PQbool halted; //whether halt/0 was called.
+    char* err;
+    char err_buffer[256]; //holds the errors that name a predicate.
+} pq_machine;
+
+/**
+ * @brief Safe allocation for a pq_machine struct, initializes the machine with the builtins and the library, then returns the pointer.
+ *
+ * @param heap_sz The number of cells of the heap, 0 for PQ_MACHINE_HEAP_SIZE.
+ * @param stack_sz The number of cells of the stack, 0 for PQ_MACHINE_STACK_SIZE.
+ * @return A pointer to the allocated pq_machine struct.
+ */
+pq_machine* pq_new_machine(const size_t heap_sz, const size_t stack_sz);
+
+/**
+ * @brief Safe deallocation of a pq_machine struct, its database, compiler, parser, writer, and tables.
+ *
+ * @param machine The machine that will be deallocated.
+ */
+void pq_del_machine(pq_machine* machine);
+
+/**
+ * @brief Runs a query until its first answer.
+ * The variables of the query are bound in machine->answers, in the order of vars.
+ * Upon error, the error is stored in the machine.
+ *
+ * @param machine The machine that will be used.
+ * @param goal The goal of the query.
+ * @param vars The variables of the query.
+ * @param vars_sz The number of variables.
+ * @return The pq_machine_result.
+ */
+pq_machine_result pq_machine_solve(pq_machine* machine, const pq_term goal, const pq_term* vars, const uint32_t vars_sz);
+
+/**
+ * @brief Runs the last query until its next answer.
+ *
+ * @param machine The machine that will be used.
+ * @return The pq_machine_result.
+ */
+pq_machine_result pq_machine_redo(pq_machine* machine);
+
+/**
+ * @brief Checks if the last query can have more answers.
+ *
+ * @param machine The machine that will be used.
+ * @return true if a choice point of the query is left else false.
+ */
+static inline PQbool pq_machine_has_alternatives(const pq_machine* machine)
+{
+    return machine->b != machine->base;
+}
+
+/**
+ * @brief Finishes the last query, its choice points and terms are removed.
+ *
+ * @param machine The machine that will be modified.
+ */
+void pq_machine_end_query(pq_machine* machine);
+
+/**
+ * @brief Collects the garbage of the heap of the query that is running, the live cells are moved to the bottom in order.
+ * It is called by a call when the heap reaches machine->gc.limit, the next limit is set by the policy.
+ * Upon failure, the error is stored in the machine and the heap is not moved.
+ *
+ * @param machine The machine that will be modified, its registers must be stored.
+ * @param arity The number of argument registers that are live (e.g. the arity of the predicate that is called).
+ * @return PQ_SUCCESS if the heap was collected else PQ_FAILURE.
+ */
+int pq_machine_gc(pq_machine* machine, const uint32_t arity);
+
+/**
+ * @brief Sets when the heap is collected, the heap grows by max(min, live * growth / 100) cells between two collections.
+ * The growth is at most half of the free cells, so a heap that is nearly full is not collected by every call.
+ *
+ * @param machine The machine that will be modified.
+ * @param min The number of cells that the heap grows by at least.
+ * @param growth The growth in percent of the cells that are used.
+ */
+void pq_machine_set_gc_policy(pq_machine* machine, const size_t min, const uint32_t growth);
+
+/**
+ * @brief Checks if a clause is a directive that the parser already ran when it was read (:- op/3).
+ *
+ * @param clause The clause.
+ * @return true if the directive was run by the parser else false.
+ */
+static inline PQbool pq_machine_is_parser_directive(pq_term clause)
+{
+    clause = pq_term_deref(clause);
+    if(pq_term_get_tag(clause) != PQ_TAG_STR || pq_term_get_name(clause) != PQ_ATOM_NECK || pq_term_get_arity(clause) != 1) return PQ_FALSE;
+    const pq_term goal = pq_term_deref(pq_term_get_arg(clause, 0));
+    return pq_term_get_tag(goal) == PQ_TAG_STR && pq_term_get_name(goal) == PQ_ATOM_OP && pq_term_get_arity(goal) == 3;
+}
+
+/**
+ * @brief Compiles the clauses of a file, the directives are run when they are read.
+ * The ".pl" extension is added to the path only if the file cannot be read as named.
+ * Upon error, the error is stored in the machine.
+ *
+ * @param machine The machine that will be modified.
+ * @param path The path of the file.
+ * @return PQ_SUCCESS if the file was consulted else PQ_FAILURE.
+ */
+int pq_machine_consult_file(pq_machine* machine, const char* path);
+
+/**
+ * @brief Compiles the clauses of a string, the directives are run when they are read.
+ * Upon error, the error is stored in the machine.
+ *
+ * @param machine The machine that will be modified.
+ * @param text A valid utf8 null-terminated c-string, it must outlive the call.
+ * @return PQ_SUCCESS if the text was consulted else PQ_FAILURE.
+ */
+int pq_machine_consult_text(pq_machine* machine, const char* text);
+
+/**
+ * @brief Loads the argument registers to call a goal with extra arguments (e.g. call/N), the control constructs are compiled and cached.
+ * Upon error, the error is stored in the machine.
+ *
+ * @param machine The machine that will be modified, its registers must be stored.
+ * @param goal The goal.
+ * @param extra The extra arguments that are appended to the goal.
+ * @param extra_sz The number of extra arguments.
+ * @return PQ_BUILTIN_JUMP with the predicate in machine->jump, PQ_BUILTIN_FAIL upon error.
+ */
+pq_builtin_result pq_machine_call(pq_machine* machine, pq_term goal, const pq_term* extra, const uint32_t extra_sz);
+
+/**
+ * @brief Sets the error of a machine, the text is formatted with the name and arity of a predicate.
+ *
+ * @param machine The machine that will be modified.
+ * @param format The format of the error, with a %s for the name and a %u for the arity.
+ * @param name The name of the predicate.
+ * @param arity The arity of the predicate.
+ */
+void pq_machine_set_pred_error(pq_machine* machine, const char* format, const pq_atom name, const uint32_t arity);
+
+/**
+ * @brief Unifies two terms, the bindings are trailed.
+ * The terms are walked with the scratch stack, so a deep term does not overflow the c stack.
+ * Upon failure, the error of the occurs check is stored in the machine (see pq_occurs_check).
+ *
+ * @param machine The machine that will be modified, its registers must be stored.
+ * @param a The first term.
+ * @param b The second term.
+ * @return true if the terms were unified else false.
+ */
+PQbool pq_machine_unify(pq_machine* machine, const pq_term a, const pq_term b);
+
+/**
+ * @brief Compares two terms in the standard order of terms, Var < Number < Atom < Compound.
+ *
+ * @param machine The machine that will be used.
+ * @param a The first term.
+ * @param b The second term.
+ * @return A negative number if a is before b, 0 if they are identical, else a positive number.
+ */
+int pq_machine_compare(pq_machine* machine, const pq_term a, const pq_term b);
+
+/**
+ * @brief Gets the first free cell of the stack, above the current environment and the last choice point.
+ * The environment is trimmed: the call before the continuation keeps the permanent variables that are used after it,
+ * the ones above are dead, so they are reused unless a choice point protects them.
+ *
+ * @param machine The machine that will be used.
+ * @param e The current environment, NULL if there is none.
+ * @param cp The continuation, the code after a call in e.
+ * @param b The last choice point, NULL if there is none.
+ * @return The first free cell.
+ */
+static inline pq_term* pq_machine_stack_top(const pq_machine* machine, const pq_frame* e, const pq_code* cp, const pq_choice* b)
+{
+    pq_term* top = machine->stack;
+    if(e && (pq_term*)e->y + pq_wam_get_a(cp[-2]) > top) top = (pq_term*)e->y + pq_wam_get_a(cp[-2]);
+    if(b && (pq_term*)b->args + b->arity > top) top = (pq_term*)b->args + b->arity;
+    return top;
+}
+
+/**
+ * @brief Allocates cells on the heap.
+ * Upon failure, the error is stored in the machine.
+ *
+ * @param machine The machine that will be modified, its registers must be stored.
+ * @param n The number of cells.
+ * @return The first cell, NULL if the heap is full.
+ */
+static inline pq_term* pq_machine_alloc(pq_machine* machine, const size_t n)
+{
+    if((size_t)(machine->heap_end - machine->h) < n)
+    {
+        machine->err = "resource error: the heap is full.";
+        return NULL;
+    }
+    pq_term* cells = machine->h;
+    machine->h += n;
+    return cells;
+}
+
+/**
+ * @brief Creates an unbound variable on the heap.
+ *
+ * @param machine The machine that will be modified, its registers must be stored.
+ * @return The variable, PQ_TERM_NONE if the heap is full.
+ */
+static inline pq_term pq_machine_new_var(pq_machine* machine)
+{
+    pq_term* cell = pq_machine_alloc(machine, 1);
+    if(!cell) return PQ_TERM_NONE;
+    *cell = pq_make_ptr_term(cell, PQ_TAG_REF);
+    return *cell;
+}
+
+/**
+ * @brief Binds an unbound variable, it is trailed if it is older than the last choice point.
+ * Upon failure, the error is stored in the machine.
+ *
+ * @param machine The machine that will be modified, its registers must be stored.
+ * @param cell The cell of the variable.
+ * @param val The value.
+ * @return PQ_SUCCESS if the variable was bound else PQ_FAILURE (the trail is full).
+ */
+static inline int pq_machine_bind(pq_machine* machine, pq_term* cell, const pq_term val)
+{
+    *cell = val;
+    if(cell >= machine->b->h) return PQ_SUCCESS;
+    if(pq_array_reserve((void**)&machine->trail, &machine->trail_cap, machine->tr + 1, sizeof(pq_term*)) != PQ_SUCCESS)
+    {
+        machine->err = "resource error: the trail is full.";
+        return PQ_FAILURE;
+    }
+    machine->trail[machine->tr++] = cell;
+    return PQ_SUCCESS;
+}
+
+/**
+ * @brief Creates an integer term, it is boxed on the heap if it does not fit in a small integer.
+ *
+ * @param machine The machine that will be modified, its registers must be stored.
+ * @param val The value.
+ * @return The integer term, PQ_TERM_NONE if the heap is full.
+ */
+static inline pq_term pq_machine_new_integer(pq_machine* machine, const PQint val)
+{
+    if(pq_int_fits_small(val)) return (pq_term)val << PQ_TERM_TAG_BITS | PQ_TAG_INT;
+
+    pq_term* cells = pq_machine_alloc(machine, 2);
+    if(!cells) return PQ_TERM_NONE;
+    cells[0] = pq_make_box_cell(PQ_BOX_INT, 1);
+    memcpy(&cells[1], &val, sizeof(PQint));
+    return pq_make_ptr_term(cells, PQ_TAG_BOX);
+}
+
+/**
+ * @brief Creates a float term, it is boxed on the heap.
+ *
+ * @param machine The machine that will be modified, its registers must be stored.
+ * @param val The value.
+ * @return The float term, PQ_TERM_NONE if the heap is full.
+ */
+static inline pq_term pq_machine_new_float(pq_machine* machine, const PQflt val)
+{
+    pq_term* cells = pq_machine_alloc(machine, 2);
+    if(!cells) return PQ_TERM_NONE;
+    cells[0] = pq_make_box_cell(PQ_BOX_FLOAT, 1);
+    memcpy(&cells[1], &val, sizeof(PQflt));
+    return pq_make_ptr_term(cells, PQ_TAG_BOX);
+}
+
+/**
+ * @brief Writes a text with the output of the machine.
+ *
+ * @param machine The machine that will be used.
+ * @param str The null-terminated utf8 text.
+ */
+static inline void pq_machine_print(pq_machine* machine, const char* str)
+{
+    if(machine->output) machine->output(str);
+}
+
+/**
+ * @brief Registers the builtins and consults the library.
+ * It is called by pq_new_machine.
+ *
+ * @param machine The machine that will be modified.
+ * @return PQ_SUCCESS if the builtins were registered else PQ_FAILURE.
+ */
+int pq_builtins_init(pq_machine* machine);
+
+#endif
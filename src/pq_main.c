@@ -3,21 +3,26 @@
  * @author Brandon Foster
  * @brief poqer-lang interpreter program.
  * 
- * @version 0.005
- * @date 10-11-2020
+ * @version 0.006
+ * @date 2-20-2021
  * @copyright Brandon Foster (c) 2020-2021
  */
 
 #include "pq_utils.h"
 #include "pq_unicode.h"
 #include "pq_parser.h"
+#include "pq_machine.h"
 #include <stdio.h>
 
 #ifdef PQ_OS_LINUX
   #define MAIN(X) main(X)
+  #define MAIN_ARGS int argc, char** argv
+  typedef char pq_arg_char;
 
 #elif PQ_OS_WINDOWS
   #define MAIN(X) wmain(X)
+  #define MAIN_ARGS int argc, wchar_t** argv
+  typedef wchar_t pq_arg_char;
 
   #ifndef _UNICODE
   #define _UNICODE
@@ -36,18 +41,68 @@
  */
 char* my_getline(void);
 
+void print_lexeme(const pq_lexeme lexeme);
+
+/**
+ * @brief Prints a null-terminated utf8 c-string, it is the output of the machine.
+ * 
+ * @param str The string.
+ */
+void print_utf8(const char* str);
+
+/**
+ * @brief Runs a query, prints its answers, and asks for the next one while it has alternatives.
+ * 
+ * @param machine The machine that will be used.
+ * @param parser The parser of the query, its variables are the variables of the query.
+ * @param goal The query.
+ * @return The result of the last answer.
+ */
+pq_machine_result run_query(pq_machine* machine, pq_parser* parser, pq_term goal);
+
+/**
+ * @brief Reads the memory options of the command line, --heap N and --stack N set the number of cells of the areas.
+ * A size can end with k, m, or g (e.g. --stack 64m), the areas are fixed while the interpreter runs.
+ * 
+ * @param argc The number of arguments.
+ * @param argv The arguments, the first one is the program.
+ * @param heap_sz The number of cells of the heap is stored here, it is left as is unless the option is given.
+ * @param stack_sz The number of cells of the stack is stored here, it is left as is unless the option is given.
+ * @return PQ_SUCCESS if every option was read else PQ_FAILURE.
+ */
+int read_options(const int argc, pq_arg_char** argv, size_t* heap_sz, size_t* stack_sz);
+
 void print_all_tokens(pq_scanner* scanner, const char* line);
 
 void debug_test_syntax_tree();
 
-int MAIN(void)
+int MAIN(MAIN_ARGS)
 {
     pq_init_utf_io();
+
+    //Options, 0 keeps the default size of an area
+    size_t heap_sz = 0;
+    size_t stack_sz = 0;
+    if(read_options(argc, argv, &heap_sz, &stack_sz) != PQ_SUCCESS)
+    {
+        wprintf(L"usage: program [--heap CELLS] [--stack CELLS], a size can end with k, m, or g.\n");
+        return PQ_FAILURE;
+    }
     wprintf(L"poqer-lang interpreter(work in progress)\n");
 
     //Initialization
 
+    pq_machine* machine = pq_new_machine(heap_sz, stack_sz);
     pq_parser* parser = pq_new_parser();
+    if(!machine || !parser)
+    {
+        wprintf(L"not enough memory for the interpreter.\n");
+        pq_del_machine(machine);
+        pq_del_parser(parser);
+        return PQ_FAILURE;
+    }
+    pq_parser_share_ops(parser, machine->ops); //op/3 directives of consulted files apply to the queries.
+    machine->output = print_utf8;
 
     for(;;)
     {   //REPL
@@ -55,56 +110,232 @@ int MAIN(void)
         //Command prefix
         wprintf(L"?- ");
 
-        //Read input
-        pq_parser_set_buffer(parser, my_getline());
+        //Read input, stops at the end of stdin
+        char* line = my_getline();
+        if(!line || (!*line && feof(stdin)))
+        {
+            free(line);
+            wprintf(L"\n");
+            break;
+        }
 
-        //Parse tokens into a Syntax Tree
-        pq_syntax_tree* result = pq_parser_parse(parser);
+        //Parse the query, then run it
+        pq_parser_restart(parser);
+        pq_parser_set_buffer(parser, line);
+        const pq_term clause = pq_parser_next_clause(parser);
 
         //Prints error if any
         if(parser->err)
         {
-            wprintf(L"%ls", pq_utf8s_to_new_wcs(parser->err));
+            print_utf8(parser->err);
+            wprintf(L"\n");
         }
-        else wprintf(L"okay poqer syntax");
-        
-        wprintf(L"\n");
+        else if(clause != PQ_TERM_NONE && run_query(machine, parser, clause) == PQ_MACHINE_HALT) break;
+
+        //Deallocates the terms of the line, the memory is reused by the next line
+        pq_parser_clear_terms(parser);
     }
-    
+
     //Clean Up
     pq_del_parser(parser);
+    pq_del_machine(machine);
+    pq_atom_table_free();
+
+    return PQ_SUCCESS;
+}
+
+void print_utf8(const char* str)
+{
+    const wchar_t* wcs = pq_utf8s_to_new_wcs(str);
+    if(!wcs) return;
+    wprintf(L"%ls", wcs);
+    free((void*)wcs);
+}
+
+pq_machine_result run_query(pq_machine* machine, pq_parser* parser, pq_term goal)
+{
+    //a query can be written as a directive, the directives that the parser ran are done.
+    if(pq_machine_is_parser_directive(goal))
+    {
+        wprintf(L"true.\n");
+        return PQ_MACHINE_TRUE;
+    }
+    goal = pq_term_deref(goal);
+    if(pq_term_get_tag(goal) == PQ_TAG_STR && pq_term_get_arity(goal) == 1
+        && (pq_term_get_name(goal) == PQ_ATOM_NECK || pq_term_get_name(goal) == PQ_ATOM_QUERY))
+        goal = pq_term_get_arg(goal, 0);
+
+    pq_term* vars = (pq_term*)malloc((parser->vars_sz + 1) * sizeof(pq_term));
+    if(!vars)
+    {
+        wprintf(L"not enough memory for the query.\n");
+        return PQ_MACHINE_ERROR;
+    }
+    for(uint32_t i = 0; i < parser->vars_sz; ++i) vars[i] = parser->vars[i].term;
+
+    pq_machine_result result = pq_machine_solve(machine, goal, vars, parser->vars_sz);
+    while(result == PQ_MACHINE_TRUE)
+    {   //prints the bindings of the named variables, the ones that start with _ are hidden.
+        PQbool any = PQ_FALSE;
+        for(uint32_t i = 0; i < parser->vars_sz; ++i)
+        {
+            const pq_lexeme name = parser->vars[i].name;
+            if(name.str[0] == '_') continue;
+            pq_writer_clear(machine->writer);
+            const int written = pq_writer_write(machine->writer, pq_make_ptr_term(&machine->answers[i], PQ_TAG_REF), PQ_WRITE_QUOTED);
+            if(any) wprintf(L",\n");
+            print_lexeme(name);
+            wprintf(L" = ");
+            if(written != PQ_SUCCESS)
+            {   //the reason is written in place of the binding, the other bindings are still printed.
+                wprintf(L"/* ");
+                print_utf8(machine->writer->err);
+                wprintf(L" */");
+            }
+            else print_utf8(machine->writer->str);
+            any = PQ_TRUE;
+        }
+        if(!any) wprintf(L"true");
+        if(!pq_machine_has_alternatives(machine))
+        {
+            wprintf(L".\n");
+            break;
+        }
+
+        //; asks for the next answer.
+        wprintf(L" ");
+        char* reply = my_getline();
+        const PQbool more = reply && reply[0] == ';';
+        free(reply);
+        if(!more)
+        {
+            wprintf(L".\n");
+            break;
+        }
+        result = pq_machine_redo(machine);
+    }
+    if(result == PQ_MACHINE_FAIL) wprintf(L"false.\n");
+    else if(result == PQ_MACHINE_ERROR)
+    {
+        print_utf8(machine->err);
+        wprintf(L"\n");
+    }
 
+    pq_machine_end_query(machine);
+    free(vars);
+    return result;
+}
+
+/**
+ * @brief Checks if an argument is an option.
+ * 
+ * @param arg The argument.
+ * @param name The ascii name of the option.
+ * @return true if the argument is the option else false.
+ */
+static PQbool is_option(const pq_arg_char* arg, const char* name)
+{
+    while(*name && *arg == (pq_arg_char)*name)
+    {
+        arg++;
+        name++;
+    }
+    return !*name && !*arg;
+}
+
+/**
+ * @brief Reads a number of cells, with an optional k, m, or g multiplier.
+ * 
+ * @param arg The argument.
+ * @param cells The number is stored here.
+ * @return PQ_SUCCESS if the argument is a positive number else PQ_FAILURE.
+ */
+static int read_cells(const pq_arg_char* arg, size_t* cells)
+{
+    size_t val = 0;
+    if(*arg < '0' || *arg > '9') return PQ_FAILURE;
+    for(; *arg >= '0' && *arg <= '9'; arg++)
+    {
+        if(val > (SIZE_MAX - 9) / 10) return PQ_FAILURE;
+        val = val * 10 + (size_t)(*arg - '0');
+    }
+
+    unsigned shift = 0;
+    switch(*arg)
+    {
+    case 'k': case 'K': shift = 10; arg++; break;
+    case 'm': case 'M': shift = 20; arg++; break;
+    case 'g': case 'G': shift = 30; arg++; break;
+    default: break;
+    }
+    if(*arg || !val || val > (SIZE_MAX / sizeof(pq_term)) >> shift) return PQ_FAILURE;
+    *cells = val << shift;
     return PQ_SUCCESS;
 }
 
+int read_options(const int argc, pq_arg_char** argv, size_t* heap_sz, size_t* stack_sz)
+{
+    for(int i = 1; i < argc; i++)
+    {
+        size_t* cells = is_option(argv[i], "--heap") ? heap_sz : is_option(argv[i], "--stack") ? stack_sz : NULL;
+        if(!cells || i + 1 == argc || read_cells(argv[++i], cells) != PQ_SUCCESS) return PQ_FAILURE;
+    }
+    return PQ_SUCCESS;
+}
+
+void print_lexeme(const pq_lexeme lexeme)
+{
+    //prints one utf8 character at a time, so the lexeme does not need to be copied or null-terminated.
+    wchar_t wcs[PQ_WCHAR_LEN_MAX];
+    const char* curr = lexeme.str;
+    const char* end = lexeme.str + lexeme.len;
+    while(curr < end)
+    {
+        int8_t bytes = pq_utf8_to_wcs(wcs, curr);
+        if(bytes <= 0) break;
+        wprintf(L"%ls", wcs);
+        curr += bytes;
+    }
+}
+
 void print_all_tokens(pq_scanner* scanner, const char* line)
 {
     pq_scanner_set_buffer(scanner, line);
 
     //prints the output of each token found in the buffer with error checking.
     int8_t found_atleast1 = 0;
-    pq_tok* tok;
+    pq_tok tok;
     char* err;
-    while((tok = pq_scanner_next_token(scanner, &err)) != NULL)
+    while(pq_scanner_scan_token(scanner, &tok, &err) != NULL)
     {
         found_atleast1 = 1;
-        switch(tok->tag)
+        switch(tok.tag)
         {
         case PQ_NAME_TOK:
-            wprintf(L"name{%ls} ", pq_utf8s_to_new_wcs(tok->val.s));
+            wprintf(L"name{");
+            print_lexeme(pq_scanner_get_token_lexeme(scanner, &tok));
+            wprintf(L"} ");
             break;
         case PQ_VAR_TOK:
-            wprintf(L"var{%ls} ", pq_utf8s_to_new_wcs(tok->val.s));
+            wprintf(L"var{");
+            print_lexeme(pq_scanner_get_token_lexeme(scanner, &tok));
+            wprintf(L"} ");
             break;
 
         case PQ_INT_TOK:
-            wprintf(L"int{%lld} ", tok->val.i);
+            wprintf(L"int{%lld} ", tok.val.i);
+            break;
+        case PQ_BIGINT_TOK:
+            wprintf(L"bigint{");
+            print_lexeme(pq_scanner_get_token_lexeme(scanner, &tok));
+            wprintf(L"} ");
             break;
         case PQ_FLT_TOK:
-            wprintf(L"float{%f} ", tok->val.f);
+            wprintf(L"float{%f} ", tok.val.f);
             break;
 
         case PQ_LPAR_TOK:
+        case PQ_OPEN_CT_TOK:
         case PQ_RPAR_TOK:
         case PQ_LLIST_TOK:
         case PQ_RLIST_TOK:
@@ -112,20 +343,23 @@ void print_all_tokens(pq_scanner* scanner, const char* line)
         case PQ_RCURLY_TOK:
         case PQ_HT_SEP_TOK:
         case PQ_COMMA_TOK:
-            wprintf(L"%ls ", pq_utf8s_to_new_wcs(tok->val.s));
+            print_lexeme(pq_scanner_get_token_lexeme(scanner, &tok));
+            wprintf(L" ");
             break;
         case PQ_END_TOK:
-            wprintf(L"%ls\n", pq_utf8s_to_new_wcs(tok->val.s));
+            print_lexeme(pq_scanner_get_token_lexeme(scanner, &tok));
+            wprintf(L"\n");
             break;
         }
         
-        free(tok);
+        pq_clear_token(&tok);
     }
 
     if(err != NULL)
     {
         if(found_atleast1) wprintf(L"\n");
         wprintf(L"%ls", pq_utf8s_to_new_wcs(err));
+        free(err);
     }
     wprintf(L"\n");
 }
@@ -209,7 +443,6 @@ char* my_getline(void)
             if(NULL == line_n)
             {   //no more space, free used space and give up.
                 free(line);
-                fflush(stdin);
                 return NULL;
             }
 
@@ -227,7 +460,6 @@ char* my_getline(void)
         curr += bytes;
     }
     *curr = '\0'; //null-terminates the c-string.
-    fflush(stdin);
     
     return line;
 }
\ No newline at end of file
@@ -0,0 +1,118 @@
+/**
+ * @file pq_mapped_file.c
+ * @author Brandon Foster
+ * @brief poqer-lang mapped file implementation.
+ * 
+ * @version 0.001
+ * @date 10-16-2026
+ * @copyright Brandon Foster (c) 2020-2021
+ */
+
+#ifdef __gnu_linux__
+#define _DEFAULT_SOURCE //for MAP_ANONYMOUS and madvise.
+#endif
+
+#include "pq_mapped_file.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef PQ_OS_LINUX
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+int pq_map_file(pq_mapped_file* file, const char* path)
+{
+    file->buffer = NULL;
+    file->buffer_sz = 0;
+    file->map_sz = 0;
+
+#ifdef PQ_OS_LINUX
+    int fd = open(path, O_RDONLY);
+    if(fd < 0) return PQ_FAILURE;
+
+    struct stat st;
+    if(fstat(fd, &st) != 0 || !S_ISREG(st.st_mode))
+    {
+        close(fd);
+        return PQ_FAILURE;
+    }
+
+    //reserves the file's pages and one more zeroed page, so the contents are always null-terminated.
+    size_t page_sz = (size_t)sysconf(_SC_PAGESIZE);
+    size_t buffer_sz = (size_t)st.st_size;
+    size_t map_sz = (buffer_sz / page_sz + 1) * page_sz;
+    char* region = mmap(NULL, map_sz, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(region == MAP_FAILED)
+    {
+        close(fd);
+        return PQ_FAILURE;
+    }
+
+    //maps the file over the start of the reserved pages.
+    if(buffer_sz > 0 && mmap(region, buffer_sz, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED)
+    {
+        munmap(region, map_sz);
+        close(fd);
+        return PQ_FAILURE;
+    }
+    close(fd); //the mapping stays valid after the descriptor is closed.
+
+    //the file is scanned front to back once, so the kernel can read ahead aggressively.
+    //the advice values are not bit flags, each one is given in its own call.
+    madvise(region, map_sz, MADV_SEQUENTIAL);
+    madvise(region, map_sz, MADV_WILLNEED);
+
+    file->buffer = region;
+    file->buffer_sz = buffer_sz;
+    file->map_sz = map_sz;
+    return PQ_SUCCESS;
+
+#else
+    //no mmap, falls back to reading the whole file into the heap.
+    FILE* stream = fopen(path, "rb");
+    if(!stream) return PQ_FAILURE;
+
+    size_t mem_size = 4096;
+    size_t buffer_sz = 0;
+    char* buffer = malloc(mem_size + 1);
+    for(;;)
+    {
+        if(!buffer)
+        {
+            fclose(stream);
+            return PQ_FAILURE;
+        }
+        buffer_sz += fread(buffer + buffer_sz, 1, mem_size - buffer_sz, stream);
+        if(buffer_sz < mem_size) break;
+
+        //not enough bytes, request double.
+        char* buffer_n = realloc(buffer, (mem_size <<= 1) + 1);
+        if(!buffer_n) free(buffer);
+        buffer = buffer_n;
+    }
+    fclose(stream);
+    buffer[buffer_sz] = '\0';
+
+    file->buffer = buffer;
+    file->buffer_sz = buffer_sz;
+    return PQ_SUCCESS;
+#endif
+}
+
+void pq_unmap_file(pq_mapped_file* file)
+{
+    if(!file->buffer) return;
+
+#ifdef PQ_OS_LINUX
+    if(file->map_sz > 0) munmap((void*)file->buffer, file->map_sz);
+    else free((void*)file->buffer);
+#else
+    free((void*)file->buffer);
+#endif
+    file->buffer = NULL;
+    file->buffer_sz = 0;
+    file->map_sz = 0;
+}
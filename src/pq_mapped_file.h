@@ -0,0 +1,46 @@
+/**
+ * @file pq_mapped_file.h
+ * @author Brandon Foster
+ * @brief poqer-lang mapped file header.
+ * the pq_mapped_file struct gives read-only access to the contents of a source file without copying them.
+ * map/unmap the file with the pq_map_file and pq_unmap_file functions.
+ * 
+ * @version 0.001
+ * @date 10-16-2026
+ * @copyright Brandon Foster (c) 2020-2021
+ */
+
+#ifndef _PQ_MAPPED_FILE_H
+#define _PQ_MAPPED_FILE_H
+#include "pq_globals.h"
+
+/**
+ * @brief The contents of a file mapped into memory.
+ */
+typedef struct pq_mapped_file
+{   //these variables should only be read externally, not modified.
+
+    const char* buffer; //the contents of the file, always followed by a null character.
+    size_t buffer_sz; //the size of the file in bytes.
+    size_t map_sz; //the number of bytes mapped, 0 if the contents were read into the heap instead.
+} pq_mapped_file;
+
+/**
+ * @brief Maps a file read-only into memory.
+ * On GNU-Linux the file is mmaped followed by a zeroed page for the null character,
+ * on other platforms it is read into the heap.
+ * 
+ * @param file The mapped file will be stored here.
+ * @param path The utf8 null-terminated c-string path of the file.
+ * @return PQ_SUCCESS if the file was mapped else PQ_FAILURE.
+ */
+int pq_map_file(pq_mapped_file* file, const char* path);
+
+/**
+ * @brief Unmaps a file mapped by pq_map_file, its buffer cannot be used afterwards.
+ * 
+ * @param file The file that will be unmapped.
+ */
+void pq_unmap_file(pq_mapped_file* file);
+
+#endif
@@ -0,0 +1,196 @@
+/**
+ * @file pq_op_table.c
+ * @author Brandon Foster
+ * @brief poqer-lang operator table implementation.
+ * 
+ * @version 0.001
+ * @date 10-16-2026
+ * @copyright Brandon Foster (c) 2020-2021
+ */
+
+#include "pq_op_table.h"
+
+#define PQ_OP_TABLE_INIT_SIZE 128
+
+/**
+ * @brief A default operator.
+ */
+typedef struct pq_op_default
+{
+    pq_atom atom;
+    pq_priority priority;
+    pq_op_specifier specifier;
+} pq_op_default;
+
+//the default operators, they follow the iso prolog operator table.
+static const pq_op_default pq_op_defaults[] = {
+    { PQ_ATOM_NECK, 1200, PQ_OP_XFX }, { PQ_ATOM_DCG_ARROW, 1200, PQ_OP_XFX },
+    { PQ_ATOM_NECK, 1200, PQ_OP_FX }, { PQ_ATOM_QUERY, 1200, PQ_OP_FX },
+    { PQ_ATOM_TABLE, 1150, PQ_OP_FX },
+    { PQ_ATOM_SEMICOLON, 1100, PQ_OP_XFY },
+    { PQ_ATOM_IF_THEN, 1050, PQ_OP_XFY },
+    { PQ_ATOM_COMMA, 1000, PQ_OP_XFY },
+    { PQ_ATOM_NOT_PROVABLE, 900, PQ_OP_FY },
+    { PQ_ATOM_UNIFY, 700, PQ_OP_XFX }, { PQ_ATOM_NOT_UNIFY, 700, PQ_OP_XFX },
+    { PQ_ATOM_EQ, 700, PQ_OP_XFX }, { PQ_ATOM_NOT_EQ, 700, PQ_OP_XFX },
+    { PQ_ATOM_STD_LT, 700, PQ_OP_XFX }, { PQ_ATOM_STD_LE, 700, PQ_OP_XFX }, { PQ_ATOM_STD_GT, 700, PQ_OP_XFX }, { PQ_ATOM_STD_GE, 700, PQ_OP_XFX },
+    { PQ_ATOM_UNIV, 700, PQ_OP_XFX },
+    { PQ_ATOM_IS, 700, PQ_OP_XFX }, { PQ_ATOM_ARITH_EQ, 700, PQ_OP_XFX }, { PQ_ATOM_ARITH_NE, 700, PQ_OP_XFX },
+    { PQ_ATOM_LT, 700, PQ_OP_XFX }, { PQ_ATOM_LE, 700, PQ_OP_XFX }, { PQ_ATOM_GT, 700, PQ_OP_XFX }, { PQ_ATOM_GE, 700, PQ_OP_XFX },
+    { PQ_ATOM_PLUS, 500, PQ_OP_YFX }, { PQ_ATOM_MINUS, 500, PQ_OP_YFX }, { PQ_ATOM_BIT_AND, 500, PQ_OP_YFX }, { PQ_ATOM_BIT_OR, 500, PQ_OP_YFX }, { PQ_ATOM_XOR, 500, PQ_OP_YFX },
+    { PQ_ATOM_TIMES, 400, PQ_OP_YFX }, { PQ_ATOM_DIVIDE, 400, PQ_OP_YFX }, { PQ_ATOM_INT_DIVIDE, 400, PQ_OP_YFX },
+    { PQ_ATOM_REM, 400, PQ_OP_YFX }, { PQ_ATOM_MOD, 400, PQ_OP_YFX }, { PQ_ATOM_DIV, 400, PQ_OP_YFX },
+    { PQ_ATOM_SHIFT_LEFT, 400, PQ_OP_YFX }, { PQ_ATOM_SHIFT_RIGHT, 400, PQ_OP_YFX },
+    { PQ_ATOM_POWER, 200, PQ_OP_XFX },
+    { PQ_ATOM_CARET, 200, PQ_OP_XFY },
+    { PQ_ATOM_MINUS, 200, PQ_OP_FY }, { PQ_ATOM_BIT_NOT, 200, PQ_OP_FY }
+};
+
+/**
+ * @brief Doubles the number of entries and reinserts every atom.
+ * 
+ * @param table The table that will be modified.
+ * @return PQ_SUCCESS if the entries were reallocated else PQ_FAILURE.
+ */
+static int pq_op_table_grow(pq_op_table* table)
+{
+    uint32_t old_size = table->slot_mask + 1;
+    uint32_t size = old_size << 1;
+    pq_op_entry* old_entries = table->entries;
+    pq_op_entry* entries = malloc(size * sizeof(pq_op_entry));
+    if(!entries) return PQ_FAILURE;
+    for(uint32_t i = 0; i < size; ++i) entries[i].atom = PQ_ATOM_NONE;
+
+    table->entries = entries;
+    table->slot_mask = size - 1;
+    for(uint32_t i = 0; i < old_size; ++i)
+    {
+        if(old_entries[i].atom == PQ_ATOM_NONE) continue;
+        uint32_t j = pq_op_table_hash(table, old_entries[i].atom);
+        while(entries[j].atom != PQ_ATOM_NONE) j = (j + 1) & table->slot_mask;
+        entries[j] = old_entries[i];
+    }
+    free(old_entries);
+    return PQ_SUCCESS;
+}
+
+pq_op_table* pq_new_op_table(void)
+{
+    pq_op_table* table = (pq_op_table*)malloc(sizeof(pq_op_table));
+    if(!table) return NULL;
+
+    table->entries = malloc(PQ_OP_TABLE_INIT_SIZE * sizeof(pq_op_entry));
+    if(!table->entries)
+    {
+        free(table);
+        return NULL;
+    }
+    for(uint32_t i = 0; i < PQ_OP_TABLE_INIT_SIZE; ++i) table->entries[i].atom = PQ_ATOM_NONE;
+    table->count = 0;
+    table->slot_mask = PQ_OP_TABLE_INIT_SIZE - 1;
+
+    for(size_t i = 0; i < sizeof(pq_op_defaults) / sizeof(pq_op_defaults[0]); ++i)
+    {
+        if(pq_op_table_add(table, pq_op_defaults[i].atom, pq_op_defaults[i].priority, pq_op_defaults[i].specifier) != PQ_SUCCESS)
+        {
+            pq_del_op_table(table);
+            return NULL;
+        }
+    }
+    return table;
+}
+
+void pq_del_op_table(pq_op_table* table)
+{
+    if(!table) return;
+
+    free(table->entries);
+    free(table);
+}
+
+int pq_op_table_add(pq_op_table* table, const pq_atom atom, const pq_priority priority, const pq_op_specifier specifier)
+{
+    if(priority > PQ_OP_MAX_PRIORITY || atom == PQ_ATOM_NONE) return PQ_FAILURE;
+
+    uint32_t i = pq_op_table_hash(table, atom);
+    while(table->entries[i].atom != atom && table->entries[i].atom != PQ_ATOM_NONE)
+        i = (i + 1) & table->slot_mask;
+
+    pq_op_entry* entry = &table->entries[i];
+    if(entry->atom == PQ_ATOM_NONE)
+    {   //a new operator atom, removed operators keep their entry so probing is never broken.
+        if(priority == 0) return PQ_SUCCESS;
+        if(table->count + 1 > (table->slot_mask + 1) >> 1)
+        {   //keeps the entries at most half full.
+            if(pq_op_table_grow(table) != PQ_SUCCESS) return PQ_FAILURE;
+            return pq_op_table_add(table, atom, priority, specifier);
+        }
+        entry->atom = atom;
+        for(int op_class = 0; op_class < PQ_OP_CLASS_COUNT; ++op_class)
+        {
+            entry->defs[op_class].priority = 0;
+            entry->defs[op_class].specifier = PQ_OP_XFX;
+        }
+        table->count++;
+    }
+
+    pq_op_def* def = &entry->defs[pq_op_get_class(specifier)];
+    def->priority = priority;
+    def->specifier = specifier;
+    return PQ_SUCCESS;
+}
+
+int pq_op_table_add_terms(pq_op_table* table, pq_term priority, pq_term type, pq_term names, char** err)
+{
+    priority = pq_term_deref(priority);
+    type = pq_term_deref(type);
+    names = pq_term_deref(names);
+    if(pq_term_is_var(priority) || pq_term_is_var(type) || pq_term_is_var(names))
+    {
+        *err = "instantiation error: op/3 expects a priority, an operator type, and names.";
+        return PQ_FAILURE;
+    }
+    if(!pq_term_is_integer(priority) || pq_term_is_bigint(priority) || pq_term_get_int(priority) < 0 || pq_term_get_int(priority) > PQ_OP_MAX_PRIORITY)
+    {
+        *err = "domain error: expected an op/3 priority between 0 and 1200.";
+        return PQ_FAILURE;
+    }
+
+    pq_op_specifier spec;
+    if(!pq_term_is_atom(type) || pq_op_atom_to_specifier(pq_term_get_atom(type), &spec) != PQ_SUCCESS)
+    {
+        *err = "domain error: expected an op/3 operator type.";
+        return PQ_FAILURE;
+    }
+
+    //the names are either one atom or a list of atoms.
+    const PQbool is_list = pq_term_get_tag(names) == PQ_TAG_LIST;
+    while(!is_list || pq_term_get_tag(names) == PQ_TAG_LIST)
+    {
+        const pq_term name = is_list ? pq_term_deref(pq_term_get_arg(names, 0)) : names;
+        if(!pq_term_is_atom(name))
+        {
+            *err = "type error: expected an op/3 atom or list of atoms.";
+            return PQ_FAILURE;
+        }
+        if(pq_term_get_atom(name) == PQ_ATOM_COMMA)
+        {
+            *err = "permission error: the ',' operator cannot be modified.";
+            return PQ_FAILURE;
+        }
+        if(pq_op_table_add(table, pq_term_get_atom(name), (pq_priority)pq_term_get_int(priority), spec) != PQ_SUCCESS)
+        {
+            *err = "resource error: not enough memory for the operator.";
+            return PQ_FAILURE;
+        }
+        if(!is_list) return PQ_SUCCESS;
+        names = pq_term_deref(pq_term_get_arg(names, 1));
+    }
+
+    if(names != pq_new_atom_term(PQ_ATOM_NIL))
+    {
+        *err = "type error: expected an op/3 atom or list of atoms.";
+        return PQ_FAILURE;
+    }
+    return PQ_SUCCESS;
+}
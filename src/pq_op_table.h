@@ -0,0 +1,222 @@
+/**
+ * @file pq_op_table.h
+ * @author Brandon Foster
+ * @brief poqer-lang operator table header.
+ * the pq_op_table struct maps an atom to its prefix, infix, and postfix operator definitions.
+ * create/destroy the table with the pq_new_* and pq_del_* functions, it starts with the default operators.
+ * define/remove operators with pq_op_table_add function, or pq_op_table_add_terms function for the arguments of op/3.
+ * find the operator definitions of an atom with pq_op_table_lookup function.
+ * 
+ * @version 0.001
+ * @date 10-16-2026
+ * @copyright Brandon Foster (c) 2020-2021
+ */
+
+#ifndef _PQ_OP_TABLE_H
+#define _PQ_OP_TABLE_H
+#include "pq_globals.h"
+#include "pq_atom.h"
+#include "pq_term.h"
+#include <stdlib.h>
+
+typedef enum pq_op_specifier
+{
+    //infix
+    PQ_OP_XFX,
+    PQ_OP_XFY,
+    PQ_OP_YFX,
+
+    //prefix
+    PQ_OP_FX,
+    PQ_OP_FY,
+
+    //postfix
+    PQ_OP_XF,
+    PQ_OP_YF
+} pq_op_specifier;
+
+/**
+ * @brief The classes of operators, an atom can be an operator of each class at the same time.
+ */
+typedef enum pq_op_class
+{
+    PQ_OP_PREFIX,
+    PQ_OP_INFIX,
+    PQ_OP_POSTFIX,
+    PQ_OP_CLASS_COUNT
+} pq_op_class;
+
+//the highest priority of an operator.
+#define PQ_OP_MAX_PRIORITY 1200
+
+/**
+ * @brief An operator definition.
+ */
+typedef struct pq_op_def
+{
+    pq_priority priority; //the priority of the operator, 0 if the atom is not an operator of this class.
+    pq_op_specifier specifier; //the type of the operator.
+} pq_op_def;
+
+/**
+ * @brief The operator definitions of an atom.
+ */
+typedef struct pq_op_entry
+{
+    pq_atom atom; //PQ_ATOM_NONE for an empty slot.
+    pq_op_def defs[PQ_OP_CLASS_COUNT]; //indexed by pq_op_class.
+} pq_op_entry;
+
+/**
+ * @brief The structure of a poqer-lang operator table.
+ */
+typedef struct pq_op_table
+{   //these variables should only be read externally, not modified.
+
+    pq_op_entry* entries; //open addressing hash set keyed by atom.
+    uint32_t count; //the number of atoms in the table.
+    uint32_t slot_mask; //the number of entries minus 1, the number of entries is a power of 2.
+} pq_op_table;
+
+/**
+ * @brief Safe allocation for a pq_op_table struct, initializes the table with the default operators, then returns the pointer.
+ * 
+ * @return A pointer to the allocated pq_op_table struct.
+ */
+pq_op_table* pq_new_op_table(void);
+
+/**
+ * @brief Safe deallocation of a pq_op_table struct.
+ * 
+ * @param table The table that will be deallocated.
+ */
+void pq_del_op_table(pq_op_table* table);
+
+/**
+ * @brief Defines an operator like the op/3 directive, replacing the previous definition of the same class.
+ * 
+ * @param table The table that will be modified.
+ * @param atom The name of the operator.
+ * @param priority The priority of the operator, 0 removes the operator of the specifier's class.
+ * @param specifier The type of the operator.
+ * @return PQ_SUCCESS if the operator is defined else PQ_FAILURE.
+ */
+int pq_op_table_add(pq_op_table* table, const pq_atom atom, const pq_priority priority, const pq_op_specifier specifier);
+
+/**
+ * @brief Defines the operators of the arguments of op/3 (the directive and the builtin).
+ * The names before an invalid name of a list are defined.
+ * 
+ * @param table The table that will be modified.
+ * @param priority The priority, an integer from 0 to 1200.
+ * @param type The operator type (e.g. xfx).
+ * @param names An atom or a list of atoms.
+ * @param err The error is stored here upon failure.
+ * @return PQ_SUCCESS if the operators are defined else PQ_FAILURE.
+ */
+int pq_op_table_add_terms(pq_op_table* table, pq_term priority, pq_term type, pq_term names, char** err);
+
+/**
+ * @brief Gets the class of an operator type.
+ * 
+ * @param specifier The type of the operator.
+ * @return The class of the operator type.
+ */
+static inline pq_op_class pq_op_get_class(const pq_op_specifier specifier)
+{
+    switch(specifier)
+    {
+    case PQ_OP_FX:
+    case PQ_OP_FY:
+        return PQ_OP_PREFIX;
+    case PQ_OP_XF:
+    case PQ_OP_YF:
+        return PQ_OP_POSTFIX;
+    default:
+        return PQ_OP_INFIX;
+    }
+}
+
+/**
+ * @brief Converts an atom (e.g. xfx) into an operator type.
+ * 
+ * @param atom The atom that will be converted.
+ * @param specifier The operator type is stored here.
+ * @return PQ_SUCCESS if the atom is an operator type else PQ_FAILURE.
+ */
+static inline int pq_op_atom_to_specifier(const pq_atom atom, pq_op_specifier* specifier)
+{
+    switch(atom)
+    {
+    case PQ_ATOM_XFX: *specifier = PQ_OP_XFX; return PQ_SUCCESS;
+    case PQ_ATOM_XFY: *specifier = PQ_OP_XFY; return PQ_SUCCESS;
+    case PQ_ATOM_YFX: *specifier = PQ_OP_YFX; return PQ_SUCCESS;
+    case PQ_ATOM_FX: *specifier = PQ_OP_FX; return PQ_SUCCESS;
+    case PQ_ATOM_FY: *specifier = PQ_OP_FY; return PQ_SUCCESS;
+    case PQ_ATOM_XF: *specifier = PQ_OP_XF; return PQ_SUCCESS;
+    case PQ_ATOM_YF: *specifier = PQ_OP_YF; return PQ_SUCCESS;
+    default: return PQ_FAILURE;
+    }
+}
+
+/**
+ * @brief Gets the index of the first entry to probe for an atom.
+ * 
+ * @param table The table that will be used.
+ * @param atom The atom that will be hashed.
+ * @return The index of the entry.
+ */
+static inline uint32_t pq_op_table_hash(const pq_op_table* table, const pq_atom atom)
+{
+    //atom ids are dense, multiplicative hashing spreads them across the entries.
+    return (atom * 2654435761u) & table->slot_mask;
+}
+
+/**
+ * @brief Finds the operator definitions of an atom.
+ * 
+ * @param table The table that will be used.
+ * @param atom The atom that will be looked up, PQ_ATOM_NONE is never an operator.
+ * @return The operator definitions of the atom, NULL if the atom was never an operator.
+ */
+static inline const pq_op_entry* pq_op_table_lookup(const pq_op_table* table, const pq_atom atom)
+{
+    uint32_t i = pq_op_table_hash(table, atom);
+    for(;;)
+    {   //linear probing, the table is never more than half full so an empty entry is always found.
+        const pq_op_entry* entry = &table->entries[i];
+        if(entry->atom == PQ_ATOM_NONE) return NULL;
+        if(entry->atom == atom) return entry;
+        i = (i + 1) & table->slot_mask;
+    }
+}
+
+/**
+ * @brief Finds an operator definition of an atom.
+ * 
+ * @param table The table that will be used.
+ * @param atom The atom that will be looked up.
+ * @param op_class The class of the operator.
+ * @return The operator definition, NULL if the atom is not an operator of the class.
+ */
+static inline const pq_op_def* pq_op_table_get(const pq_op_table* table, const pq_atom atom, const pq_op_class op_class)
+{
+    const pq_op_entry* entry = pq_op_table_lookup(table, atom);
+    if(!entry || entry->defs[op_class].priority == 0) return NULL;
+    return &entry->defs[op_class];
+}
+
+/**
+ * @brief Checks if an atom is an operator of any class.
+ * 
+ * @param table The table that will be used.
+ * @param atom The atom that will be checked.
+ * @return true if the atom is an operator else false.
+ */
+static inline PQbool pq_op_table_is_operator(const pq_op_table* table, const pq_atom atom)
+{
+    const pq_op_entry* entry = pq_op_table_lookup(table, atom);
+    return entry && (entry->defs[PQ_OP_PREFIX].priority || entry->defs[PQ_OP_INFIX].priority || entry->defs[PQ_OP_POSTFIX].priority);
+}
+
+#endif
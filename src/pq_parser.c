@@ -10,630 +10,774 @@
  */
 
 #include "pq_parser.h"
+#include "pq_bigint.h"
 #include "pq_term.h"
+#include "pq_mapped_file.h"
 #include <string.h>
 
-pq_syntax_tree_node* pq_parse_prolog_text(pq_parser* parser);
-pq_syntax_tree_node* pq_parse_prolog_term(pq_parser* parser, pq_priority priority);
-pq_syntax_tree_node* pq_parse_prolog_prefix_op_or_functor_or_atom(pq_parser* parser, pq_priority priority);
-void* pq_parse_prolog_operand_or_arg_list(pq_parser* parser, const pq_priority priority, PQstr* node_type);
-pq_list* pq_parse_prolog_arg_list(pq_parser* parser);
-pq_term* pq_parse_prolog_arg(pq_parser* parser);
-pq_list* pq_parse_prolog_items(pq_parser* parser);
+pq_term pq_parse_prolog_clause(pq_parser* parser);
+pq_term pq_parse_prolog_term(pq_parser* parser, const pq_priority max_priority);
+pq_term pq_parse_prolog_primary(pq_parser* parser, pq_priority* priority);
+pq_term pq_parse_prolog_prefix_op_or_atom(pq_parser* parser, pq_priority* priority);
+pq_term pq_parse_prolog_reduce(pq_parser* parser, pq_term term, pq_priority* priority);
 
-static PQbool pq_syntax_name_is_spec_operator(const char* name, const pq_op_specifier spec)
+static inline void pq_parser_next_token(pq_parser* parser)
 {
-    //brute force implementation for default operators, will replace with a hash table in the future.
-    switch(spec)
-    {
-    case PQ_OP_XFX:
-        if(!strcmp(name, ":-") || !strcmp(name, "-->")
-        || !strcmp(name, "=") || !strcmp(name, "\\=")
-        || !strcmp(name, "==") || !strcmp(name, "\\==") || !strcmp(name, "@<") || !strcmp(name, "@=<") || !strcmp(name, "@>") || !strcmp(name, "@>=")
-        || !strcmp(name, "==..")
-        || !strcmp(name, "is") || !strcmp(name, "=:=") || !strcmp(name, "=\\=") || !strcmp(name, "<") || !strcmp(name, "=<") || !strcmp(name, ">") || !strcmp(name, ">=")
-        || !strcmp(name, "**"))
-            return PQ_TRUE;
-        break;
-    
-    case PQ_OP_XFY:
-        if(!strcmp(name, ";") || !strcmp(name, "->") || !strcmp(name, ",") || !strcmp(name, "^"))
-            return PQ_TRUE;
-        break;
-
-    case PQ_OP_YFX:
-        if(!strcmp(name, "+") || !strcmp(name, "-") || !strcmp(name, "/\\") || !strcmp(name, "\\/")
-        || !strcmp(name, "*") || !strcmp(name, "/") || !strcmp(name, "//") || !strcmp(name, "rem") || !strcmp(name, "mod") || !strcmp(name, "<<") || !strcmp(name, ">>"))
-            return PQ_TRUE;
-        break;
-
-    case PQ_OP_FX:
-        if(!strcmp(name, ":-") || !strcmp(name, "?-"))
-            return PQ_TRUE;
-        break;
-
-    case PQ_OP_FY:
-        if(!strcmp(name, "\\+") || !strcmp(name, "-") || !strcmp(name, "\\"))
-            return PQ_TRUE;
-        break;
-    
-    default:
-        break;
-    }
-
-    return PQ_FALSE;
+    pq_clear_token(&parser->tok);
+    pq_parser_clear_error(parser);
+    parser->curr_tok = pq_scanner_scan_token(parser->scanner, &parser->tok, &parser->err);
+    parser->err_owned = parser->err != NULL; //the lexer errors are allocated.
 }
 
-static PQbool pq_syntax_name_is_prefix_operator(const char* name)
+/**
+ * @brief Gets the lexeme of the current token without copying it.
+ * 
+ * @param parser The parser that will be used.
+ * @return The lexeme of the current token, it is valid until the next token is read.
+ */
+static inline pq_lexeme pq_parser_get_lexeme(const pq_parser* parser)
 {
-    return pq_syntax_name_is_spec_operator(name, PQ_OP_FX)
-    || pq_syntax_name_is_spec_operator(name, PQ_OP_FY);
+    return pq_scanner_get_token_lexeme(parser->scanner, parser->curr_tok);
 }
 
-static PQbool pq_syntax_name_is_operator(const char* name)
+/**
+ * @brief Gets the interned atom of the current token.
+ * 
+ * @param parser The parser that will be used.
+ * @return The atom of a name, comma, or head-tail separator token else PQ_ATOM_NONE.
+ */
+static inline pq_atom pq_parser_get_atom(const pq_parser* parser)
 {
-    return pq_syntax_name_is_spec_operator(name, PQ_OP_FX)
-    || pq_syntax_name_is_spec_operator(name, PQ_OP_FY)
-    || pq_syntax_name_is_spec_operator(name, PQ_OP_XFX)
-    || pq_syntax_name_is_spec_operator(name, PQ_OP_XFY)
-    || pq_syntax_name_is_spec_operator(name, PQ_OP_YFX)
-    || pq_syntax_name_is_spec_operator(name, PQ_OP_XF)
-    || pq_syntax_name_is_spec_operator(name, PQ_OP_YF);
+    return pq_token_has_atom(parser->curr_tok) ? parser->curr_tok->val.atom : PQ_ATOM_NONE;
 }
 
-// dead code atm, useful later
-// static pq_priority pq_syntax_get_op_priority(const char* name, const pq_op_specifier spec)
-// {
-//     switch(spec)
-//     {
-//     case PQ_OP_XFX:
-//         if(!strcmp(name, ":-") || !strcmp(name, "-->"))
-//             return 1200;
-//         if(!strcmp(name, "=") || !strcmp(name, "\\=")
-//         || !strcmp(name, "==") || !strcmp(name, "\\==") || !strcmp(name, "@<") || !strcmp(name, "@=<") || !strcmp(name, "@>") || !strcmp(name, "@>=")
-//         || !strcmp(name, "==..")
-//         || !strcmp(name, "is") || !strcmp(name, "=:=") || !strcmp(name, "=\\=") || !strcmp(name, "<") || !strcmp(name, "=<") || !strcmp(name, ">") || !strcmp(name, ">="))
-//             return 700;
-//         if(!strcmp(name, "**"))
-//             return 200;
-//         break;
-    
-//     case PQ_OP_XFY:
-//         if(!strcmp(name, ";")) return 1100;
-//         if(!strcmp(name, "->")) return 1050;
-//         if(!strcmp(name, ",")) return 1000;
-//         if(!strcmp(name, "^")) return 200;
-//         break;
-
-//     case PQ_OP_YFX:
-//         if(!strcmp(name, "+") || !strcmp(name, "-") || !strcmp(name, "/\\") || !strcmp(name, "\\/"))
-//             return 500;
-//         if(!strcmp(name, "*") || !strcmp(name, "/") || !strcmp(name, "//") || !strcmp(name, "rem") || !strcmp(name, "mod") || !strcmp(name, "<<") || !strcmp(name, ">>"))
-//             return 400;
-//         break;
-
-//     case PQ_OP_FX:
-//         if(!strcmp(name, ":-") || !strcmp(name, "?-")) return 1200;
-//         break;
-
-//     case PQ_OP_FY:
-//         if(!strcmp(name, "\\+")) return 900;
-//         if(!strcmp(name, "-") || !strcmp(name, "\\")) return 200;
-//         break;
-    
-//     default:
-//         break;
-//     }
-    
-//     return 0;
-// }
-
-static inline void pq_parser_next_token(pq_parser* parser)
+/**
+ * @brief Gets the lexeme of the current variable token for a term.
+ * Slices of a buffer owned by the scanner are not copied, they are valid as long as the buffer.
+ * A streaming scanner reuses its buffer, a mapped file is unmapped after parsing, and a string of the token is deallocated with it,
+ * so their lexemes are copied into the parser's arena instead.
+ * 
+ * @param parser The parser that will be used.
+ * @return The lexeme of the current token, it is valid as long as the buffer and the terms of the parser.
+ */
+static inline pq_lexeme pq_parser_take_lexeme(pq_parser* parser)
 {
-    parser->curr_tok = pq_scanner_next_token(parser->scanner, &parser->err); 
+    pq_lexeme lexeme = pq_parser_get_lexeme(parser);
+    if(!parser->curr_tok->_is_slice || pq_scanner_has_transient_buffer(parser->scanner))
+    {   //copies the lexeme before it is replaced.
+        char* str = pq_arena_alloc(parser->arena, lexeme.len + 1); //+1 for the null character.
+        memcpy(str, lexeme.str, lexeme.len);
+        str[lexeme.len] = '\0';
+        return pq_make_lexeme(str, lexeme.len);
+    }
+    return lexeme;
 }
 
-pq_syntax_tree* pq_parser_parse(pq_parser* parser)
+/**
+ * @brief Finds the slot of a variable name, it either holds the index of the variable or is the empty slot where the name belongs.
+ * 
+ * @param parser The parser that will be used.
+ * @param name The name of the variable.
+ * @return The index of the slot.
+ */
+static inline uint32_t pq_parser_find_var_slot(const pq_parser* parser, const pq_lexeme name)
 {
-    pq_syntax_tree* tree = pq_new_syntax_tree();
-    pq_parser_next_token(parser);
-    pq_parse_prolog_text(parser);
-    return tree;
+    uint32_t i = pq_atom_hash(name) & parser->var_slot_mask;
+    for(;;)
+    {   //linear probing, the slots are never more than half full so an empty slot is always found.
+        const uint32_t var = parser->var_slots[i];
+        if(var == UINT32_MAX) return i;
+        if(parser->vars[var].name.len == name.len && memcmp(parser->vars[var].name.str, name.str, name.len) == 0) return i;
+        i = (i + 1) & parser->var_slot_mask;
+    }
 }
 
-pq_syntax_tree_node* pq_parse_prolog_text(pq_parser* parser)
+/**
+ * @brief Doubles the slots and the variables of the parser.
+ * 
+ * @param parser The parser that will be modified, upon failure the error is stored here.
+ * @return PQ_SUCCESS if the variables were grown else PQ_FAILURE.
+ */
+static int pq_parser_grow_vars(pq_parser* parser)
 {
-    
-    if(!parser->curr_tok)
-    {   //represents the <prolog-text> ::= <EOR> production
-        return NULL;
+    const uint32_t cap = parser->vars_cap ? parser->vars_cap << 1 : 16;
+    pq_parse_var* vars = (pq_parse_var*)realloc(parser->vars, cap * sizeof(pq_parse_var));
+    if(!vars)
+    {
+        parser->err = "syntax error: not enough memory for the variables.";
+        return PQ_FAILURE;
     }
-    else
-    {   //represents 1 of the 2 productions:
-        //<prolog-text> ::= <directive-term> <prolog-text>
-        //<prolog-text> ::= <clause-term> <prolog-text>
+    parser->vars = vars;
+    parser->vars_cap = cap;
 
-        //first perform a <term> <end> check, b.c. <directive-term> and <clause-term> requires it.
-        pq_syntax_tree_node* term_node = pq_parse_prolog_term(parser, 1200);
-        if(parser->err) return NULL;
+    uint32_t* slots = (uint32_t*)malloc(2 * (size_t)cap * sizeof(uint32_t));
+    if(!slots)
+    {
+        parser->err = "syntax error: not enough memory for the variables.";
+        return PQ_FAILURE;
+    }
+    free(parser->var_slots);
+    parser->var_slots = slots;
+    parser->var_slot_mask = 2 * cap - 1;
+    memset(slots, 0xFF, 2 * (size_t)cap * sizeof(uint32_t));
 
-        if(parser->curr_tok && parser->curr_tok->tag == PQ_END_TOK)
-        {
-            pq_parser_next_token(parser);
-            if(parser->err) return NULL;
+    //rehashes the variables of the clause.
+    for(uint32_t i = 0; i < parser->vars_sz; i++)
+    {
+        parser->vars[i].slot = pq_parser_find_var_slot(parser, parser->vars[i].name);
+        parser->var_slots[parser->vars[i].slot] = i;
+    }
+    return PQ_SUCCESS;
+}
 
-            /*
-                todo: determine whether the term is a directive or clause term.
-            */
+/**
+ * @brief Gets the variable of the current variable token.
+ * Every occurrence of a name in a clause is the same variable, except for the anonymous variable '_'.
+ * 
+ * @param parser The parser that will be used, upon failure the error is stored here.
+ * @return The variable term.
+ */
+static pq_term pq_parser_get_var(pq_parser* parser)
+{
+    const pq_lexeme name = pq_parser_get_lexeme(parser);
+    if(name.len == 1 && name.str[0] == '_') return pq_new_variable_term(parser->arena);
+
+    if(parser->vars_sz == parser->vars_cap && pq_parser_grow_vars(parser) != PQ_SUCCESS) return PQ_TERM_NONE;
+    const uint32_t slot = pq_parser_find_var_slot(parser, name);
+    if(parser->var_slots[slot] != UINT32_MAX) return parser->vars[parser->var_slots[slot]].term;
+
+    pq_parse_var* var = &parser->vars[parser->vars_sz];
+    var->name = pq_parser_take_lexeme(parser);
+    var->term = pq_new_variable_term(parser->arena);
+    var->slot = slot;
+    parser->var_slots[slot] = parser->vars_sz++;
+    return var->term;
+}
 
-            //performs the right-recursive <prolog-text> after.
-            pq_syntax_tree_add_right_sibling_node(term_node, pq_parse_prolog_text(parser));
-            return term_node;
-        }
-        else
-        {   //syntax error: expected end token.
-            parser->err = "syntax error: expected an end token.";
-            return NULL;
-        }
-    }
-    
-    parser->err = "syntax error: expected an empty line.";
-    return NULL;
+pq_lexeme pq_parser_get_var_name(const pq_parser* parser, const pq_term var)
+{
+    for(uint32_t i = 0; i < parser->vars_sz; i++)
+        if(parser->vars[i].term == var) return parser->vars[i].name;
+    return PQ_LEXEME_LITERAL("");
 }
 
-pq_syntax_tree_node* pq_parse_prolog_term(pq_parser* parser, pq_priority priority)
+pq_term pq_parser_next_clause(pq_parser* parser)
 {
-    if(!parser->curr_tok) 
-    {   //needs at least 1 token.
-        parser->err = "syntax error: expected a term.";
-        return NULL;
+    if(parser->err) return PQ_TERM_NONE;
+    if(parser->needs_token)
+    {   //reads the first token of the clause, it is not read with the previous clause so a stream is not waited on early.
+        parser->needs_token = 0;
+        pq_parser_next_token(parser);
+        if(parser->err) return PQ_TERM_NONE;
     }
 
-    if(priority > 0)
-    {   //parses operator notation
-        if(parser->curr_tok->tag == PQ_NAME_TOK && pq_syntax_name_is_prefix_operator(parser->curr_tok->val.s))
-        {   //can either be a prefix operator with a right operand, a functor with an arg list of 2 or more, or the operator by itself as an atom
-            return pq_parse_prolog_prefix_op_or_functor_or_atom(parser, priority);
-        }
+    //represents the <prolog-text> ::= <EOR> production
+    if(!parser->curr_tok) return PQ_TERM_NONE;
+    return pq_parse_prolog_clause(parser);
+}
 
-        //must be a term with 0 priority, original priority resets to 1200
-        priority = 1200;
-        pq_syntax_tree_node* left_operand_node = pq_parse_prolog_term(parser, 0);
-        if(parser->err) return NULL;
+void pq_parser_skip_clause(pq_parser* parser)
+{
+    for(;;)
+    {
         if(!parser->curr_tok)
-        {   //left operand is just a term by itself
-            pq_term* term = left_operand_node->item;
-            term->priority = 1201;
-            return left_operand_node;
+        {   //a lexer error leaves the scanner at the start of the bad token, else the input ended.
+            if(!parser->err) break;
+            pq_scanner_skip_char(parser->scanner);
         }
-        else if(parser->curr_tok->tag == PQ_END_TOK)
-        {
-            return left_operand_node;
-        }
-
-        //check for an infix/postfix operator or just returns the left operand as a term
-        const char* op_name = parser->curr_tok->val.s;
-        if(pq_syntax_name_is_spec_operator(op_name, PQ_OP_XFX))
-        {
-            pq_parser_next_token(parser);
-            pq_syntax_tree_node* right_operand_node = pq_parse_prolog_term(parser, priority-1);
-            if(parser->err) return NULL;
-
-            pq_syntax_tree_node* op_node = pq_new_syntax_tree_node(pq_new_operator_term(op_name, 1201, PQ_OP_XFX));
-            pq_syntax_tree_add_right_sibling_node(left_operand_node, op_node);
-            pq_syntax_tree_add_right_sibling_node(op_node, right_operand_node);
-            return left_operand_node;
-        }
-        else if(pq_syntax_name_is_spec_operator(op_name, PQ_OP_XFY))
-        {
-            pq_parser_next_token(parser);
-            pq_syntax_tree_node* right_operand_node = pq_parse_prolog_term(parser, priority);
-            if(parser->err) return NULL;
-
-            pq_syntax_tree_node* op_node = pq_new_syntax_tree_node(pq_new_operator_term(op_name, 1201, PQ_OP_XFY));
-            pq_syntax_tree_add_right_sibling_node(left_operand_node, op_node);
-            pq_syntax_tree_add_right_sibling_node(op_node, right_operand_node);
-            return left_operand_node;
-        }
-        else if(pq_syntax_name_is_spec_operator(op_name, PQ_OP_YFX))
-        {
-            pq_parser_next_token(parser);
-            pq_syntax_tree_node* right_operand_node = pq_parse_prolog_term(parser, priority);
-            if(parser->err) return NULL;
+        else if(parser->curr_tok->tag == PQ_END_TOK) break;
+        pq_parser_next_token(parser);
+    }
+    pq_parser_clear_error(parser);
+    parser->needs_token = 1;
+}
 
-            pq_syntax_tree_node* op_node = pq_new_syntax_tree_node(pq_new_operator_term(op_name, 1201, PQ_OP_YFX));
-            pq_syntax_tree_add_right_sibling_node(left_operand_node, op_node);
-            pq_syntax_tree_add_right_sibling_node(op_node, right_operand_node);
-            return left_operand_node;
-        }
-        else if(pq_syntax_name_is_spec_operator(op_name, PQ_OP_XF))
-        {
-            pq_parser_next_token(parser);
-            pq_syntax_tree_node* op_node = pq_new_syntax_tree_node(pq_new_operator_term(op_name, 1201, PQ_OP_XF));
-            pq_syntax_tree_add_right_sibling_node(left_operand_node, op_node);
-            return left_operand_node;
-        }
-        else if(pq_syntax_name_is_spec_operator(op_name, PQ_OP_YF))
-        {
-            pq_parser_next_token(parser);
-            pq_syntax_tree_node* op_node = pq_new_syntax_tree_node(pq_new_operator_term(op_name, 1201, PQ_OP_YF));
-            pq_syntax_tree_add_right_sibling_node(left_operand_node, op_node);
-            return left_operand_node;
-        }
-        else
-        {   //left operand is just a term by itself
-            pq_term* term = left_operand_node->item;
-            term->priority = 1201;
-            return left_operand_node;
-        } 
+pq_syntax_tree* pq_parser_parse(pq_parser* parser)
+{   //represents the <prolog-text> ::= <clause-term> <prolog-text> production, one clause per iteration.
+    pq_syntax_tree* tree = pq_new_arena_syntax_tree(parser->arena);
+    pq_term term;
+    while((term = pq_parser_next_clause(parser)) != PQ_TERM_NONE)
+    {   //appends the clause as the last child of the tree.
+        pq_term* cell = (pq_term*)pq_arena_alloc(parser->arena, sizeof(pq_term));
+        *cell = term;
+        pq_syntax_tree_add_left_sibling_node(tree->children_nil, pq_new_arena_syntax_tree_node(parser->arena, cell));
     }
-    else
-    {
-        switch(parser->curr_tok->tag)
-        {
-        case PQ_LPAR_TOK:
-        {   //represents the <term> ::= <open-par> <term> <close-par> production
-            pq_parser_next_token(parser);
-            pq_syntax_tree_node* term_node = pq_parse_prolog_term(parser, 1201);
-            if(parser->err) return NULL;
-            if(!parser->curr_tok || parser->curr_tok->tag != PQ_RPAR_TOK)
-            {
-                parser->err = "syntax error: expected a closing parenthesis";
-                return NULL;
-            }
-            pq_parser_next_token(parser);
-            pq_term* term = (pq_term*)term_node->item;
-            term->priority = 0;
-            return term_node;
-        }
+    return tree;
+}
 
-        //parses numeric constants
-        case PQ_INT_TOK:
-        {   //represents the <term> ::= <integer> production
-            pq_syntax_tree_node* term_node = pq_new_syntax_tree_node(pq_new_integer_term(parser->curr_tok->val.i));
-            pq_parser_next_token(parser);
-            return term_node;
-        }
+pq_syntax_tree* pq_parser_consult_file(pq_parser* parser, const char* path)
+{
+    pq_parser_restart(parser);
+    pq_mapped_file file;
+    if(pq_map_file(&file, path) != PQ_SUCCESS)
+    {
+        parser->err = "consult error: could not read the file.";
+        return NULL;
+    }
 
-        case PQ_FLT_TOK:
-        {   //represents the <term> ::= <float-number> production
-            pq_syntax_tree_node* term_node = pq_new_syntax_tree_node(pq_new_float_term(parser->curr_tok->val.f));
-            pq_parser_next_token(parser);
-            return term_node;
-        }
+    //scans directly from the mapping, then detaches the scanner before unmapping it.
+    pq_scanner_set_buffer_view(parser->scanner, file.buffer, file.buffer_sz);
+    pq_syntax_tree* tree = pq_parser_parse(parser);
+    pq_clear_token(&parser->tok);
+    parser->curr_tok = NULL;
+    pq_scanner_set_buffer_view(parser->scanner, "", 0);
+    pq_unmap_file(&file);
+    return tree;
+}
 
-        //parses variables
-        case PQ_VAR_TOK:
-        {   //represents the <term> ::= <variable> production
-            pq_syntax_tree_node* term_node = pq_new_syntax_tree_node(pq_new_variable_term(parser->curr_tok->val.s));
-            pq_parser_next_token(parser);
-            return term_node;
-        }
+/**
+ * @brief Runs the term of a clause if it is a directive.
+ * The directives take effect before the next clause is parsed, only op/3 is supported at the moment.
+ * 
+ * @param parser The parser that will be modified, upon failure the error is stored here.
+ * @param term The clause term.
+ */
+static void pq_parser_run_directive(pq_parser* parser, const pq_term term)
+{
+    if(pq_term_get_tag(term) != PQ_TAG_STR || pq_term_get_name(term) != PQ_ATOM_NECK || pq_term_get_arity(term) != 1)
+        return; //not a directive.
 
-        //parses list notation
-        case PQ_LLIST_TOK:
-            pq_parser_next_token(parser);
-            if(parser->err) return NULL;
-            if(!parser->curr_tok)
-            {
-                parser->err = "syntax error: expected the end of the list";
-                return NULL;
-            }
+    const pq_term goal = pq_term_deref(pq_term_get_arg(term, 0));
+    if(pq_term_get_tag(goal) == PQ_TAG_STR && pq_term_get_name(goal) == PQ_ATOM_OP && pq_term_get_arity(goal) == 3)
+        pq_op_table_add_terms(parser->ops, pq_term_get_arg(goal, 0), pq_term_get_arg(goal, 1), pq_term_get_arg(goal, 2), &parser->err);
+}
 
-            if(parser->curr_tok->tag == PQ_RLIST_TOK)
-            {   //represents the <atom> ::= <open-list> <close-list> production
-                pq_parser_next_token(parser);
-                return pq_new_syntax_tree_node(pq_new_list_term(NULL));
-            }
-            else
-            {   //represents the <term> ::= <open-list> <items> <close-list> production
-                pq_list* items = pq_parse_prolog_items(parser);
-                if(parser->err) return NULL;
-                if(parser->curr_tok && parser->curr_tok->tag == PQ_RLIST_TOK)
-                {
-                    pq_parser_next_token(parser);
-                    return pq_new_syntax_tree_node(pq_new_list_term(items));
-                }
-                else
-                {
-                    parser->err = "syntax error: expected the end of the list";
-                    return NULL;
-                }
-            }
-            break;
+/**
+ * @brief Checks if the current token ends a term (e.g. the ',' after an argument or the end token).
+ * An operator atom followed by one of these tokens is an operand by itself.
+ * 
+ * @param parser The parser that will be used.
+ * @return true if there are no more tokens or the current token closes a term else false.
+ */
+static inline PQbool pq_parser_at_term_delimiter(const pq_parser* parser)
+{
+    if(!parser->curr_tok) return PQ_TRUE;
+    switch(parser->curr_tok->tag)
+    {
+    case PQ_END_TOK:
+    case PQ_RPAR_TOK:
+    case PQ_RLIST_TOK:
+    case PQ_RCURLY_TOK:
+    case PQ_COMMA_TOK:
+    case PQ_HT_SEP_TOK:
+        return PQ_TRUE;
+    default:
+        return PQ_FALSE;
+    }
+}
 
-        //parses curly bracket notation
-        case PQ_LCURLY_TOK:
-            pq_parser_next_token(parser);
-            if(parser->err) return NULL;
-            if(!parser->curr_tok)
-            {
-                parser->err = "syntax error: expected a closing curly bracket";;
-                return NULL;
-            }
+/**
+ * @brief Gets the highest priority of an operator's definitions, it is the priority of the operator as an atom.
+ * 
+ * @param entry The operator definitions of the atom, NULL if the atom is not an operator.
+ * @return The highest priority, 0 if the atom is not an operator.
+ */
+static inline pq_priority pq_parser_get_atom_priority(const pq_op_entry* entry)
+{
+    pq_priority priority = 0;
+    if(!entry) return priority;
+    for(int i = 0; i < PQ_OP_CLASS_COUNT; i++)
+        if(entry->defs[i].priority > priority) priority = entry->defs[i].priority;
+    return priority;
+}
 
-            if(parser->curr_tok->tag == PQ_RCURLY_TOK)
-            {   //represents the <atom> ::= <open-curly> <close-curly> production
-                pq_parser_next_token(parser);
-                pq_syntax_tree_node* term_node = pq_new_syntax_tree_node(pq_new_atom_term("{}", 0));
-                return term_node;
-            }
-            else
-            {   //represents the <term> ::= <open-curly> <term> <close-curly> production
-                pq_parser_next_token(parser);
+/**
+ * @brief Creates the term of an operator applied to its operands, e.g. a+b is the term +(a, b).
+ * 
+ * @param parser The parser that will be used.
+ * @param op_name The name of the operator.
+ * @param left The left operand, PQ_TERM_NONE for a prefix operator.
+ * @param right The right operand, PQ_TERM_NONE for a postfix operator.
+ * @return The compound term.
+ */
+static inline pq_term pq_parser_make_op_term(pq_parser* parser, const pq_atom op_name, const pq_term left, const pq_term right)
+{
+    pq_term args[2];
+    uint32_t arity = 0;
+    if(left != PQ_TERM_NONE) args[arity++] = left;
+    if(right != PQ_TERM_NONE) args[arity++] = right;
+    return pq_new_functor_term(parser->arena, op_name, arity, args);
+}
 
-                pq_syntax_tree_node* term_node = pq_parse_prolog_term(parser, 1201);
-                if(parser->err) return NULL;
+/**
+ * @brief Appends a parsed argument (or list item) to the arguments of the unfinished terms.
+ * 
+ * @param parser The parser that will be modified, upon failure the error is stored here.
+ * @param term The argument.
+ */
+static inline void pq_parser_push_arg(pq_parser* parser, const pq_term term)
+{
+    if(parser->args_sz == parser->args_cap)
+    {   //doubles the arguments.
+        const size_t cap = parser->args_cap ? parser->args_cap << 1 : 64;
+        pq_term* args = (pq_term*)realloc(parser->args, cap * sizeof(pq_term));
+        if(!args)
+        {
+            parser->err = "syntax error: not enough memory for the term.";
+            return;
+        }
+        parser->args = args;
+        parser->args_cap = cap;
+    }
+    parser->args[parser->args_sz++] = term;
+}
 
-                if(!parser->curr_tok || parser->curr_tok->tag != PQ_RCURLY_TOK)
-                {
-                    parser->err = "syntax error: expected a closing curly bracket";
-                    return NULL;
-                }
-                pq_parser_next_token(parser);
+/**
+ * @brief Creates a compound from the parsed arguments of a functor, the arguments are popped.
+ * 
+ * @param parser The parser that will be modified, upon failure the error is stored here.
+ * @param name The name of the functor.
+ * @param args_start The index of the first argument.
+ * @return The compound term.
+ */
+static inline pq_term pq_parser_make_compound(pq_parser* parser, const pq_atom name, const size_t args_start)
+{
+    const size_t arity = parser->args_sz - args_start;
+    if(arity > PQ_TERM_ARITY_MAX)
+    {
+        parser->err = "syntax error: the compound has too many arguments.";
+        return PQ_TERM_NONE;
+    }
 
-                pq_list* arg_list = pq_new_list();
-                pq_list_push_back(arg_list, term_node->item);
-                return pq_new_syntax_tree_node(pq_new_functor_term("{}", 0, arg_list));
-            }
-            break;
+    pq_term* cells = (pq_term*)pq_arena_alloc(parser->arena, (1 + arity) * sizeof(pq_term));
+    if(!cells)
+    {
+        parser->err = "syntax error: not enough memory for the term.";
+        return PQ_TERM_NONE;
+    }
+    cells[0] = pq_make_functor_cell(name, (uint32_t)arity);
+    memcpy(&cells[1], &parser->args[args_start], arity * sizeof(pq_term));
+    parser->args_sz = args_start;
+    return pq_make_ptr_term(cells, PQ_TAG_STR);
+}
 
-        //parses functional notation or atom
-        case PQ_NAME_TOK:
-        {
-            PQstr atom_id = parser->curr_tok->val.s;
-            pq_priority atom_priority;
-            if(pq_syntax_name_is_operator(atom_id))
-            {   //represents the <term> ::= <atom> production, where <atom> is an operator
-                atom_priority = 1201;
-            }
-            else
-            {   //represents the <term> ::= <atom> production, where <atom> is not an operator
-                atom_priority = 0;
-            }
-            pq_parser_next_token(parser);
+/**
+ * @brief Creates a list from the parsed items of a list, the items are popped.
+ * The list cells are packed in one allocation, the tail cell of each item is followed by the next item.
+ * 
+ * @param parser The parser that will be modified, upon failure the error is stored here.
+ * @param args_start The index of the first item.
+ * @param has_tail Whether the last item is the tail of the list (after the head-tail separator).
+ * @return The list term.
+ */
+static inline pq_term pq_parser_make_list(pq_parser* parser, const size_t args_start, const PQbool has_tail)
+{
+    const size_t items_sz = parser->args_sz - args_start - (has_tail ? 1 : 0);
+    pq_term* cells = (pq_term*)pq_arena_alloc(parser->arena, 2 * items_sz * sizeof(pq_term));
+    if(!cells)
+    {
+        parser->err = "syntax error: not enough memory for the term.";
+        return PQ_TERM_NONE;
+    }
 
-            //Checks for a potential functor
-            if(parser->curr_tok && parser->curr_tok->tag == PQ_LPAR_TOK)
-            {   //represents the <term> ::= <atom> <open-par> <arg-list> <close-par> production
-                pq_parser_next_token(parser);
+    const pq_term* items = &parser->args[args_start];
+    for(size_t i = 0; i < items_sz; i++)
+    {
+        cells[2 * i] = items[i];
+        cells[2 * i + 1] = pq_make_ptr_term(&cells[2 * i + 2], PQ_TAG_LIST);
+    }
+    cells[2 * items_sz - 1] = has_tail ? items[items_sz] : pq_new_atom_term(PQ_ATOM_NIL);
+    parser->args_sz = args_start;
+    return pq_make_ptr_term(cells, PQ_TAG_LIST);
+}
 
-                pq_list* args = pq_parse_prolog_arg_list(parser);
-                if(parser->err) return NULL;
+pq_term pq_parse_prolog_clause(pq_parser* parser)
+{   //represents 1 of the 2 productions:
+    //<directive-term> ::= <term> <end>
+    //<clause-term> ::= <term> <end>
 
-                if(!parser->curr_tok || parser->curr_tok->tag != PQ_RPAR_TOK)
-                {
-                    parser->err = "syntax error: expected a closing parenthesis";
-                    return NULL;
-                }
-                pq_parser_next_token(parser);
-                return pq_new_syntax_tree_node(pq_new_functor_term(atom_id, 0, args));
-            }
-            else
-            {   //not a functor, returns the atom alone.
-                return pq_new_syntax_tree_node(pq_new_atom_term(atom_id, atom_priority));
-            }
-        }
+    pq_parser_clear_vars(parser);
+    pq_term term = pq_parse_prolog_term(parser, 1200);
+    if(parser->err) return PQ_TERM_NONE;
 
-        default:
-            break;
-        }
+    if(!parser->curr_tok || parser->curr_tok->tag != PQ_END_TOK)
+    {   //syntax error: expected end token.
+        parser->err = "syntax error: expected an end token.";
+        return PQ_TERM_NONE;
     }
+    parser->needs_token = 1;
 
-    parser->err = "syntax error: expected a term.";
-    return NULL;
+    pq_parser_run_directive(parser, term);
+    if(parser->err) return PQ_TERM_NONE;
+    return term;
 }
 
-pq_syntax_tree_node* pq_parse_prolog_prefix_op_or_functor_or_atom(pq_parser* parser, pq_priority priority)
+/**
+ * @brief Pushes an unfinished term onto the work stack of the parser.
+ * 
+ * @param parser The parser that will be used, upon failure the error is stored here.
+ * @param kind The pq_parse_frame_kind of the term.
+ * @param max_priority The highest priority of operator notation, it is only used by PQ_PARSE_TERM.
+ * @return The new frame, NULL if the term is nested too deeply.
+ */
+static inline pq_parse_frame* pq_parser_push_frame(pq_parser* parser, const pq_parse_frame_kind kind, const pq_priority max_priority)
 {
-    if(!parser->curr_tok || parser->curr_tok->tag != PQ_NAME_TOK || !pq_syntax_name_is_prefix_operator(parser->curr_tok->val.s))
+    if(parser->stack_sz >= parser->max_depth)
     {
-        parser->err = "syntax error: expected a prefix operator";
+        parser->err = "syntax error: the term is nested too deeply.";
         return NULL;
     }
+    if(parser->stack_sz == parser->stack_cap)
+    {   //doubles the stack, it is kept between the clauses.
+        size_t cap = parser->stack_cap ? parser->stack_cap << 1 : 64;
+        pq_parse_frame* stack = (pq_parse_frame*)realloc(parser->stack, cap * sizeof(pq_parse_frame));
+        if(!stack)
+        {
+            parser->err = "syntax error: not enough memory for the term.";
+            return NULL;
+        }
+        parser->stack = stack;
+        parser->stack_cap = cap;
+    }
 
-    PQstr op_name = parser->curr_tok->val.s;
-    pq_op_specifier op_spec;
-    pq_priority operand_priority;
+    pq_parse_frame* frame = &parser->stack[parser->stack_sz++];
+    frame->left = PQ_TERM_NONE;
+    frame->args_start = parser->args_sz;
+    frame->op = PQ_ATOM_NONE;
+    frame->max_priority = max_priority;
+    frame->left_priority = 0;
+    frame->op_priority = 0;
+    frame->kind = kind;
+    return frame;
+}
 
-    if(pq_syntax_name_is_spec_operator(op_name, PQ_OP_FX))
-    {
-        op_spec = PQ_OP_FX;
-        operand_priority = priority - 1;
-    }
-    else
+pq_term pq_parse_prolog_term(pq_parser* parser, const pq_priority max_priority)
+{   //the terms are parsed with an explicit work stack instead of recursion.
+    //each unfinished term is a frame, a primary term is parsed for the top frame then it is reduced into the frames below,
+    //until a frame needs another operand (or argument) or the stack is empty.
+
+    parser->stack_sz = 0;
+    parser->args_sz = 0;
+    if(!pq_parser_push_frame(parser, PQ_PARSE_TERM, max_priority)) return PQ_TERM_NONE;
+
+    for(;;)
     {
-        op_spec = PQ_OP_FY;
-        operand_priority = priority;
+        //parses a primary term, PQ_TERM_NONE if a frame was pushed instead (e.g. an open parenthesis).
+        pq_priority priority = 0;
+        pq_term term = pq_parse_prolog_primary(parser, &priority);
+        if(parser->err) return PQ_TERM_NONE;
+
+        while(term != PQ_TERM_NONE)
+        {   //finishes the frames that are complete.
+            if(!parser->stack_sz) return term;
+            term = pq_parse_prolog_reduce(parser, term, &priority);
+            if(parser->err) return PQ_TERM_NONE;
+        }
     }
-    pq_parser_next_token(parser);
-    if(parser->err) return NULL;
+}
+
+pq_term pq_parse_prolog_primary(pq_parser* parser, pq_priority* priority)
+{   //the top frame is a PQ_PARSE_TERM waiting for its first operand.
+    //the priority of the primary term is stored in priority, it is 0 unless the term is an operator atom.
 
-    if(!parser->curr_tok)
-    {   //represents the <term> ::= <atom> production where <atom> is the prefix operator
-        return pq_new_syntax_tree_node(pq_new_atom_term(op_name, 1201));
+    if(!parser->curr_tok) 
+    {   //needs at least 1 token.
+        parser->err = "syntax error: expected a term.";
+        return PQ_TERM_NONE;
     }
 
     switch(parser->curr_tok->tag)
     {
     case PQ_LPAR_TOK:
-    {
-        //represents the right operand or a functor's arg list
-        PQstr node_type;
-        void* syntax_node = pq_parse_prolog_operand_or_arg_list(parser, operand_priority, &node_type);
-        if(parser->err) return NULL;
-
-        if(!strcmp(node_type, "arg-list"))
-        {   //returns a functor
-            pq_list* arg_list = syntax_node;
-            return pq_new_syntax_tree_node(pq_new_functor_term(op_name, 0, arg_list));
-        }
-        else
-        {   //returns the prefix op with right operand
-            pq_syntax_tree_node* right_operand_node = syntax_node;
-            pq_term* right_operand = (pq_term*)right_operand_node->item;
-
-            //check for negative numeric constant
-            if(!strcmp(op_name, "-"))
-            {
-                if(right_operand->types & PQ_TERM_INTEGER_TYPE)
-                    right_operand->data.int_val *= -1;
-                else if(right_operand->types & PQ_TERM_FLOAT_TYPE)
-                    right_operand->data.float_val *= -1.0;
-                return right_operand_node;
-            }
+    case PQ_OPEN_CT_TOK:
+        //represents the <term> ::= <open-par> <term> <close-par> production
+        pq_parser_next_token(parser);
+        if(!pq_parser_push_frame(parser, PQ_PARSE_PAREN, 0)) return PQ_TERM_NONE;
+        pq_parser_push_frame(parser, PQ_PARSE_TERM, 1200);
+        return PQ_TERM_NONE;
 
-            pq_syntax_tree_node* term_node = pq_new_syntax_tree_node(pq_new_operator_term(op_name, 1201, op_spec));
-            pq_syntax_tree_add_right_sibling_node(term_node, right_operand_node);
-            return term_node;
-        }
-        return NULL;
+    //parses numeric constants
+    case PQ_INT_TOK:
+    {   //represents the <term> ::= <integer> production
+        pq_term term = pq_new_integer_term(parser->arena, parser->curr_tok->val.i);
+        pq_parser_next_token(parser);
+        return term;
+    }
+
+    case PQ_BIGINT_TOK:
+    {   //represents the <term> ::= <integer> production, for an integer that does not fit in a PQint.
+        pq_term term = pq_new_bigint_term(parser->arena, pq_parser_get_lexeme(parser), PQ_FALSE);
+        pq_parser_next_token(parser);
+        return term;
     }
 
-    case PQ_NAME_TOK:
-    case PQ_INT_TOK:
     case PQ_FLT_TOK:
+    {   //represents the <term> ::= <float-number> production
+        pq_term term = pq_new_float_term(parser->arena, parser->curr_tok->val.f);
+        pq_parser_next_token(parser);
+        return term;
+    }
+
+    //parses variables
     case PQ_VAR_TOK:
+    {   //represents the <term> ::= <variable> production
+        pq_term term = pq_parser_get_var(parser);
+        if(parser->err) return PQ_TERM_NONE;
+        pq_parser_next_token(parser);
+        return term;
+    }
+
+    //parses list notation
     case PQ_LLIST_TOK:
-    case PQ_LCURLY_TOK:
-    {
-        //represents the right operand
-        pq_syntax_tree_node* right_operand_node = pq_parse_prolog_term(parser, operand_priority);
-        if(parser->err) return NULL;
-        pq_term* right_operand = (pq_term*)right_operand_node->item;
+        pq_parser_next_token(parser);
+        if(parser->err) return PQ_TERM_NONE;
+        if(!parser->curr_tok)
+        {
+            parser->err = "syntax error: expected the end of the list";
+            return PQ_TERM_NONE;
+        }
+
+        if(parser->curr_tok->tag == PQ_RLIST_TOK)
+        {   //represents the <atom> ::= <open-list> <close-list> production
+            pq_parser_next_token(parser);
+            return pq_new_atom_term(PQ_ATOM_NIL);
+        }
+
+        //represents the <term> ::= <open-list> <items> <close-list> production
+        pq_parse_frame* frame = pq_parser_push_frame(parser, PQ_PARSE_ITEMS, 0);
+        if(!frame) return PQ_TERM_NONE;
+        pq_parser_push_frame(parser, PQ_PARSE_TERM, 999);
+        return PQ_TERM_NONE;
 
-        //check for negative numeric constant
-        if(!strcmp(op_name, "-"))
+    //parses curly bracket notation
+    case PQ_LCURLY_TOK:
+        pq_parser_next_token(parser);
+        if(parser->err) return PQ_TERM_NONE;
+        if(!parser->curr_tok)
         {
-            if(right_operand->types & PQ_TERM_INTEGER_TYPE)
-                right_operand->data.int_val *= -1;
-            else if(right_operand->types & PQ_TERM_FLOAT_TYPE)
-                right_operand->data.float_val *= -1.0;
-            return right_operand_node;
+            parser->err = "syntax error: expected a closing curly bracket";
+            return PQ_TERM_NONE;
         }
 
-        pq_syntax_tree_node* term_node = pq_new_syntax_tree_node(pq_new_operator_term(op_name, 1201, op_spec));
-        pq_syntax_tree_add_right_sibling_node(term_node, right_operand_node);
-        return term_node;
-    }
+        if(parser->curr_tok->tag == PQ_RCURLY_TOK)
+        {   //represents the <atom> ::= <open-curly> <close-curly> production
+            pq_parser_next_token(parser);
+            return pq_new_atom_term(PQ_ATOM_CURLY);
+        }
+
+        //represents the <term> ::= <open-curly> <term> <close-curly> production
+        if(!pq_parser_push_frame(parser, PQ_PARSE_CURLY, 0)) return PQ_TERM_NONE;
+        pq_parser_push_frame(parser, PQ_PARSE_TERM, 1200);
+        return PQ_TERM_NONE;
+
+    //parses functional notation, prefix operator notation, or atom
+    case PQ_NAME_TOK:
+        return pq_parse_prolog_prefix_op_or_atom(parser, priority);
 
     default:
-        //represents the <term> ::= <atom> production where <atom> is the prefix operator
-        return pq_new_syntax_tree_node(pq_new_atom_term(op_name, 1201));
+        break;
     }
+
+    parser->err = "syntax error: expected a term.";
+    return PQ_TERM_NONE;
 }
 
-void* pq_parse_prolog_operand_or_arg_list(pq_parser* parser, const pq_priority priority, PQstr* node_type)
+pq_term pq_parse_prolog_prefix_op_or_atom(pq_parser* parser, pq_priority* priority)
 {
-    pq_syntax_tree_node* syntax_node = pq_parse_prolog_term(parser, 1201);
-    if(parser->err) return NULL;
-
-    if(parser->curr_tok && parser->curr_tok->tag == PQ_COMMA_TOK)
-    {   //start an arg list
-        *node_type = "arg-list";
-        pq_term* arg = (pq_term*)syntax_node->item;
-        arg->priority = 999;
-        
-        pq_list* arg_list = pq_new_list();
-        pq_list_push_back(arg_list, arg);
-
-        while(parser->curr_tok && parser->curr_tok->tag == PQ_COMMA_TOK)
-        {   
-            pq_parser_next_token(parser);
-            
-            arg = pq_parse_prolog_arg(parser);
-            if(parser->err) return NULL;
-            pq_list_push_back(arg_list, arg);
-        }
+    const pq_priority max_priority = parser->stack[parser->stack_sz - 1].max_priority;
+    const pq_atom atom_id = pq_parser_get_atom(parser);
+    const pq_op_entry* op_entry = pq_op_table_lookup(parser->ops, atom_id);
+    pq_parser_next_token(parser);
+    if(parser->err) return PQ_TERM_NONE;
 
-        return arg_list;
-    }
-    else
-    {   //return as an operand
-        *node_type = "operand";
-        pq_term* operand = (pq_term*)syntax_node->item;
-        operand->priority = priority;
-        return syntax_node;
+    if(parser->curr_tok && parser->curr_tok->tag == PQ_OPEN_CT_TOK)
+    {   //represents the <term> ::= <atom> <open-ct> <arg-list> <close-par> production
+        //a parenthesis after layout is an operand instead (e.g. \+ (a, b) is \+(','(a, b)))
+        pq_parser_next_token(parser);
+
+        pq_parse_frame* frame = pq_parser_push_frame(parser, PQ_PARSE_ARGS, 0);
+        if(!frame) return PQ_TERM_NONE;
+        frame->op = atom_id;
+        pq_parser_push_frame(parser, PQ_PARSE_TERM, 999);
+        return PQ_TERM_NONE;
     }
-}
 
-pq_list* pq_parse_prolog_arg_list(pq_parser* parser)
-{   //represents one of the two productions:
-    //<arg-list> ::= <arg>
-    //<arg-list> ::= <arg> <comma> <arg-list>
+    if(pq_parser_at_term_delimiter(parser))
+    {   //represents the <term> ::= <atom> production, an operator followed by a delimiter is an operand (e.g. foo(-, +)).
+        return pq_new_atom_term(atom_id);
+    }
 
-    pq_term* arg = pq_parse_prolog_arg(parser);
-    if(parser->err) return NULL;
+    const pq_op_def* prefix = op_entry && op_entry->defs[PQ_OP_PREFIX].priority ? &op_entry->defs[PQ_OP_PREFIX] : NULL;
+    if(prefix)
+    {   //an infix or postfix operator that cannot start a term follows the prefix operator as an atom (e.g. - = x).
+        const pq_op_entry* next_entry = pq_op_table_lookup(parser->ops, pq_parser_get_atom(parser));
+        if(next_entry && !next_entry->defs[PQ_OP_PREFIX].priority
+            && (next_entry->defs[PQ_OP_INFIX].priority || next_entry->defs[PQ_OP_POSTFIX].priority))
+            prefix = NULL;
+    }
 
-    pq_list* arg_list = pq_new_list();
-    pq_list_push_back(arg_list, arg);
+    if(!prefix)
+    {   //represents the <term> ::= <atom> production, an operator as an atom has the priority of the operator.
+        *priority = pq_parser_get_atom_priority(op_entry);
+        return pq_new_atom_term(atom_id);
+    }
 
-    while(parser->curr_tok && parser->curr_tok->tag == PQ_COMMA_TOK)
-    {   
+    //check for negative numeric constant
+    if(atom_id == PQ_ATOM_MINUS && (parser->curr_tok->tag == PQ_INT_TOK || parser->curr_tok->tag == PQ_BIGINT_TOK
+        || parser->curr_tok->tag == PQ_FLT_TOK))
+    {
+        pq_term term;
+        if(parser->curr_tok->tag == PQ_INT_TOK) term = pq_new_integer_term(parser->arena, -parser->curr_tok->val.i);
+        else if(parser->curr_tok->tag == PQ_BIGINT_TOK) term = pq_new_bigint_term(parser->arena, pq_parser_get_lexeme(parser), PQ_TRUE);
+        else term = pq_new_float_term(parser->arena, -parser->curr_tok->val.f);
         pq_parser_next_token(parser);
-        
-        arg = pq_parse_prolog_arg(parser);
-        if(parser->err) return NULL;
-        pq_list_push_back(arg_list, arg);
+        return term;
     }
 
-    return arg_list;
-}
-
-pq_term* pq_parse_prolog_arg(pq_parser* parser)
-{
-    if(!parser->curr_tok)
+    //represents the <term> ::= <op> <term> production
+    const pq_priority op_priority = prefix->priority;
+    if(op_priority > max_priority)
     {
-        parser->err = "syntax error: expected an argument";
-        return NULL;
+        parser->err = "syntax error: operator priority clash";
+        return PQ_TERM_NONE;
     }
 
-    if(parser->curr_tok->tag == PQ_NAME_TOK && (parser->curr_tok->val.s))
-    {   //represents the <term> ::= <atom> production, where <atom> is an operator
-        PQstr atom_id = parser->curr_tok->val.s;
-        pq_parser_next_token(parser);
-        return pq_new_atom_term(atom_id, 1201);
-    }
-    else
+    pq_parse_frame* frame = pq_parser_push_frame(parser, PQ_PARSE_PREFIX, 0);
+    if(!frame) return PQ_TERM_NONE;
+    frame->op = atom_id;
+    frame->op_priority = op_priority;
+    pq_parser_push_frame(parser, PQ_PARSE_TERM, prefix->specifier == PQ_OP_FY ? op_priority : op_priority - 1);
+    return PQ_TERM_NONE;
+}
+
+pq_term pq_parse_prolog_reduce(pq_parser* parser, pq_term term, pq_priority* priority)
+{   //gives the finished term and its priority to the top frame.
+    //returns the top frame's term if it is finished too (the frame is popped and its priority is stored in priority),
+    //else PQ_TERM_NONE as the frame needs another term.
+
+    pq_parse_frame* frame = &parser->stack[parser->stack_sz - 1];
+    switch(frame->kind)
     {
-        pq_syntax_tree_node* term_node = pq_parse_prolog_term(parser, 999);
-        if(parser->err) return NULL;
+    case PQ_PARSE_TERM:
+    {   //precedence climbing, the left operand grows by one operator at a time while the operators fit the max priority.
+        //a yfx operator accepts a left operand of its own priority, so left-associative chains are built by this loop.
+        //xfy and xfx operators only accept lower priorities on the left, so they end the loop at the same priority.
+
+        if(frame->op != PQ_ATOM_NONE)
+        {   //the term is the right operand of the pending infix operator.
+            frame->left = pq_parser_make_op_term(parser, frame->op, frame->left, term);
+            frame->left_priority = frame->op_priority;
+            frame->op = PQ_ATOM_NONE;
+        }
+        else
+        {
+            frame->left = term;
+            frame->left_priority = *priority;
+        }
 
-        return (pq_term*)term_node->item;
+        while(parser->curr_tok)
+        {
+            //the atom is looked up once, its infix definition takes precedence over its postfix one.
+            const pq_atom op_name = pq_parser_get_atom(parser);
+            const pq_op_entry* op_entry = pq_op_table_lookup(parser->ops, op_name);
+            if(!op_entry) break;
+
+            const pq_op_def* infix = &op_entry->defs[PQ_OP_INFIX];
+            const pq_op_def* postfix = &op_entry->defs[PQ_OP_POSTFIX];
+            if(infix->priority && infix->priority <= frame->max_priority
+                && frame->left_priority <= (infix->specifier == PQ_OP_YFX ? infix->priority : infix->priority - 1))
+            {   //represents the <term> ::= <term> <op> <term> production
+                frame->op = op_name;
+                frame->op_priority = infix->priority;
+                const pq_priority right_priority = infix->specifier == PQ_OP_XFY ? infix->priority : infix->priority - 1;
+                pq_parser_next_token(parser);
+                if(parser->err) return PQ_TERM_NONE;
+
+                pq_parser_push_frame(parser, PQ_PARSE_TERM, right_priority);
+                return PQ_TERM_NONE;
+            }
+            else if(postfix->priority && postfix->priority <= frame->max_priority
+                && frame->left_priority <= (postfix->specifier == PQ_OP_YF ? postfix->priority : postfix->priority - 1))
+            {   //represents the <term> ::= <term> <op> production
+                frame->left = pq_parser_make_op_term(parser, op_name, frame->left, PQ_TERM_NONE);
+                frame->left_priority = postfix->priority;
+                pq_parser_next_token(parser);
+                if(parser->err) return PQ_TERM_NONE;
+            }
+            else break; //the operator belongs to an enclosing term.
+        }
+
+        parser->stack_sz--;
+        *priority = frame->left_priority;
+        return frame->left;
     }
-}
 
-pq_list* pq_parse_prolog_items(pq_parser* parser)
-{
-    pq_term* arg = pq_parse_prolog_arg(parser);
-    if(parser->err) return NULL;
+    case PQ_PARSE_PREFIX:
+        parser->stack_sz--;
+        *priority = frame->op_priority;
+        return pq_parser_make_op_term(parser, frame->op, PQ_TERM_NONE, term);
 
-    pq_list* items = pq_new_list();
-    pq_list_push_back(items, arg);
+    case PQ_PARSE_PAREN:
+        if(!parser->curr_tok || parser->curr_tok->tag != PQ_RPAR_TOK)
+        {
+            parser->err = "syntax error: expected a closing parenthesis";
+            return PQ_TERM_NONE;
+        }
+        pq_parser_next_token(parser);
+        parser->stack_sz--;
+        *priority = 0;
+        return term;
 
-    for(;;)
+    case PQ_PARSE_CURLY:
     {
-        if(parser->curr_tok) switch(parser->curr_tok->tag)
+        if(!parser->curr_tok || parser->curr_tok->tag != PQ_RCURLY_TOK)
         {
-        case PQ_COMMA_TOK:
-            pq_parser_next_token(parser);
-            arg = pq_parse_prolog_arg(parser);
-            if(parser->err) return NULL;
-            pq_list_push_back(items, arg);
-            break;
+            parser->err = "syntax error: expected a closing curly bracket";
+            return PQ_TERM_NONE;
+        }
+        pq_parser_next_token(parser);
+        parser->stack_sz--;
+        *priority = 0;
+        return pq_new_functor_term(parser->arena, PQ_ATOM_CURLY, 1, &term);
+    }
 
-        case PQ_HT_SEP_TOK:
+    case PQ_PARSE_ARGS:
+        //represents one of the two productions:
+        //<arg-list> ::= <arg>
+        //<arg-list> ::= <arg> <comma> <arg-list>
+        pq_parser_push_arg(parser, term);
+        if(parser->err) return PQ_TERM_NONE;
+        if(parser->curr_tok && parser->curr_tok->tag == PQ_COMMA_TOK)
+        {   //the next argument has a priority of 999 (below ',').
             pq_parser_next_token(parser);
-            arg = pq_parse_prolog_arg(parser);
-            if(parser->err) return NULL;
-            pq_list_push_back(items, arg);
-            return items;
-
-        default:
-            return items;
+            pq_parser_push_frame(parser, PQ_PARSE_TERM, 999);
+            return PQ_TERM_NONE;
+        }
+        if(!parser->curr_tok || parser->curr_tok->tag != PQ_RPAR_TOK)
+        {
+            parser->err = "syntax error: expected a closing parenthesis";
+            return PQ_TERM_NONE;
+        }
+        pq_parser_next_token(parser);
+        parser->stack_sz--;
+        *priority = 0;
+        return pq_parser_make_compound(parser, frame->op, frame->args_start);
+
+    case PQ_PARSE_ITEMS:
+    case PQ_PARSE_ITEMS_TAIL:
+        pq_parser_push_arg(parser, term);
+        if(parser->err) return PQ_TERM_NONE;
+        if(frame->kind == PQ_PARSE_ITEMS && parser->curr_tok)
+        {
+            if(parser->curr_tok->tag == PQ_COMMA_TOK || parser->curr_tok->tag == PQ_HT_SEP_TOK)
+            {   //the next item, or the tail of the list after the head-tail separator.
+                if(parser->curr_tok->tag == PQ_HT_SEP_TOK) frame->kind = PQ_PARSE_ITEMS_TAIL;
+                pq_parser_next_token(parser);
+                pq_parser_push_frame(parser, PQ_PARSE_TERM, 999);
+                return PQ_TERM_NONE;
+            }
         }
-        else break;
+        if(!parser->curr_tok || parser->curr_tok->tag != PQ_RLIST_TOK)
+        {
+            parser->err = "syntax error: expected the end of the list";
+            return PQ_TERM_NONE;
+        }
+        pq_parser_next_token(parser);
+        parser->stack_sz--;
+        *priority = 0;
+        return pq_parser_make_list(parser, frame->args_start, frame->kind == PQ_PARSE_ITEMS_TAIL);
     }
 
-    return items;
-}
\ No newline at end of file
+    parser->err = "syntax error: expected a term.";
+    return PQ_TERM_NONE;
+}
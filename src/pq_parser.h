@@ -4,8 +4,11 @@
  * @brief poqer-lang parser header.
  * the pq_parser struct is used to build a syntax tree of the poqer program.
  * create/destroy the parser with the pq_new_* and pq_del_* functions.
- * set the buffer with pq_parser_set_buffer function.
- * build the syntax tree with pq_parser_parse function.
+ * set the buffer with pq_parser_set_buffer function, or stream a file with pq_parser_set_file function.
+ * build the syntax tree with pq_parser_parse function, or with pq_parser_consult_file function for a source file.
+ * read one clause at a time with pq_parser_next_clause function.
+ * limit the nesting of the terms with pq_parser_set_max_depth function.
+ * the terms and syntax trees are allocated from the parser's arena, deallocate them with pq_parser_clear_terms function.
  * When added, auxiliary functions for more functionality will be documented below.
  * 
  * @version 0.001
@@ -17,8 +20,52 @@
 #define _PQ_PARSER_H
 #include "pq_globals.h"
 #include "pq_scanner.h"
+#include "pq_op_table.h"
+#include "pq_term.h"
+#include "pq_arena.h"
 #include "pq_syntax_tree.h"
 
+//the default number of unfinished terms that a term can be nested in.
+#define PQ_PARSER_MAX_DEPTH (1 << 22)
+
+/**
+ * @brief The kinds of unfinished terms on the parser's work stack.
+ */
+typedef enum pq_parse_frame_kind
+{
+    PQ_PARSE_TERM, //operator notation, waiting for its first operand or the right operand of an infix operator.
+    PQ_PARSE_PREFIX, //a prefix operator, waiting for its operand.
+    PQ_PARSE_PAREN, //a term in parentheses.
+    PQ_PARSE_CURLY, //a term in curly brackets.
+    PQ_PARSE_ARGS, //the arguments of a functor.
+    PQ_PARSE_ITEMS, //the items of a list.
+    PQ_PARSE_ITEMS_TAIL //the tail of a list, after the head-tail separator.
+} pq_parse_frame_kind;
+
+/**
+ * @brief An unfinished term on the parser's work stack.
+ */
+typedef struct pq_parse_frame
+{
+    pq_term left; //the left operand of operator notation, PQ_TERM_NONE until it is parsed.
+    size_t args_start; //the index in the parser's arg cells of the first parsed argument of a functor or item of a list.
+    pq_atom op; //the pending infix operator, the prefix operator, or the name of the functor, PQ_ATOM_NONE if there is none.
+    pq_priority max_priority; //the highest priority of operator notation.
+    pq_priority left_priority; //the priority of the left operand.
+    pq_priority op_priority; //the priority of the pending infix operator or the prefix operator.
+    uint8_t kind; //the pq_parse_frame_kind of the term.
+} pq_parse_frame;
+
+/**
+ * @brief A named variable of the clause that is being parsed.
+ */
+typedef struct pq_parse_var
+{
+    pq_lexeme name; //the name of the variable.
+    pq_term term; //the variable, every occurrence of the name in the clause is this variable.
+    uint32_t slot; //the slot of the variable in the parser's var_slots.
+} pq_parse_var;
+
 /**
  * @brief The structure of a poqer-lang parser.
  */
@@ -27,8 +74,33 @@ typedef struct pq_parser
 
     //the poqer scanner
     pq_scanner* scanner;
-    pq_tok* curr_tok;
+    pq_tok* curr_tok; //the current token, it points to tok or NULL if there are no more tokens.
+    pq_tok tok; //the storage of the current token, reused for every token.
+    int8_t needs_token; //whether the current token was consumed, the next one is read by the next clause.
+    pq_op_table* ops; //the operators, modified by op/3 directives.
+    int8_t ops_owned; //whether the operators are deallocated by the parser.
+    pq_arena* arena; //the terms, lists, syntax trees, and variable names built by the parser.
+
+    //the work stack of the unfinished terms, terms are parsed without recursion so their nesting is not limited by the c stack.
+    pq_parse_frame* stack;
+    size_t stack_sz; //the number of unfinished terms.
+    size_t stack_cap; //the number of frames allocated to the stack.
+    size_t max_depth; //the highest stack_sz allowed, deeper terms are a syntax error.
+
+    //the parsed arguments and list items of the unfinished terms, each frame owns the cells from its args_start.
+    //they are copied into the compound or list in one allocation when the frame is finished.
+    pq_term* args;
+    size_t args_sz; //the number of parsed arguments.
+    size_t args_cap; //the number of cells allocated to args.
+
+    //the named variables of the last clause, in the order of their first occurrence.
+    pq_parse_var* vars;
+    uint32_t vars_sz; //the number of named variables.
+    uint32_t vars_cap; //the number of variables allocated to vars.
+    uint32_t* var_slots; //open addressing hash set of indices into vars, an empty slot is UINT32_MAX.
+    uint32_t var_slot_mask; //the number of slots minus 1, the number of slots is a power of 2.
     char* err;
+    int8_t err_owned; //whether the error was allocated by the scanner, the parser's own errors are literals.
 } pq_parser;
 
 /**
@@ -47,11 +119,54 @@ static inline pq_parser* pq_new_parser()
         free(parser);
         return NULL;
     }
+    parser->ops = pq_new_op_table();
+    if(!parser->ops)
+    {
+        pq_del_scanner(parser->scanner);
+        free(parser);
+        return NULL;
+    }
+    parser->ops_owned = 1;
+    parser->arena = pq_new_arena(0);
+    if(!parser->arena)
+    {
+        pq_del_op_table(parser->ops);
+        pq_del_scanner(parser->scanner);
+        free(parser);
+        return NULL;
+    }
+    parser->stack = NULL;
+    parser->stack_sz = 0;
+    parser->stack_cap = 0;
+    parser->max_depth = PQ_PARSER_MAX_DEPTH;
+    parser->args = NULL;
+    parser->args_sz = 0;
+    parser->args_cap = 0;
+    parser->vars = NULL;
+    parser->vars_sz = 0;
+    parser->vars_cap = 0;
+    parser->var_slots = NULL;
+    parser->var_slot_mask = 0;
     parser->curr_tok = NULL;
+    parser->needs_token = 1;
+    pq_set_int_token(&parser->tok, PQ_INT_TOK, 0, 0);
     parser->err = NULL;
+    parser->err_owned = 0;
     return parser;
 }
 
+/**
+ * @brief Clears the error of the parser, the error is deallocated if it was allocated by the scanner.
+ * 
+ * @param parser The parser that will be modified.
+ */
+static inline void pq_parser_clear_error(pq_parser* parser)
+{
+    if(parser->err_owned) free(parser->err);
+    parser->err = NULL;
+    parser->err_owned = 0;
+}
+
 /**
  * @brief Safe deallocation of a pq_parser struct.
  * 
@@ -61,10 +176,83 @@ static inline void pq_del_parser(pq_parser* parser)
 {
     if(!parser) return;
 
+    pq_clear_token(&parser->tok);
+    pq_parser_clear_error(parser);
     if(parser->scanner) pq_del_scanner(parser->scanner);
+    if(parser->ops && parser->ops_owned) pq_del_op_table(parser->ops);
+    if(parser->arena) pq_del_arena(parser->arena);
+    free(parser->stack);
+    free(parser->args);
+    free(parser->vars);
+    free(parser->var_slots);
     free(parser);
 }
 
+/**
+ * @brief Resets the parser to the start of a new input, the error is cleared.
+ * 
+ * @param parser The parser that will be modified.
+ */
+static inline void pq_parser_restart(pq_parser* parser)
+{
+    pq_clear_token(&parser->tok);
+    parser->curr_tok = NULL;
+    parser->needs_token = 1;
+    pq_parser_clear_error(parser);
+}
+
+/**
+ * @brief Replaces the operators of the parser with a table that is not owned by the parser (e.g. shared by the parsers of a machine).
+ * The previous table is deallocated if it is owned, the new table is never deallocated by the parser so it must outlive its use.
+ * 
+ * @param parser The parser that will be modified.
+ * @param ops The operators.
+ */
+static inline void pq_parser_share_ops(pq_parser* parser, pq_op_table* ops)
+{
+    if(parser->ops && parser->ops_owned) pq_del_op_table(parser->ops);
+    parser->ops = ops;
+    parser->ops_owned = 0;
+}
+
+/**
+ * @brief Forgets the named variables of the previous clause.
+ * Only the used slots are emptied, so a clause with few variables stays cheap after a clause with many.
+ * 
+ * @param parser The parser that will be modified.
+ */
+static inline void pq_parser_clear_vars(pq_parser* parser)
+{
+    for(uint32_t i = 0; i < parser->vars_sz; i++)
+        parser->var_slots[parser->vars[i].slot] = UINT32_MAX;
+    parser->vars_sz = 0;
+}
+
+/**
+ * @brief Deallocates every term and syntax tree built by the parser in constant time.
+ * The memory is kept and reused by the following terms, e.g. call it once per clause that was consumed or per REPL line.
+ * 
+ * @param parser The parser that will be modified.
+ */
+static inline void pq_parser_clear_terms(pq_parser* parser)
+{
+    pq_parser_clear_vars(parser);
+    pq_arena_reset(parser->arena);
+}
+
+/**
+ * @brief Sets the limit on the nesting of the terms.
+ * Every unfinished operand, functor, list, and bracket counts as a level, including the right operands of xfy chains (a, b, c).
+ * Terms nested deeper than the limit are a syntax error instead of exhausting the memory, each level takes sizeof(pq_parse_frame) bytes.
+ * 
+ * @param parser The parser that will be modified.
+ * @param max_depth The highest depth of a term, PQ_PARSER_MAX_DEPTH by default.
+ */
+static inline void pq_parser_set_max_depth(pq_parser* parser, const size_t max_depth)
+{
+    parser->max_depth = max_depth;
+}
+
 /**
  * @brief Sets the buffer of the parser.
  * The previous buffer is deallocated from the parser.
@@ -74,9 +262,87 @@ static inline void pq_del_parser(pq_parser* parser)
  */
 static inline void pq_parser_set_buffer(pq_parser* parser, const char* buffer)
 {
+    pq_parser_restart(parser);
     pq_scanner_set_buffer(parser->scanner, buffer);
 }
 
+/**
+ * @brief Streams the input of the parser from a file, it is read in chunks instead of all at once.
+ * The previous buffer is deallocated from the parser.
+ * 
+ * @param parser The parser that will be modified.
+ * @param file The file opened for reading, it is not closed by the parser.
+ */
+static inline void pq_parser_set_file(pq_parser* parser, FILE* file)
+{
+    pq_parser_restart(parser);
+    pq_scanner_set_file(parser->scanner, file);
+}
+
+/**
+ * @brief Streams the input of the parser through a read function.
+ * The previous buffer is deallocated from the parser.
+ * 
+ * @param parser The parser that will be modified.
+ * @param read The function that reads the next chunk of the input.
+ * @param source The input that is passed to read.
+ * @param chunk_sz The number of bytes requested from each read.
+ */
+static inline void pq_parser_set_source(pq_parser* parser, pq_scanner_read_fn read, void* source, const size_t chunk_sz)
+{
+    pq_parser_restart(parser);
+    pq_scanner_set_source(parser->scanner, read, source, chunk_sz);
+}
+
+/**
+ * @brief Parses the next clause or directive of the input.
+ * The clauses are read one at a time, so the input can be consumed while it is being streamed.
+ * A directive (e.g. op/3) takes effect before the next call, and its term is returned like any clause.
+ * Upon failure, PQ_TERM_NONE is returned and the error is stored in the parser.
+ * 
+ * @param parser The parser that will be used.
+ * @return The term of the clause, it is valid until pq_parser_clear_terms is called.
+ * PQ_TERM_NONE if there are no more clauses or an error occurred.
+ */
+pq_term pq_parser_next_clause(pq_parser* parser);
+
+/**
+ * @brief Skips the rest of a clause that has a syntax error, so the following clauses can still be read.
+ * The tokens are skipped up to and including the next end token, a character that starts no token is skipped by itself.
+ * The error is cleared, read its position from the scanner (tok_ln and tok_col) before calling this.
+ * 
+ * @param parser The parser that will be modified.
+ */
+void pq_parser_skip_clause(pq_parser* parser);
+
+/**
+ * @brief Gets the name of a variable of the last clause returned by pq_parser_next_clause.
+ * 
+ * @param parser The parser that will be used.
+ * @param var The variable term.
+ * @return The name of the variable, an empty lexeme for an anonymous variable.
+ */
+pq_lexeme pq_parser_get_var_name(const pq_parser* parser, const pq_term var);
+
+/**
+ * @brief Builds the syntax tree of the whole input, the item of each child is a pointer to the term of a clause.
+ * Upon failure, the error is stored in the parser and the tree holds the clauses read before it.
+ * The tree is valid until pq_parser_clear_terms is called.
+ * 
+ * @param parser The parser that will be used.
+ * @return The syntax tree of the input.
+ */
 pq_syntax_tree* pq_parser_parse(pq_parser* parser);
 
+/**
+ * @brief Builds the syntax tree of a source file.
+ * The file is memory mapped read-only and parsed directly from the mapping, then it is unmapped.
+ * Upon failure, the error is stored in the parser.
+ * 
+ * @param parser The parser that will be used.
+ * @param path The utf8 null-terminated c-string path of the source file.
+ * @return The syntax tree of the file, NULL if the file could not be read.
+ */
+pq_syntax_tree* pq_parser_consult_file(pq_parser* parser, const char* path);
+
 #endif
\ No newline at end of file
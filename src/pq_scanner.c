@@ -4,12 +4,13 @@
  * @brief poqer-lang scanner implementation.
  * the internal implementation of the pq_scanner_* functions are documented below.
  * 
- * @version 0.006
+ * @version 0.007
  * @date 10-15-2020
  * @copyright Brandon Foster (c) 2020-2021
  */
 
 #include "pq_scanner.h"
+#include "pq_float.h"
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -50,12 +51,16 @@ typedef enum pq_scanner_state {
     PQ_SCANNER_STATE_POT_FLOAT_EXP,
     PQ_SCANNER_STATE_POT_FLOAT_EXP_INT,
     PQ_SCANNER_STATE_FLOAT_EXP_INT,
+    PQ_SCANNER_STATE_POT_FLOAT_INF_N,
+    PQ_SCANNER_STATE_POT_FLOAT_INF_F,
+    PQ_SCANNER_STATE_POT_FLOAT_NAN_A,
+    PQ_SCANNER_STATE_POT_FLOAT_NAN_N,
 
     PQ_SCANNER_STATE_VAR
 } pq_scanner_state;
 
 /**
- * @brief Creates and stores a scanner error with the line and column of the scanner.
+ * @brief Creates and stores a scanner error, its position is the start of the token in tok_ln and tok_col.
  * 
  * @param scanner The scanner that will be used.
  * @param err The error will be stored here.
@@ -63,27 +68,11 @@ typedef enum pq_scanner_state {
  */
 static inline void pq_scanner_make_error_from_cstr(pq_scanner* scanner, char** err, const char* str)
 {
-    //number of line and column digits to store.
-    char ln_digits[21];
-    char col_digits[21];
-
-    //stores the digits.
-#ifdef PQ_OS_LINUX
-    sprintf(ln_digits, "%lu", scanner->ln);
-    sprintf(col_digits, "%lu", scanner->col);
-#elif PQ_OS_WINDOWS
-    sprintf(ln_digits, "%llu", scanner->ln);
-    sprintf(col_digits, "%llu", scanner->col);
-#endif
-
     //allocates and uses string struct to build the error string.
     pq_string* err_string = (pq_string*)pq_new_string();
-    pq_string_append_str(err_string, "[ln ");
-    pq_string_append_str(err_string, ln_digits);
-    pq_string_append_str(err_string, " col ");
-    pq_string_append_str(err_string, col_digits);
-    pq_string_append_str(err_string, "] error, ");
+    pq_string_append_str(err_string, "syntax error: ");
     pq_string_append_str(err_string, str);
+    pq_string_append_str(err_string, ".");
 
     //stores the error string into the err reference then deallocates the string struct.
     *err = (char*)malloc(pq_string_get_size(err_string) + 1);
@@ -91,6 +80,75 @@ static inline void pq_scanner_make_error_from_cstr(pq_scanner* scanner, char** e
     pq_del_string(err_string);
 }
 
+/**
+ * @brief Reads chunks of a streamed input until a whole utf8 character is available at the ending point of the lexeme.
+ * The bytes before the beginning of the lexeme are discarded first, so the lexeme is moved to the start of the buffer.
+ * The buffer only grows when the lexeme leaves less than a chunk of free space.
+ * 
+ * @param scanner The scanner that will be modified.
+ */
+static void pq_scanner_refill(pq_scanner* scanner)
+{
+    char* buffer = (char*)scanner->buffer;
+    while(!scanner->source_eof && scanner->end + PQ_UTF8_LEN_MAX - 1 > scanner->buffer_sz)
+    {
+        if(scanner->beg > 0)
+        {   //discards the bytes that were already scanned, the offsets are shifted with them.
+            const size_t discard = scanner->beg;
+            memmove(buffer, buffer + discard, scanner->buffer_sz - discard);
+            scanner->buffer_sz -= discard;
+            scanner->buffer_pos += discard;
+            scanner->beg = 0;
+            scanner->end -= discard;
+            scanner->quoted_atom_verbatim_end = scanner->quoted_atom_verbatim_end > discard ? scanner->quoted_atom_verbatim_end - discard : 0;
+        }
+
+        if(scanner->buffer_cap - scanner->buffer_sz < scanner->chunk_sz)
+        {   //the lexeme is too long for the next chunk, grows the buffer.
+            char* buffer_n = realloc(buffer, scanner->buffer_sz + scanner->chunk_sz + 1); //+1 for the null character.
+            if(!buffer_n)
+            {   //no more space, ends the input early.
+                scanner->source_eof = 1;
+                break;
+            }
+            scanner->buffer = buffer = buffer_n;
+            scanner->buffer_cap = scanner->buffer_sz + scanner->chunk_sz;
+        }
+
+        size_t read_sz = scanner->read(scanner->source, buffer + scanner->buffer_sz, scanner->chunk_sz);
+        if(read_sz == 0) scanner->source_eof = 1;
+        scanner->buffer_sz += read_sz;
+        buffer[scanner->buffer_sz] = '\0';
+    }
+}
+
+/**
+ * @brief Makes sure that the utf8 character at the ending point of the lexeme is in the buffer.
+ * This does nothing unless the scanner streams its input and the ending point is near the end of the buffer.
+ * 
+ * @param scanner The scanner that will be modified.
+ */
+static inline void pq_scanner_fill(pq_scanner* scanner)
+{
+    if(!scanner->source_eof && scanner->end + PQ_UTF8_LEN_MAX - 1 > scanner->buffer_sz)
+        pq_scanner_refill(scanner);
+}
+
+/**
+ * @brief Moves the line and column past the current character, a newline starts the next line at column 1.
+ * 
+ * @param scanner The scanner that will be modified.
+ */
+static inline void pq_scanner_count_char(pq_scanner* scanner)
+{
+    if(scanner->cp == '\n')
+    {
+        scanner->ln++;
+        scanner->col = 1;
+    }
+    else scanner->col++;
+}
+
 /**
  * @brief Moves the beginning of the lexeme after its current ending point.
  * If this cannot be done (the ending point is at the end of the buffer)
@@ -102,8 +160,9 @@ static inline void pq_scanner_next_lexeme(pq_scanner* scanner)
 {
     if(scanner->end < scanner->buffer_sz)
     {   //moves the beginning of the lexeme after its ending point if possible.
+        pq_scanner_count_char(scanner);
         scanner->beg = (scanner->end += scanner->cp_bytes);
-        scanner->col++;
+        pq_scanner_fill(scanner);
         scanner->cp_bytes = pq_utf8_to_cp(&scanner->cp, scanner->buffer + scanner->end);
     }
     else if(scanner->beg != scanner->end)
@@ -125,7 +184,7 @@ static inline void pq_scanner_skip(pq_scanner* scanner, size_t i)
     {
         uint32_t cp;
         int8_t cp_bytes;
-        for(int j = 0; j < i && scanner->beg <= scanner->buffer_sz - 1; ++j)
+        for(int j = 0; j < i && scanner->beg < scanner->buffer_sz; ++j)
             scanner->beg += (cp_bytes = pq_utf8_to_cp(&cp, scanner->buffer + scanner->beg));
     }
 }
@@ -144,9 +203,15 @@ static inline void pq_scanner_rewind(pq_scanner* scanner, size_t i)
     {
         for(int j = i - 1; j >= 0 && scanner->end > 0; --j)
         {
-            if(scanner->cp == '\n') scanner->ln--;
             while(!pq_is_utf8_1st_byte(*(scanner->buffer + --scanner->end)));
-            scanner->col--;
+            if(scanner->buffer[scanner->end] == '\n')
+            {   //back to the end of the previous line, its column is counted from the start of the line.
+                scanner->ln--;
+                scanner->col = 1;
+                for(size_t k = scanner->end; k > 0 && scanner->buffer[k - 1] != '\n'; --k)
+                    if(pq_is_utf8_1st_byte(scanner->buffer[k - 1])) scanner->col++;
+            }
+            else scanner->col--;
         }
         scanner->cp_bytes = pq_utf8_to_cp(&scanner->cp, scanner->buffer + scanner->end);
     }
@@ -163,30 +228,86 @@ static inline void pq_scanner_forward(pq_scanner* scanner, size_t i)
 {
     if(i > 0)
     {
-        for(int j = 0; j < i && scanner->end <= scanner->buffer_sz - 1; ++j)
+        for(int j = 0; j < i && scanner->end < scanner->buffer_sz; ++j)
         {
-            if(scanner->cp == '\n') scanner->ln++;
+            pq_scanner_count_char(scanner);
             scanner->end += scanner->cp_bytes;
+            pq_scanner_fill(scanner);
             scanner->cp_bytes = pq_utf8_to_cp(&scanner->cp, scanner->buffer + scanner->end);
-            scanner->col++;
         }
     }
 }
 
 /**
- * @brief Creates and returns a utf8 null-terminated c-string containing the current lexeme.
- * Please deallocate the c-string after use.
+ * @brief Gets the number of bytes in the current lexeme.
  * 
  * @param scanner The scanner that will be used.
- * @return The created utf8 null-terminated c-string containing the current lexeme.
+ * @return The number of bytes from the lexeme's beginning up to and including its ending character.
  */
-static inline char* pq_scanner_get_lexeme(const pq_scanner* scanner)
+static inline size_t pq_scanner_get_lexeme_size(const pq_scanner* scanner)
 {
-    size_t lexeme_sz = scanner->end - scanner->beg + scanner->cp_bytes;
-    char* lexeme = malloc(lexeme_sz + 1); //+1 for the null character.
-    strncpy(lexeme, scanner->buffer + scanner->beg, lexeme_sz);
-    lexeme[lexeme_sz] = '\0';
-    return lexeme;
+    return scanner->end - scanner->beg + scanner->cp_bytes;
+}
+
+/**
+ * @brief Converts the digits of the current lexeme into an integer without copying the lexeme.
+ * 
+ * @param scanner The scanner that will be used.
+ * @param prefix_sz The number of prefix characters to ignore (e.g. 2 for 0x).
+ * @param base The base of the digits (2, 8, 10, or 16).
+ * @param val Receives the integer value of the lexeme.
+ * @return PQ_TRUE if the integer fits in a PQint else PQ_FALSE.
+ */
+static inline PQbool pq_scanner_get_lexeme_int(const pq_scanner* scanner, const size_t prefix_sz, const int base, PQint* val)
+{
+    const char* digit = scanner->buffer + scanner->beg + prefix_sz;
+    const char* digit_end = scanner->buffer + scanner->beg + pq_scanner_get_lexeme_size(scanner);
+    uint64_t acc = 0;
+    for(; digit < digit_end; ++digit)
+    {   //the digits were already validated by the scanner states.
+        uint64_t digit_val;
+        if(*digit <= '9') digit_val = *digit - '0';
+        else if(*digit <= 'F') digit_val = *digit - 'A' + 10;
+        else digit_val = *digit - 'a' + 10;
+
+        if(acc > (INT64_MAX - digit_val) / base) return PQ_FALSE;
+        acc = acc * base + digit_val;
+    }
+    *val = (PQint)acc;
+    return PQ_TRUE;
+}
+
+/**
+ * @brief Generates the integer token of the current lexeme, then starts the next lexeme.
+ * An integer that does not fit in a PQint is a bignum token, its lexeme is converted by the parser (see pq_new_bigint_term).
+ * 
+ * @param scanner The scanner that will be used.
+ * @param tok The token that will be initialized.
+ * @param prefix_sz The number of prefix characters to ignore (e.g. 2 for 0x).
+ * @param base The base of the digits (2, 8, 10, or 16).
+ * @return The tok pointer.
+ */
+static inline pq_tok* pq_scanner_make_int_token(pq_scanner* scanner, pq_tok* tok, const size_t prefix_sz, const int base)
+{
+    PQint val;
+    const size_t lexeme_beg = scanner->beg;
+    const size_t lexeme_sz = pq_scanner_get_lexeme_size(scanner);
+    const PQbool fits = pq_scanner_get_lexeme_int(scanner, prefix_sz, base, &val);
+    pq_scanner_next_lexeme(scanner);
+    if(!fits) return pq_set_slice_token(tok, PQ_BIGINT_TOK, lexeme_beg, lexeme_sz, 0);
+    return pq_set_int_token(tok, PQ_INT_TOK, val, 0);
+}
+
+/**
+ * @brief Converts the current lexeme into a floating-point number without copying the lexeme.
+ * the floating-point states validated the lexeme, so its characters are converted directly (see pq_float.h).
+ * 
+ * @param scanner The scanner that will be used.
+ * @return The floating-point value of the lexeme.
+ */
+static inline PQflt pq_scanner_get_lexeme_flt(const pq_scanner* scanner)
+{
+    return pq_float_from_decimal(scanner->buffer + scanner->beg, pq_scanner_get_lexeme_size(scanner));
 }
 
 /**
@@ -197,15 +318,29 @@ static inline char* pq_scanner_get_lexeme(const pq_scanner* scanner)
  */
 static inline void pq_scanner_quoted_atom_set_quote(pq_scanner* scanner, const uint32_t cp)
 {
-    char utf8ch[PQ_UTF8_LEN_MAX];
-    pq_cp_to_utf8(utf8ch, cp);
     pq_string_clear(scanner->quoted_atom_escape);
     pq_string_clear(scanner->quoted_atom_name);
-    pq_string_append_str(scanner->quoted_atom_name, utf8ch);
+    scanner->quoted_atom_quote = cp;
+    scanner->quoted_atom_materialized = 0;
+    scanner->quoted_atom_verbatim_end = scanner->end + scanner->cp_bytes;
     scanner->quoted_atom_append_mode = 0;
     return;
 }
 
+/**
+ * @brief Copies the verbatim characters read so far into the quoted atom name.
+ * This is only done once, the first time that the name differs from the lexeme in the buffer.
+ * 
+ * @param scanner The scanner that will be used.
+ */
+static inline void pq_scanner_quoted_atom_materialize(pq_scanner* scanner)
+{
+    if(scanner->quoted_atom_materialized) return;
+    for(size_t i = scanner->beg; i < scanner->quoted_atom_verbatim_end; ++i)
+        pq_string_append_char(scanner->quoted_atom_name, scanner->buffer[i]);
+    scanner->quoted_atom_materialized = 1;
+}
+
 /**
  * @brief Appends a unicode character to the quoted atom name or the escaped sequence depending on the append mode.
  * 
@@ -219,6 +354,7 @@ static inline void pq_scanner_quoted_atom_append(pq_scanner* scanner, const uint
     switch(scanner->quoted_atom_append_mode)
     {
     case 0:
+        pq_scanner_quoted_atom_materialize(scanner);
         pq_string_append_str(scanner->quoted_atom_name, utf8ch);
         break;
     case 1:
@@ -234,6 +370,18 @@ static inline void pq_scanner_quoted_atom_append(pq_scanner* scanner, const uint
     return;
 }
 
+/**
+ * @brief Appends the current character as it appears in the buffer to the quoted atom name.
+ * Nothing is copied while the name is not materialized, the verbatim characters are referenced in the buffer instead.
+ * 
+ * @param scanner The scanner that will be used.
+ */
+static inline void pq_scanner_quoted_atom_append_verbatim(pq_scanner* scanner)
+{
+    if(scanner->quoted_atom_materialized) pq_scanner_quoted_atom_append(scanner, scanner->cp);
+    else scanner->quoted_atom_verbatim_end = scanner->end + scanner->cp_bytes;
+}
+
 /**
  * @brief Appends the escaped sequence if the append mode is currently oct or hex then resets the mode.
  * 
@@ -280,19 +428,106 @@ static inline int8_t pq_scanner_quoted_atom_append_escape(pq_scanner* scanner)
 }
 
 /**
- * @brief Creates and returns a utf8 null-terminated c-string containing the current lexeme.
- * Please deallocate the c-string after use.
+ * @brief Gets the name of the quoted atom that was read.
+ * Single quotes are not part of the name, so 'abc' is the same atom as abc.
+ * Double and back quotes are kept, so those names stay distinct from the atoms.
  * 
  * @param scanner The scanner that will be used.
- * @return The created utf8 null-terminated c-string containing the current lexeme.
+ * @return The name of the quoted atom, it references either the buffer or the materialized name.
  */
-static inline char* pq_scanner_quoted_atom_get_lexeme(const pq_scanner* scanner)
+static inline pq_lexeme pq_scanner_quoted_atom_get_name(const pq_scanner* scanner)
 {
-    char* lexeme = malloc(pq_string_get_size(scanner->quoted_atom_name) + 1);
-    return strcpy(lexeme, pq_string_get_cstr(scanner->quoted_atom_name));
+    pq_lexeme name;
+    if(scanner->quoted_atom_materialized)
+        name = pq_make_lexeme(pq_string_get_cstr(scanner->quoted_atom_name), pq_string_get_size(scanner->quoted_atom_name));
+    else
+        name = pq_make_lexeme(scanner->buffer + scanner->beg, pq_scanner_get_lexeme_size(scanner));
+
+    if(scanner->quoted_atom_quote == '\'')
+    {   //removes the open and closing quotes.
+        name.str++;
+        name.len -= 2;
+    }
+    return name;
+}
+
+/**
+ * @brief Creates a name token from the current lexeme, its name is interned in the atom table.
+ * 
+ * @param scanner The scanner that will be used.
+ * @param tok The token that will be initialized.
+ * @param name The name of the atom.
+ * @return The tok pointer.
+ */
+static inline pq_tok* pq_scanner_make_name_token(pq_scanner* scanner, pq_tok* tok, const pq_lexeme name)
+{
+    pq_set_atom_token(tok, PQ_NAME_TOK, pq_atom_intern(name), 0);
+    pq_scanner_next_lexeme(scanner);
+    return tok;
+}
+
+/**
+ * @brief Reads the next chunk of a file for a streaming scanner.
+ * 
+ * @param source The FILE* that is being streamed.
+ * @param dest The bytes are stored here.
+ * @param size The maximum number of bytes to read.
+ * @return The number of bytes read, 0 upon the end of the file or a read error.
+ */
+static size_t pq_scanner_read_file(void* source, char* dest, const size_t size)
+{
+    return fread(dest, 1, size, (FILE*)source);
+}
+
+void pq_scanner_set_source(pq_scanner* scanner, pq_scanner_read_fn read, void* source, const size_t chunk_sz)
+{
+    if(scanner->buffer && scanner->buffer_owned) free((void*)scanner->buffer);
+    scanner->chunk_sz = chunk_sz > 0 ? chunk_sz : PQ_SCANNER_CHUNK_SIZE;
+    scanner->buffer_cap = scanner->chunk_sz << 1; //room for a chunk after a partially read lexeme.
+    char* buffer = malloc(scanner->buffer_cap + 1); //+1 for the null character.
+    if(buffer) buffer[0] = '\0';
+    else scanner->buffer_cap = 0;
+    scanner->buffer = buffer;
+    scanner->buffer_sz = 0;
+    scanner->buffer_owned = 1;
+    scanner->buffer_pos = 0;
+    scanner->read = read;
+    scanner->source = source;
+    scanner->source_eof = buffer == NULL;
+    scanner->beg = scanner->end = 0;
+    scanner->ln = scanner->col = 1;
+
+    //reads the first chunk for the first utf8 character.
+    pq_scanner_fill(scanner);
+    scanner->cp = '\0';
+    scanner->cp_bytes = buffer ? pq_utf8_to_cp(&scanner->cp, scanner->buffer) : 0;
+}
+
+void pq_scanner_set_file(pq_scanner* scanner, FILE* file)
+{
+    pq_scanner_set_source(scanner, pq_scanner_read_file, file, PQ_SCANNER_CHUNK_SIZE);
 }
 
 pq_tok* pq_scanner_next_token(pq_scanner* scanner, char** err)
+{
+    pq_tok tok;
+    if(!pq_scanner_scan_token(scanner, &tok, err)) return NULL;
+
+    if(tok._is_slice)
+    {   //copies the variable out of the buffer, so the token outlives the buffer.
+        char* lexeme = malloc(tok.val.slice.len + 1); //+1 for the null character.
+        memcpy(lexeme, scanner->buffer + tok.val.slice.off, tok.val.slice.len);
+        lexeme[tok.val.slice.len] = '\0';
+        pq_set_str_token(&tok, tok.tag, lexeme, tok.pri);
+    }
+
+    pq_tok* heap_tok = malloc(sizeof(pq_tok));
+    if(heap_tok) *heap_tok = tok;
+    else pq_clear_token(&tok);
+    return heap_tok;
+}
+
+pq_tok* pq_scanner_scan_token(pq_scanner* scanner, pq_tok* tok, char** err)
 {
     *err = NULL;
 
@@ -301,6 +536,7 @@ pq_tok* pq_scanner_next_token(pq_scanner* scanner, char** err)
     size_t col = scanner->col;
     size_t beg = scanner->beg;
     size_t end = scanner->end;
+    size_t pos = scanner->buffer_pos;
 
     //starts reading one utf8 character at a time via their codepoint.
     pq_scanner_state state = PQ_SCANNER_STATE_BEGIN;
@@ -309,7 +545,9 @@ pq_tok* pq_scanner_next_token(pq_scanner* scanner, char** err)
         switch(state)
         {
         case PQ_SCANNER_STATE_BEGIN:
-            //checks for the beginning of a token.
+            //checks for the beginning of a token, the last character seen in this state is the first one of the token.
+            scanner->tok_ln = scanner->ln;
+            scanner->tok_col = scanner->col;
             switch(scanner->cp)
             {
             //halts the lexer.
@@ -329,45 +567,48 @@ pq_tok* pq_scanner_next_token(pq_scanner* scanner, char** err)
 
             //generates some special tokens.
             case '(':
+            {   //no layout or comment was skipped if the scanner is still where the previous token ended.
+                const PQbool open_ct = scanner->buffer_pos + scanner->end == pos + end;
                 pq_scanner_next_lexeme(scanner);
-                return pq_new_str_literal_token(PQ_LPAR_TOK, "(", 0);
+                return pq_set_str_literal_token(tok, open_ct ? PQ_OPEN_CT_TOK : PQ_LPAR_TOK, "(", 0);
+            }
 
             case ')':
                 pq_scanner_next_lexeme(scanner);
-                return pq_new_str_literal_token(PQ_RPAR_TOK, ")", 0);
+                return pq_set_str_literal_token(tok, PQ_RPAR_TOK, ")", 0);
 
             case '[':
                 pq_scanner_next_lexeme(scanner);
-                return pq_new_str_literal_token(PQ_LLIST_TOK, "[", 0);
+                return pq_set_str_literal_token(tok, PQ_LLIST_TOK, "[", 0);
 
             case ']':
                 pq_scanner_next_lexeme(scanner);
-                return pq_new_str_literal_token(PQ_RLIST_TOK, "]", 0);
+                return pq_set_str_literal_token(tok, PQ_RLIST_TOK, "]", 0);
 
             case '{':
                 pq_scanner_next_lexeme(scanner);
-                return pq_new_str_literal_token(PQ_LCURLY_TOK, "{", 0);
+                return pq_set_str_literal_token(tok, PQ_LCURLY_TOK, "{", 0);
 
             case '}':
                 pq_scanner_next_lexeme(scanner);
-                return pq_new_str_literal_token(PQ_RCURLY_TOK, "}", 0);
+                return pq_set_str_literal_token(tok, PQ_RCURLY_TOK, "}", 0);
 
             case '|':
                 pq_scanner_next_lexeme(scanner);
-                return pq_new_str_literal_token(PQ_HT_SEP_TOK, "|", 0);
+                return pq_set_atom_token(tok, PQ_HT_SEP_TOK, PQ_ATOM_BAR, 0);
             
             case ',':
                 pq_scanner_next_lexeme(scanner);
-                return pq_new_str_literal_token(PQ_COMMA_TOK, ",", 0);
+                return pq_set_atom_token(tok, PQ_COMMA_TOK, PQ_ATOM_COMMA, 0);
 
             //generates some single-token atoms.
             case ';':
                 pq_scanner_next_lexeme(scanner);
-                return pq_new_str_literal_token(PQ_NAME_TOK, ";", 0);
+                return pq_set_atom_token(tok, PQ_NAME_TOK, PQ_ATOM_SEMICOLON, 0);
 
             case '!':
                 pq_scanner_next_lexeme(scanner);
-                return pq_new_str_literal_token(PQ_NAME_TOK, "!", 0);
+                return pq_set_atom_token(tok, PQ_NAME_TOK, PQ_ATOM_CUT, 0);
 
             //the start of a single quoted atom.
             case '\'':
@@ -388,24 +629,26 @@ pq_tok* pq_scanner_next_token(pq_scanner* scanner, char** err)
                 break;
 
             default:
-                if(pq_is_unicode_layout_char(scanner->cp))
+            {   //classifies the character once, then checks its classes.
+                const uint16_t char_class = pq_unicode_get_char_class(scanner->cp);
+                if(char_class & PQ_UNICODE_LAYOUT_CLASS)
                 {   //skips layout characters (white spaces).
                     pq_scanner_skip(scanner, 1);
                 }
-                else if(pq_is_unicode_lower_char(scanner->cp))
+                else if(char_class & PQ_UNICODE_LOWER_CLASS)
                 {   //the start of an alphanumeric atom.
                     state = PQ_SCANNER_STATE_A_NAME;
                 }
-                else if(pq_is_unicode_dec_char(scanner->cp))
+                else if(char_class & PQ_UNICODE_DEC_CLASS)
                 {   //the start of a decimal or a floating-point number.
                     //only for the numbers 1 to 9. 0 is handled above.
                     state = PQ_SCANNER_STATE_POT_DEC_INT;
                 }
-                else if(pq_is_unicode_graphic_token_char(scanner->cp))
+                else if(char_class & PQ_UNICODE_GRAPHIC_TOKEN_CLASS)
                 {   //the start of a graphic atom.
                     state = PQ_SCANNER_STATE_G_NAME;
                 }
-                else if(pq_is_unicode_alnum_char(scanner->cp))
+                else if(char_class & PQ_UNICODE_ALNUM_CLASS)
                 {   //the start of a variable.
                     state = PQ_SCANNER_STATE_VAR;
                 }
@@ -416,6 +659,7 @@ pq_tok* pq_scanner_next_token(pq_scanner* scanner, char** err)
                 }
                 break;
             }
+            }
             break;
 
         //period token states.
@@ -428,7 +672,7 @@ pq_tok* pq_scanner_next_token(pq_scanner* scanner, char** err)
                     //generates the end token and rewinds the scanner to begin at the single line comment.
                     pq_scanner_rewind(scanner, 1);
                     pq_scanner_next_lexeme(scanner);
-                    return pq_new_str_literal_token(PQ_END_TOK, ".", 0);
+                    return pq_set_str_literal_token(tok, PQ_END_TOK, ".", 0);
                 }
                 else
                 {   //the start of a graphic atom.
@@ -439,13 +683,13 @@ pq_tok* pq_scanner_next_token(pq_scanner* scanner, char** err)
             {   //generates an end token and rewinds the scanner to the current character.
                 pq_scanner_rewind(scanner, 1);
                 pq_scanner_next_lexeme(scanner);
-                return pq_new_str_literal_token(PQ_END_TOK, ".", 0);
+                return pq_set_str_literal_token(tok, PQ_END_TOK, ".", 0);
             }
             else
             {   //generates the graphic token '.' as a name token and rewinds the scanner to the current character.
                 pq_scanner_rewind(scanner, 1);
                 pq_scanner_next_lexeme(scanner);
-                return pq_new_str_literal_token(PQ_NAME_TOK, ".", 0);
+                return pq_set_atom_token(tok, PQ_NAME_TOK, PQ_ATOM_DOT, 0);
             }
             
             break;
@@ -523,9 +767,7 @@ pq_tok* pq_scanner_next_token(pq_scanner* scanner, char** err)
             {   //creates the alphanumerical atom the moment an alphanum character is not found.
                 //and rewinds the scanner back to the non-alphanum character.
                 pq_scanner_rewind(scanner, 1);
-                char* lexeme = pq_scanner_get_lexeme(scanner);
-                pq_scanner_next_lexeme(scanner);
-                return pq_new_str_token(PQ_NAME_TOK, lexeme, 0);
+                return pq_scanner_make_name_token(scanner, tok, pq_make_lexeme(scanner->buffer + scanner->beg, pq_scanner_get_lexeme_size(scanner)));
             }
             break;
 
@@ -537,13 +779,13 @@ pq_tok* pq_scanner_next_token(pq_scanner* scanner, char** err)
             case '\'':
             case '"':
             case '`':
-                if(scanner->cp == pq_string_get_char(scanner->quoted_atom_name, 0))
+                if(scanner->cp == scanner->quoted_atom_quote)
                 {   //either the closing quote of the quoted atom or two consecutive quotes that will be appended as one quote.
                     state = PQ_SCANNER_STATE_POT_Q_NAME_CL;
                 }
                 else
                 {   //appends the non-closing quote to the quoted atom.
-                    pq_scanner_quoted_atom_append(scanner, scanner->cp);
+                    pq_scanner_quoted_atom_append_verbatim(scanner);
                 }
                 break;
             
@@ -560,7 +802,7 @@ pq_tok* pq_scanner_next_token(pq_scanner* scanner, char** err)
             case '\r':
             case '\t':
             case '\v':
-                pq_scanner_quoted_atom_append(scanner, scanner->cp);
+                pq_scanner_quoted_atom_append_verbatim(scanner);
                 break;
             
             case '\\':
@@ -571,7 +813,7 @@ pq_tok* pq_scanner_next_token(pq_scanner* scanner, char** err)
             default:
                 if(pq_is_unicode_single_quoted_token_char(scanner->cp))
                 {   //appends the character to the quoted atom.
-                    pq_scanner_quoted_atom_append(scanner, scanner->cp);
+                    pq_scanner_quoted_atom_append_verbatim(scanner);
                 }
                 else
                 {   //lexer error: unrecognized single quoted character.
@@ -583,7 +825,7 @@ pq_tok* pq_scanner_next_token(pq_scanner* scanner, char** err)
 
         case PQ_SCANNER_STATE_POT_Q_NAME_CL:
             //checks for either the end of the single quoted atom or appends a single quote.
-            if(scanner->cp == pq_string_get_char(scanner->quoted_atom_name, 0))
+            if(scanner->cp == scanner->quoted_atom_quote)
             {   //double end quotes within a quoted atom are read as that quote in the atom's name.
                 pq_scanner_quoted_atom_append(scanner, scanner->cp);
                 state = PQ_SCANNER_STATE_Q_NAME_OP;
@@ -591,9 +833,11 @@ pq_tok* pq_scanner_next_token(pq_scanner* scanner, char** err)
             else
             {   //end of the quoted atom.
                 pq_scanner_rewind(scanner, 1);
-                pq_string_append_char(scanner->quoted_atom_name, pq_string_get_char(scanner->quoted_atom_name, 0));
-                pq_scanner_next_lexeme(scanner);
-                return pq_new_str_token(PQ_NAME_TOK, pq_scanner_quoted_atom_get_lexeme(scanner), 0);
+                if(scanner->quoted_atom_materialized)
+                {   //the name differs from the lexeme, it is interned from the materialized name.
+                    pq_string_append_char(scanner->quoted_atom_name, (char)scanner->quoted_atom_quote);
+                }
+                return pq_scanner_make_name_token(scanner, tok, pq_scanner_quoted_atom_get_name(scanner));
             }
             break;
 
@@ -696,7 +940,7 @@ pq_tok* pq_scanner_next_token(pq_scanner* scanner, char** err)
 
             default:
                 //not a part of the ISO standard, but uses a closing quote as the end as well.
-                if(scanner->cp == pq_string_get_char(scanner->quoted_atom_name, 0))
+                if(scanner->cp == scanner->quoted_atom_quote)
                 {
                     if(pq_scanner_quoted_atom_append_escape(scanner))
                     {   //successfully appends the escaped octal sequence and goes back to reading the quoted atom.
@@ -770,7 +1014,7 @@ pq_tok* pq_scanner_next_token(pq_scanner* scanner, char** err)
 
             default:
                 //not a part of the ISO standard, but uses a closing quote as the end as well.
-                if(scanner->cp == pq_string_get_char(scanner->quoted_atom_name, 0))
+                if(scanner->cp == scanner->quoted_atom_quote)
                 {
                     if(pq_scanner_quoted_atom_append_escape(scanner))
                     {   //successfully appends the escaped hexadecimal sequence and goes back to reading the quoted atom.
@@ -800,9 +1044,7 @@ pq_tok* pq_scanner_next_token(pq_scanner* scanner, char** err)
             {   //creates the graphic atom the moment a graphic token character is not found.
                 //and rewinds the scanner back to the non-graphic token character.
                 pq_scanner_rewind(scanner, 1);
-                char* lexeme = pq_scanner_get_lexeme(scanner);
-                pq_scanner_next_lexeme(scanner);
-                return pq_new_str_token(PQ_NAME_TOK, lexeme, 0);
+                return pq_scanner_make_name_token(scanner, tok, pq_make_lexeme(scanner->buffer + scanner->beg, pq_scanner_get_lexeme_size(scanner)));
             }
             break;
 
@@ -839,7 +1081,7 @@ pq_tok* pq_scanner_next_token(pq_scanner* scanner, char** err)
                 {   //generates the 0 into a decimal and reset the states at the current character.
                     pq_scanner_rewind(scanner, 1);
                     pq_scanner_next_lexeme(scanner);
-                    return pq_new_int_token(PQ_INT_TOK, 0, 0);
+                    return pq_set_int_token(tok, PQ_INT_TOK, 0, 0);
                 }
                 break;
             }
@@ -855,7 +1097,7 @@ pq_tok* pq_scanner_next_token(pq_scanner* scanner, char** err)
             {   //generates the 0 into a decimal and reset the states at the previous 'b'.
                 pq_scanner_rewind(scanner, 2);
                 pq_scanner_next_lexeme(scanner);
-                return pq_new_int_token(PQ_INT_TOK, 0, 0);
+                return pq_set_int_token(tok, PQ_INT_TOK, 0, 0);
             }
             break;
 
@@ -864,11 +1106,7 @@ pq_tok* pq_scanner_next_token(pq_scanner* scanner, char** err)
             if(!pq_is_unicode_bin_char(scanner->cp))
             {   //generates the binary integer.
                 pq_scanner_rewind(scanner, 1);
-                char* lexeme = pq_scanner_get_lexeme(scanner);
-                PQint val = strtoll(lexeme+2, NULL, 2);
-                free(lexeme);
-                pq_scanner_next_lexeme(scanner);
-                return pq_new_int_token(PQ_INT_TOK, val, 0);
+                return pq_scanner_make_int_token(scanner, tok, 2, 2);
             }
             break;
         
@@ -882,7 +1120,7 @@ pq_tok* pq_scanner_next_token(pq_scanner* scanner, char** err)
             {   //generates the 0 into a decimal and reset the states at the previous 'o'.
                 pq_scanner_rewind(scanner, 2);
                 pq_scanner_next_lexeme(scanner);
-                return pq_new_int_token(PQ_INT_TOK, 0, 0);
+                return pq_set_int_token(tok, PQ_INT_TOK, 0, 0);
             }
             break;
 
@@ -891,11 +1129,7 @@ pq_tok* pq_scanner_next_token(pq_scanner* scanner, char** err)
             if(!pq_is_unicode_oct_char(scanner->cp))
             {   //generates the octal integer.
                 pq_scanner_rewind(scanner, 1);
-                char* lexeme = pq_scanner_get_lexeme(scanner);
-                PQint val = strtoll(lexeme+2, NULL, 8);
-                free(lexeme);
-                pq_scanner_next_lexeme(scanner);
-                return pq_new_int_token(PQ_INT_TOK, val, 0);
+                return pq_scanner_make_int_token(scanner, tok, 2, 8);
             }
             break;
 
@@ -908,11 +1142,7 @@ pq_tok* pq_scanner_next_token(pq_scanner* scanner, char** err)
             else if(!pq_is_unicode_dec_char(scanner->cp))
             {   //generates the decimal integer.
                 pq_scanner_rewind(scanner, 1);
-                char* lexeme = pq_scanner_get_lexeme(scanner);
-                PQint val = strtoll(lexeme, NULL, 10);
-                free(lexeme);
-                pq_scanner_next_lexeme(scanner);
-                return pq_new_int_token(PQ_INT_TOK, val, 0);
+                return pq_scanner_make_int_token(scanner, tok, 0, 10);
             }
             break;
         
@@ -926,7 +1156,7 @@ pq_tok* pq_scanner_next_token(pq_scanner* scanner, char** err)
             {   //generates the 0 into a decimal and reset the states at the previous 'x'.
                 pq_scanner_rewind(scanner, 2);
                 pq_scanner_next_lexeme(scanner);
-                return pq_new_int_token(PQ_INT_TOK, 0, 0);
+                return pq_set_int_token(tok, PQ_INT_TOK, 0, 0);
             }
             break;
 
@@ -935,11 +1165,7 @@ pq_tok* pq_scanner_next_token(pq_scanner* scanner, char** err)
             if(!pq_is_unicode_hex_char(scanner->cp))
             {   //generates the hex integer.
                 pq_scanner_rewind(scanner, 1);
-                char* lexeme = pq_scanner_get_lexeme(scanner);
-                PQint val = strtoll(lexeme+2, NULL, 16);
-                free(lexeme);
-                pq_scanner_next_lexeme(scanner);
-                return pq_new_int_token(PQ_INT_TOK, val, 0);
+                return pq_scanner_make_int_token(scanner, tok, 2, 16);
             }
             break;
 
@@ -954,11 +1180,7 @@ pq_tok* pq_scanner_next_token(pq_scanner* scanner, char** err)
             {   //the decimal point is for a different token.
                 //generates the decimal integer before it and rewinds the scanner back to the decimal point.
                 pq_scanner_rewind(scanner, 2);
-                char* lexeme = pq_scanner_get_lexeme(scanner);
-                PQint val = strtoll(lexeme, NULL, 10);
-                free(lexeme);
-                pq_scanner_next_lexeme(scanner);
-                return pq_new_int_token(PQ_INT_TOK, val, 0);
+                return pq_scanner_make_int_token(scanner, tok, 0, 10);
             }
             break;
 
@@ -969,14 +1191,20 @@ pq_tok* pq_scanner_next_token(pq_scanner* scanner, char** err)
             {   //the start of a potential exponent.
                 state = PQ_SCANNER_STATE_POT_FLOAT_EXP;
             }
+            else if('I' == scanner->cp)
+            {   //the start of a potential infinity (e.g. 1.0Inf).
+                state = PQ_SCANNER_STATE_POT_FLOAT_INF_N;
+            }
+            else if('N' == scanner->cp)
+            {   //the start of a potential not-a-number (e.g. 1.5NaN).
+                state = PQ_SCANNER_STATE_POT_FLOAT_NAN_A;
+            }
             else if(!pq_is_unicode_dec_char(scanner->cp))
             {   //generates the floating-point obtain so far and rewinds the scanner back to the unknown character.
                 pq_scanner_rewind(scanner, 1);
-                char* lexeme = pq_scanner_get_lexeme(scanner);
-                PQflt val = strtod(lexeme, NULL);
-                free(lexeme);
+                PQflt val = pq_scanner_get_lexeme_flt(scanner);
                 pq_scanner_next_lexeme(scanner);
-                return pq_new_flt_token(PQ_FLT_TOK, val, 0);
+                return pq_set_flt_token(tok, PQ_FLT_TOK, val, 0);
             }
             break;
 
@@ -995,11 +1223,9 @@ pq_tok* pq_scanner_next_token(pq_scanner* scanner, char** err)
             {   //the 'E'/'e' is being used for another token.
                 //generates the floating-point value so far and rewinds the scanner back to the 'E'/'e'.
                 pq_scanner_rewind(scanner, 2);
-                char* lexeme = pq_scanner_get_lexeme(scanner);
-                PQflt val = strtod(lexeme, NULL);
-                free(lexeme);
+                PQflt val = pq_scanner_get_lexeme_flt(scanner);
                 pq_scanner_next_lexeme(scanner);
-                return pq_new_flt_token(PQ_FLT_TOK, val, 0);
+                return pq_set_flt_token(tok, PQ_FLT_TOK, val, 0);
             }
             break;
         
@@ -1013,11 +1239,9 @@ pq_tok* pq_scanner_next_token(pq_scanner* scanner, char** err)
             {   //the 'E'/'e' and '+'/'-' are for two different tokens.
                 //generates the floating-point obtain so far and rewinds the scanner to the 'E'/'e'
                 pq_scanner_rewind(scanner, 3);
-                char* lexeme = pq_scanner_get_lexeme(scanner);
-                PQflt val = strtod(lexeme, NULL);
-                free(lexeme);
+                PQflt val = pq_scanner_get_lexeme_flt(scanner);
                 pq_scanner_next_lexeme(scanner);
-                return pq_new_flt_token(PQ_FLT_TOK, val, 0);
+                return pq_set_flt_token(tok, PQ_FLT_TOK, val, 0);
             }
             break;
 
@@ -1026,11 +1250,42 @@ pq_tok* pq_scanner_next_token(pq_scanner* scanner, char** err)
             {   //generates the floating-point value
                 //and rewinds the scanner back to the non-decimal character.
                 pq_scanner_rewind(scanner, 1);
-                char* lexeme = pq_scanner_get_lexeme(scanner);
-                PQflt val = strtod(lexeme, NULL);
-                free(lexeme);
+                PQflt val = pq_scanner_get_lexeme_flt(scanner);
+                pq_scanner_next_lexeme(scanner);
+                return pq_set_flt_token(tok, PQ_FLT_TOK, val, 0);
+            }
+            break;
+
+        //the infinity and not-a-number floats, the 'I' or 'N' is for another token unless the whole suffix is found.
+        case PQ_SCANNER_STATE_POT_FLOAT_INF_N:
+        case PQ_SCANNER_STATE_POT_FLOAT_NAN_A:
+            if((PQ_SCANNER_STATE_POT_FLOAT_INF_N == state && 'n' == scanner->cp) || (PQ_SCANNER_STATE_POT_FLOAT_NAN_A == state && 'a' == scanner->cp))
+            {   //checks for the last character of the suffix.
+                state = PQ_SCANNER_STATE_POT_FLOAT_INF_N == state ? PQ_SCANNER_STATE_POT_FLOAT_INF_F : PQ_SCANNER_STATE_POT_FLOAT_NAN_N;
+            }
+            else
+            {   //generates the floating-point value so far and rewinds the scanner back to the 'I'/'N'.
+                pq_scanner_rewind(scanner, 2);
+                PQflt val = pq_scanner_get_lexeme_flt(scanner);
+                pq_scanner_next_lexeme(scanner);
+                return pq_set_flt_token(tok, PQ_FLT_TOK, val, 0);
+            }
+            break;
+
+        case PQ_SCANNER_STATE_POT_FLOAT_INF_F:
+        case PQ_SCANNER_STATE_POT_FLOAT_NAN_N:
+            if((PQ_SCANNER_STATE_POT_FLOAT_INF_F == state && 'f' == scanner->cp) || (PQ_SCANNER_STATE_POT_FLOAT_NAN_N == state && 'N' == scanner->cp))
+            {   //generates the infinity or not-a-number, the suffix is the end of the lexeme.
+                PQflt val = pq_scanner_get_lexeme_flt(scanner);
                 pq_scanner_next_lexeme(scanner);
-                return pq_new_flt_token(PQ_FLT_TOK, val, 0);
+                return pq_set_flt_token(tok, PQ_FLT_TOK, val, 0);
+            }
+            else
+            {   //generates the floating-point value so far and rewinds the scanner back to the 'I'/'N'.
+                pq_scanner_rewind(scanner, 3);
+                PQflt val = pq_scanner_get_lexeme_flt(scanner);
+                pq_scanner_next_lexeme(scanner);
+                return pq_set_flt_token(tok, PQ_FLT_TOK, val, 0);
             }
             break;
 
@@ -1040,9 +1295,10 @@ pq_tok* pq_scanner_next_token(pq_scanner* scanner, char** err)
             {   //creates the variable the moment a alphanum token character is not found.
                 //and rewinds the scanner back to the non-alphanum token character.
                 pq_scanner_rewind(scanner, 1);
-                char* lexeme = pq_scanner_get_lexeme(scanner);
+                const size_t lexeme_beg = scanner->beg;
+                const size_t lexeme_sz = pq_scanner_get_lexeme_size(scanner);
                 pq_scanner_next_lexeme(scanner);
-                return pq_new_str_token(PQ_VAR_TOK, lexeme, 0);
+                return pq_set_slice_token(tok, PQ_VAR_TOK, lexeme_beg, lexeme_sz, 0);
             }
             break;
 
@@ -1057,10 +1313,18 @@ pq_tok* pq_scanner_next_token(pq_scanner* scanner, char** err)
     }
 
     //resets the scanner back upon lexer error.
+    //when streaming, the start of the lexeme may have been discarded, then the start of the buffer is used instead.
+    size_t discarded = scanner->buffer_pos - pos;
     scanner->ln = ln;
     scanner->col = col;
-    scanner->beg = beg;
-    scanner->end = end;
+    scanner->beg = beg > discarded ? beg - discarded : 0;
+    scanner->end = end > discarded ? end - discarded : 0;
+    scanner->cp_bytes = pq_utf8_to_cp(&scanner->cp, scanner->buffer + scanner->end);
 
     return NULL;
-}
\ No newline at end of file
+}
+
+void pq_scanner_skip_char(pq_scanner* scanner)
+{
+    pq_scanner_next_lexeme(scanner);
+}
@@ -4,8 +4,10 @@
  * @brief poqer-lang scanner header.
  * the pq_scanner struct is used to convert utf8 strings into poqer tokens.
  * create/destroy the scanner with the pq_new_* and pq_del_* functions.
- * set the buffer with pq_scanner_set_buffer function.
- * read tokens with pq_scanner_next_token function.
+ * set the buffer with pq_scanner_set_buffer function,
+ * or stream the input in chunks with the pq_scanner_set_source and pq_scanner_set_file functions.
+ * read tokens with pq_scanner_next_token function,
+ * or without allocations with pq_scanner_scan_token function.
  * When added, auxiliary functions for more functionality will be documented below.
  * 
  * @version 0.003
@@ -20,6 +22,20 @@
 #include "pq_string.h"
 #include "pq_token.h"
 #include <stdlib.h>
+#include <stdio.h>
+
+//the default number of bytes that a streaming scanner reads at a time.
+#define PQ_SCANNER_CHUNK_SIZE 65536
+
+/**
+ * @brief Reads the next chunk of a streamed input.
+ * 
+ * @param source The input that is being streamed (e.g. a FILE*).
+ * @param dest The bytes are stored here.
+ * @param size The maximum number of bytes to read.
+ * @return The number of bytes read, 0 upon the end of the input or a read error.
+ */
+typedef size_t (*pq_scanner_read_fn)(void* source, char* dest, const size_t size);
 
 /**
  * @brief The structure of a poqer-lang scanner.
@@ -28,10 +44,13 @@ typedef struct pq_scanner
 {   //these variables should only be read externally, not modified.
 
     //general use.
-    const char* buffer; //the utf8 string that is being read.
-    size_t buffer_sz; //the size of the buffer, excluding the null character.
+    const char* buffer; //the utf8 string that is being read, always followed by a null character.
+    size_t buffer_sz; //the number of bytes in the buffer, excluding the null character.
+    int8_t buffer_owned; //whether the buffer is deallocated by the scanner.
     size_t ln; //current line position in the buffer.
     size_t col; //current column position in the buffer (counted in terms of unicode characters).
+    size_t tok_ln; //the line of the first character of the last token (or of the token that has a lexer error).
+    size_t tok_col; //the column of the first character of the last token (or of the token that has a lexer error).
     size_t beg; //the lexeme's beginning position in the buffer.
     size_t end; //the lexeme's ending position in the buffer.
     
@@ -40,9 +59,20 @@ typedef struct pq_scanner
     int8_t cp_bytes; //the number of bytes in the current unicode char.
     
     //quoted atom helpers.
-    pq_string *quoted_atom_name; //the name of the quoted atom that will be used as the lexeme of the atom token.
+    uint32_t quoted_atom_quote; //the codepoint of the open/closing quote of the quoted atom.
+    int8_t quoted_atom_materialized; //whether the name differs from the lexeme in the buffer (escape sequences or double quotes were read).
+    size_t quoted_atom_verbatim_end; //the ending position of the verbatim characters in the buffer, while the name is not materialized.
+    pq_string *quoted_atom_name; //the materialized name of the quoted atom that will be used as the lexeme of the atom token.
     pq_string *quoted_atom_escape; //the numerical value of the hex/oct escape sequence.
     int8_t quoted_atom_append_mode; //whether the quote is reading a hex/oct escape sequence. 0 for none, 1 for oct, 2 for hex.
+
+    //streaming helpers, the buffer only holds a window of the input that starts at the current lexeme.
+    pq_scanner_read_fn read; //reads the next chunk of the input, NULL if the buffer holds the whole input.
+    void* source; //the input that is passed to read.
+    size_t chunk_sz; //the number of bytes requested from each read.
+    size_t buffer_cap; //the number of bytes allocated to the buffer, excluding the null character.
+    size_t buffer_pos; //the position of the buffer's first byte in the input.
+    int8_t source_eof; //whether read has reached the end of the input.
 } pq_scanner;
 
 /**
@@ -70,12 +100,25 @@ static inline pq_scanner* pq_new_scanner()
     }
     scanner->buffer = NULL;
     scanner->buffer_sz = 0;
+    scanner->buffer_owned = 0;
     scanner->ln = 1;
     scanner->col = 1;
+    scanner->tok_ln = 1;
+    scanner->tok_col = 1;
     scanner->beg = 0;
     scanner->end = 0;
     scanner->cp = 0;
     scanner->cp_bytes = 0;
+    scanner->quoted_atom_quote = 0;
+    scanner->quoted_atom_materialized = 0;
+    scanner->quoted_atom_verbatim_end = 0;
+    scanner->quoted_atom_append_mode = 0;
+    scanner->read = NULL;
+    scanner->source = NULL;
+    scanner->chunk_sz = 0;
+    scanner->buffer_cap = 0;
+    scanner->buffer_pos = 0;
+    scanner->source_eof = 1;
     return scanner;
 }
 
@@ -88,7 +131,7 @@ static inline void pq_del_scanner(pq_scanner* scanner)
 {
     if(!scanner) return;
 
-    if(scanner->buffer)
+    if(scanner->buffer && scanner->buffer_owned)
         free((void*)scanner->buffer);
     if(scanner->quoted_atom_escape)
         pq_del_string(scanner->quoted_atom_escape);
@@ -98,22 +141,89 @@ static inline void pq_del_scanner(pq_scanner* scanner)
 }
 
 /**
- * @brief Sets the buffer of the scanner.
- * The previous buffer is deallocated and the scanner's state resets to the start of the new buffer.
+ * @brief Sets a buffer that is not owned by the scanner (e.g. a memory mapped file).
+ * The previous buffer is deallocated if it is owned and the scanner's state resets to the start of the new buffer.
+ * The new buffer is never deallocated by the scanner, so it must outlive its use.
  * 
  * @param scanner The scanner that will be modified.
- * @param buffer A valid utf8 null-terminated c-string to be used (it will be deallocated upon replacement).
+ * @param buffer A valid utf8 string to be used, buffer[buffer_sz] must be a null character.
+ * @param buffer_sz The number of bytes in the buffer, excluding the null character.
  */
-static inline void pq_scanner_set_buffer(pq_scanner* scanner, const char* buffer)
+static inline void pq_scanner_set_buffer_view(pq_scanner* scanner, const char* buffer, const size_t buffer_sz)
 {
-    if(scanner->buffer) free((void*)scanner->buffer);
+    if(scanner->buffer && scanner->buffer_owned) free((void*)scanner->buffer);
     scanner->buffer = buffer;
-    scanner->buffer_sz = strlen(scanner->buffer);
+    scanner->buffer_sz = buffer_sz;
+    scanner->buffer_owned = 0;
+    scanner->buffer_cap = scanner->buffer_sz;
+    scanner->buffer_pos = 0;
+    scanner->read = NULL;
+    scanner->source = NULL;
+    scanner->source_eof = 1;
     scanner->beg = scanner->end = 0;
     scanner->ln = scanner->col = 1;
+    scanner->tok_ln = scanner->tok_col = 1;
     scanner->cp_bytes = pq_utf8_to_cp(&scanner->cp, scanner->buffer);
 }
 
+/**
+ * @brief Sets the buffer of the scanner.
+ * The previous buffer is deallocated if it is owned and the scanner's state resets to the start of the new buffer.
+ * 
+ * @param scanner The scanner that will be modified.
+ * @param buffer A valid utf8 null-terminated c-string to be used (it will be deallocated upon replacement).
+ */
+static inline void pq_scanner_set_buffer(pq_scanner* scanner, const char* buffer)
+{
+    pq_scanner_set_buffer_view(scanner, buffer, strlen(buffer));
+    scanner->buffer_owned = 1;
+}
+
+/**
+ * @brief Checks if the slices of the scanner's buffer can be invalidated by someone other than the scanner's user.
+ * This happens when streaming, as the buffer is reused for the following chunks, or with a buffer that is not owned by the scanner.
+ * 
+ * @param scanner The scanner that will be checked.
+ * @return true if the slices should be copied to outlive the current token else false.
+ */
+static inline PQbool pq_scanner_has_transient_buffer(const pq_scanner* scanner)
+{
+    return scanner->read != NULL || !scanner->buffer_owned;
+}
+
+/**
+ * @brief Streams the input of the scanner through a read function.
+ * The previous buffer is deallocated if it is owned and the scanner's state resets to the start of the input.
+ * Only the bytes from the current lexeme onwards are kept, so the buffer stays around the chunk size plus the longest token.
+ * Tokens, utf8 characters, quoted atoms, and comments can span the chunks.
+ * 
+ * @param scanner The scanner that will be modified.
+ * @param read The function that reads the next chunk of the input.
+ * @param source The input that is passed to read, it is not deallocated by the scanner.
+ * @param chunk_sz The number of bytes requested from each read.
+ */
+void pq_scanner_set_source(pq_scanner* scanner, pq_scanner_read_fn read, void* source, const size_t chunk_sz);
+
+/**
+ * @brief Streams the input of the scanner from a file in chunks of PQ_SCANNER_CHUNK_SIZE bytes.
+ * 
+ * @param scanner The scanner that will be modified.
+ * @param file The file opened for reading, it is not closed by the scanner.
+ */
+void pq_scanner_set_file(pq_scanner* scanner, FILE* file);
+
+/**
+ * @brief Checks if the scanner streams its input.
+ * When streaming, the buffer is reused for the following chunks, so slice tokens are only valid until the next token is read.
+ * 
+ * @param scanner The scanner that will be checked.
+ * @return true if the scanner streams its input else false.
+ */
+static inline PQbool pq_scanner_is_streaming(const pq_scanner* scanner)
+{
+    return scanner->read != NULL;
+}
+
 /**
  * @brief Reads the next token in the scanner.
  * The scanner's lexing position will change when a token is found or layout characters and comments are being skipped.
@@ -122,6 +232,7 @@ static inline void pq_scanner_set_buffer(pq_scanner* scanner, const char* buffer
  * If a token is not found or a lexer error occurs, NULL is returned.
  * If an invalid utf8 c-string is used as the buffer, the behavior is undefined.
  * If there is not enough memory for required operations, the behavior is undefined.
+ * Names are interned in the atom table, so their tokens hold an atom id instead of a string.
  * 
  * @param scanner The scanner that will be used.
  * @param err The error message is stored here if any. 
@@ -129,4 +240,41 @@ static inline void pq_scanner_set_buffer(pq_scanner* scanner, const char* buffer
  */
 pq_tok* pq_scanner_next_token(pq_scanner* scanner, char** err);
 
+/**
+ * @brief Reads the next token in the scanner into a token owned by the caller, without allocating it.
+ * This behaves like pq_scanner_next_token, except that variables are not copied.
+ * Their tokens hold a slice of the scanner's buffer instead, see pq_scanner_get_token_lexeme.
+ * 
+ * @param scanner The scanner that will be used.
+ * @param tok The token that will be initialized.
+ * @param err The error message is stored here if any. 
+ * @return The tok pointer if a token is found else NULL.
+ */
+pq_tok* pq_scanner_scan_token(pq_scanner* scanner, pq_tok* tok, char** err);
+
+/**
+ * @brief Skips the current character, so the scanner can continue after a lexer error (the scanner stays at the start of the bad token).
+ * 
+ * @param scanner The scanner that will be modified.
+ */
+void pq_scanner_skip_char(pq_scanner* scanner);
+
+/**
+ * @brief Gets the lexeme of a token read by the scanner.
+ * The lexeme of a name token is the name of its interned atom.
+ * The lexeme of a slice token is valid until the scanner's buffer is replaced (or until the next token is read when streaming).
+ * The integer and float tokens do not keep their lexeme, an empty lexeme is returned for them (a bignum token is a slice token).
+ * 
+ * @param scanner The scanner that read the token.
+ * @param tok The name, variable, or bignum token.
+ * @return The lexeme of the token.
+ */
+static inline pq_lexeme pq_scanner_get_token_lexeme(const pq_scanner* scanner, const pq_tok* tok)
+{
+    if(pq_token_has_atom(tok)) return pq_atom_get_name(tok->val.atom);
+    if(tok->_is_slice) return pq_make_lexeme(scanner->buffer + tok->val.slice.off, tok->val.slice.len);
+    if(tok->tag == PQ_INT_TOK || tok->tag == PQ_FLT_TOK) return PQ_LEXEME_LITERAL("");
+    return pq_make_lexeme(tok->val.s, strlen(tok->val.s));
+}
+
 #endif
\ No newline at end of file
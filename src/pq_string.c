@@ -24,11 +24,12 @@ void pq_string_clear(pq_string* string)
         string->str_size = 0;
         string->str = malloc(PQ_STRING_MEM_OFFSET);
     }
+    string->str[0] = '\0';
 }
 
 void pq_string_append_char(pq_string* dest, const char ch)
 {
-    if(dest->str_size - 1 >= dest->mem_size)
+    if(dest->str_size + 1 >= dest->mem_size)
     {
         char *str = realloc(dest->str, (dest->mem_size += PQ_STRING_MEM_OFFSET));
         dest->str = str;
@@ -42,7 +43,7 @@ void pq_string_append_str(pq_string* dest, const char* src)
     size_t len = strlen(src);
     if(!len) return;
     
-    if(dest->str_size + len - 2 >= dest->mem_size)
+    if(dest->str_size + len >= dest->mem_size)
     {
         char *str = realloc(dest->str, (dest->mem_size += PQ_STRING_MEM_OFFSET + len - 1));
         dest->str = str;
@@ -55,7 +56,7 @@ void pq_string_append_string(pq_string* dest, const pq_string* src)
 {
     if(!src->str_size) return;
 
-    if(dest->str_size + src->str_size - 2 >= dest->mem_size)
+    if(dest->str_size + src->str_size >= dest->mem_size)
     {
         char *str = realloc(dest->str, (dest->mem_size += PQ_STRING_MEM_OFFSET + src->str_size - 1));
         dest->str = str;
@@ -32,6 +32,12 @@ static inline pq_string* pq_new_string()
     string->mem_size = PQ_STRING_MEM_OFFSET;
     string->str_size = 0;
     string->str = malloc(PQ_STRING_MEM_OFFSET);
+    if(!string->str)
+    {
+        free(string);
+        return NULL;
+    }
+    string->str[0] = '\0';
 
     return string;
 }
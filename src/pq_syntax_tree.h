@@ -4,6 +4,7 @@
  * @brief poqer-lang syntax tree header.
  * the pq_syntax_tree struct is used to store the syntax tree of the poqer program.
  * create/destroy the syntax tree with the pq_new_* and pq_del_* functions.
+ * a syntax tree created with pq_new_arena_* functions is deallocated with its arena instead.
  * 
  * @version 0.001
  * @date 11-6-2020
@@ -13,6 +14,7 @@
 #ifndef _PQ_SYNTAX_TREE_H
 #define _PQ_SYNTAX_TREE_H
 #include "pq_globals.h"
+#include "pq_arena.h"
 #include <stdlib.h>
 #include <inttypes.h>
 
@@ -30,6 +32,7 @@ typedef struct pq_syntax_tree_node
 typedef struct pq_syntax_tree
 {   //these variables should only be read externally, not modified.
     pq_syntax_tree_node* children_nil;
+    pq_arena* arena; //the arena of the tree, NULL if it is malloc'd.
 } pq_syntax_tree;
 
 static inline pq_syntax_tree_node* pq_new_syntax_tree_node(void* item)
@@ -42,6 +45,17 @@ static inline pq_syntax_tree_node* pq_new_syntax_tree_node(void* item)
     return node;
 }
 
+static inline pq_syntax_tree_node* pq_new_arena_syntax_tree_node(pq_arena* arena, void* item)
+{
+    pq_syntax_tree_node* node = (pq_syntax_tree_node*)pq_arena_alloc(arena, sizeof(pq_syntax_tree_node));
+    if(!node) return NULL;
+    node->item = item;
+    node->prev = NULL;
+    node->next = NULL;
+    node->children_nil = NULL;
+    return node;
+}
+
 static inline pq_syntax_tree_node* pq_new_syntax_tree_nil_node()
 {
     pq_syntax_tree_node* node = (pq_syntax_tree_node*)malloc(sizeof(pq_syntax_tree_node));
@@ -67,6 +81,28 @@ static inline pq_syntax_tree* pq_new_syntax_tree()
         free(tree);
         return NULL;
     }
+    tree->arena = NULL;
+    return tree;
+}
+
+/**
+ * @brief Allocation for a pq_syntax_tree struct from an arena, initializes the syntax tree, then returns the pointer.
+ * The tree is deallocated with the arena, its nodes should be created with pq_new_arena_syntax_tree_node function.
+ * 
+ * @param arena The arena that will be used.
+ * @return A pointer to the allocated pq_syntax_tree struct.
+ */
+static inline pq_syntax_tree* pq_new_arena_syntax_tree(pq_arena* arena)
+{
+    pq_syntax_tree* tree = (pq_syntax_tree*)pq_arena_alloc(arena, sizeof(pq_syntax_tree));
+    if(!tree) return NULL;
+    tree->children_nil = (pq_syntax_tree_node*)pq_arena_alloc(arena, sizeof(pq_syntax_tree_node));
+    if(!tree->children_nil) return NULL;
+    tree->children_nil->item = NULL;
+    tree->children_nil->prev = tree->children_nil;
+    tree->children_nil->next = tree->children_nil;
+    tree->children_nil->children_nil = NULL;
+    tree->arena = arena;
     return tree;
 }
 
@@ -77,7 +113,7 @@ static inline pq_syntax_tree* pq_new_syntax_tree()
  */
 static inline void pq_del_syntax_tree(pq_syntax_tree* tree)
 {
-    if(!tree) return;
+    if(!tree || tree->arena) return;
     free(tree);
 }
 
@@ -0,0 +1,382 @@
+/**
+ * @file pq_table.c
+ * @author Brandon Foster
+ * @brief poqer-lang answer tables implementation.
+ *
+ * @version 0.001
+ * @date 10-16-2026
+ * @copyright Brandon Foster (c) 2020-2021
+ */
+
+#include "pq_table.h"
+
+#define PQ_TABLE_INIT_SLOTS 1024
+
+/**
+ * @brief Gets the index of the first slot to probe for the child of a node.
+ *
+ * @param space The space that will be used.
+ * @param parent The parent node.
+ * @param token The token of the child.
+ * @return The index of the slot.
+ */
+static inline size_t pq_table_hash(const pq_table_space* space, const uint32_t parent, const pq_term token)
+{
+    //the tokens are pointers, tagged numbers or atom ids, multiplicative hashing mixes them into the high bits.
+    return (size_t)(((token + parent * 0xC2B2AE3D27D4EB4Full) * 0x9E3779B97F4A7C15ull) >> 32) & space->slot_mask;
+}
+
+/**
+ * @brief Doubles the number of slots and reinserts every node that is not a root.
+ *
+ * @param space The space that will be modified.
+ * @return PQ_SUCCESS if the slots were reallocated else PQ_FAILURE.
+ */
+static int pq_table_grow(pq_table_space* space)
+{
+    const size_t size = (space->slot_mask + 1) << 1;
+    uint32_t* slots = (uint32_t*)calloc(size, sizeof(uint32_t));
+    if(!slots) return PQ_FAILURE;
+
+    free(space->slots);
+    space->slots = slots;
+    space->slot_mask = size - 1;
+    for(uint32_t i = 1; i < space->nodes_sz; ++i)
+    {
+        const pq_trie_node* node = &space->nodes[i];
+        if(!node->parent) continue;
+        size_t j = pq_table_hash(space, node->parent, node->token);
+        while(slots[j]) j = (j + 1) & space->slot_mask;
+        slots[j] = i;
+    }
+    return PQ_SUCCESS;
+}
+
+/**
+ * @brief Creates a node, a root if parent is 0.
+ *
+ * @param space The space that will be modified.
+ * @param parent The parent node, 0 for a root.
+ * @param token The token of the edge from the parent.
+ * @return The node, 0 if there is not enough memory.
+ */
+static uint32_t pq_table_new_node(pq_table_space* space, const uint32_t parent, const pq_term token)
+{
+    if(space->nodes_sz >= UINT32_MAX) return 0;
+    if(pq_array_reserve((void**)&space->nodes, &space->nodes_cap, space->nodes_sz + 1, sizeof(pq_trie_node)) != PQ_SUCCESS)
+        return 0;
+    if((space->nodes_sz + 1) * 2 > space->slot_mask + 1 && pq_table_grow(space) != PQ_SUCCESS) return 0;
+
+    const uint32_t node = (uint32_t)space->nodes_sz++;
+    space->nodes[node].token = token;
+    space->nodes[node].parent = parent;
+    space->nodes[node].value = 0;
+    if(parent)
+    {   //the slots are never more than half full so an empty slot is always found.
+        size_t i = pq_table_hash(space, parent, token);
+        while(space->slots[i]) i = (i + 1) & space->slot_mask;
+        space->slots[i] = node;
+    }
+    return node;
+}
+
+/**
+ * @brief Finds the path of space->tokens from a root, the missing nodes are created.
+ *
+ * @param space The space that will be modified.
+ * @param root The root of the trie.
+ * @param leaf Receives the last node of the path.
+ * @param added Receives whether a node was created, the tokens of a term are self-delimiting so the term was not in the trie.
+ * @return PQ_SUCCESS if the path is in the trie else PQ_FAILURE.
+ */
+static int pq_table_insert(pq_table_space* space, const uint32_t root, uint32_t* leaf, PQbool* added)
+{
+    uint32_t node = root;
+    *added = PQ_FALSE;
+    for(size_t k = 0; k < space->tokens_sz; ++k)
+    {
+        const pq_term token = space->tokens[k];
+        uint32_t child = 0;
+        if(!*added)
+        {   //linear probing, a new node has no children so the probing stops after the first one.
+            size_t i = pq_table_hash(space, node, token);
+            for(; space->slots[i]; i = (i + 1) & space->slot_mask)
+            {
+                const pq_trie_node* candidate = &space->nodes[space->slots[i]];
+                if(candidate->parent == node && candidate->token == token)
+                {
+                    child = space->slots[i];
+                    break;
+                }
+            }
+        }
+        if(!child)
+        {
+            child = pq_table_new_node(space, node, token);
+            if(!child) return PQ_FAILURE;
+            *added = PQ_TRUE;
+        }
+        node = child;
+    }
+    *leaf = node;
+    return PQ_SUCCESS;
+}
+
+/**
+ * @brief Appends a token to space->tokens.
+ *
+ * @param space The space that will be modified.
+ * @param token The token.
+ * @return PQ_SUCCESS if the token was appended else PQ_FAILURE.
+ */
+static inline int pq_table_push_token(pq_table_space* space, const pq_term token)
+{
+    if(pq_array_reserve((void**)&space->tokens, &space->tokens_cap, space->tokens_sz + 1, sizeof(pq_term)) != PQ_SUCCESS)
+        return PQ_FAILURE;
+    space->tokens[space->tokens_sz++] = token;
+    return PQ_SUCCESS;
+}
+
+/**
+ * @brief Stores the tokens of a term in space->tokens, in pre-order, so two terms have the same tokens if they are variants.
+ * The variable cells of the term are marked with their numbers while it is walked, they are restored before returning.
+ *
+ * @param space The space that will be modified.
+ * @param term The term.
+ * @return PQ_SUCCESS if the tokens were stored else PQ_FAILURE.
+ */
+static int pq_table_tokenize(pq_table_space* space, const pq_term term)
+{
+    size_t sz = 0;
+    size_t marked_sz = 0;
+    int status = pq_array_reserve((void**)&space->pdl, &space->pdl_cap, 1, sizeof(pq_term));
+    space->tokens_sz = 0;
+    if(status == PQ_SUCCESS) space->pdl[sz++] = term;
+
+    while(sz && status == PQ_SUCCESS)
+    {
+        const pq_term t = pq_term_deref(space->pdl[--sz]);
+        switch(pq_term_get_tag(t))
+        {
+        case PQ_TAG_REF:
+        {   //the cell of the variable holds its token until it is restored, a functor cell is never the value of a cell.
+            const pq_term token = pq_make_functor_cell(PQ_ATOM_NONE, (uint32_t)marked_sz);
+            status = pq_array_reserve((void**)&space->marked, &space->marked_cap, marked_sz + 1, sizeof(pq_term*));
+            if(status != PQ_SUCCESS) break;
+            space->marked[marked_sz++] = pq_term_get_ptr(t);
+            *pq_term_get_ptr(t) = token;
+            status = pq_table_push_token(space, token);
+            break;
+        }
+        case PQ_TAG_LIST:
+        case PQ_TAG_STR:
+        {
+            const PQbool is_list = pq_term_get_tag(t) == PQ_TAG_LIST;
+            const uint32_t arity = pq_term_get_arity(t);
+            status = pq_table_push_token(space, is_list ? (pq_term)PQ_TAG_LIST : *pq_term_get_ptr(t));
+            if(status == PQ_SUCCESS) status = pq_array_reserve((void**)&space->pdl, &space->pdl_cap, sz + arity, sizeof(pq_term));
+            if(status != PQ_SUCCESS) break;
+            const pq_term* args = pq_term_get_args(t);
+            for(uint32_t i = arity; i-- > 0;) space->pdl[sz++] = args[i];
+            break;
+        }
+        case PQ_TAG_BOX:
+        {   //the header and the raw data cells, they are compared by value.
+            const pq_term* cells = pq_term_get_ptr(t);
+            const size_t n = (size_t)(cells[0] >> 32) + 1;
+            status = pq_array_reserve((void**)&space->tokens, &space->tokens_cap, space->tokens_sz + n, sizeof(pq_term));
+            if(status != PQ_SUCCESS) break;
+            memcpy(&space->tokens[space->tokens_sz], cells, n * sizeof(pq_term));
+            space->tokens_sz += n;
+            break;
+        }
+        default: //an atom, a small integer, or a marked variable.
+            status = pq_table_push_token(space, t);
+            break;
+        }
+    }
+
+    for(size_t i = 0; i < marked_sz; ++i) *space->marked[i] = pq_make_ptr_term(space->marked[i], PQ_TAG_REF);
+    return status;
+}
+
+pq_table_space* pq_new_table_space(void)
+{
+    pq_table_space* space = (pq_table_space*)calloc(1, sizeof(pq_table_space));
+    if(!space) return NULL;
+
+    space->slots = (uint32_t*)calloc(PQ_TABLE_INIT_SLOTS, sizeof(uint32_t));
+    if(!space->slots)
+    {
+        free(space);
+        return NULL;
+    }
+    space->slot_mask = PQ_TABLE_INIT_SLOTS - 1;
+    space->nodes_sz = 1;
+    space->call_root = pq_table_new_node(space, 0, PQ_TERM_NONE);
+    if(!space->call_root)
+    {
+        pq_del_table_space(space);
+        return NULL;
+    }
+    return space;
+}
+
+void pq_del_table_space(pq_table_space* space)
+{
+    if(!space) return;
+
+    for(size_t i = 0; i < space->tables_sz; ++i) free(space->tables[i].answers);
+    free(space->tables);
+    free(space->nodes);
+    free(space->slots);
+    free(space->stack);
+    free(space->pending);
+    free(space->tokens);
+    free(space->pdl);
+    free(space->marked);
+    free(space);
+}
+
+void pq_table_space_clear(pq_table_space* space)
+{
+    for(size_t i = 0; i < space->tables_sz; ++i) free(space->tables[i].answers);
+    space->tables_sz = 0;
+    space->stack_sz = 0;
+    space->pending_sz = 0;
+
+    //the call root is the first node, it is kept.
+    memset(space->slots, 0, (space->slot_mask + 1) * sizeof(uint32_t));
+    space->nodes_sz = space->call_root + 1;
+    space->nodes[space->call_root].value = 0;
+}
+
+void pq_table_space_reset(pq_table_space* space, const size_t stack_sz)
+{
+    if(space->stack_sz <= stack_sz) return;
+
+    //the incomplete tables of the abandoned leaders are above the kept ones.
+    while(space->pending_sz && space->tables[space->pending[space->pending_sz - 1]].depth >= stack_sz)
+    {
+        pq_table* table = &space->tables[space->pending[--space->pending_sz]];
+        if(table->state != PQ_TABLE_COMPLETE) table->state = PQ_TABLE_NEW;
+    }
+    while(space->stack_sz > stack_sz) space->tables[space->stack[--space->stack_sz]].state = PQ_TABLE_NEW;
+}
+
+uint32_t pq_table_get(pq_table_space* space, const pq_term goal)
+{
+    uint32_t leaf;
+    PQbool added;
+    if(pq_table_tokenize(space, goal) != PQ_SUCCESS || pq_table_insert(space, space->call_root, &leaf, &added) != PQ_SUCCESS)
+        return UINT32_MAX;
+    if(space->nodes[leaf].value) return space->nodes[leaf].value - 1;
+
+    if(space->tables_sz >= UINT32_MAX - 1
+        || pq_array_reserve((void**)&space->tables, &space->tables_cap, space->tables_sz + 1, sizeof(pq_table)) != PQ_SUCCESS)
+        return UINT32_MAX;
+    const uint32_t root = pq_table_new_node(space, 0, PQ_TERM_NONE);
+    if(!root) return UINT32_MAX;
+
+    const uint32_t index = (uint32_t)space->tables_sz++;
+    pq_table* table = &space->tables[index];
+    table->root = root;
+    table->state = PQ_TABLE_NEW;
+    table->depth = 0;
+    table->leader = 0;
+    table->iteration = 0;
+    table->consumed = PQ_FALSE;
+    table->answers = NULL;
+    table->answers_sz = 0;
+    table->answers_cap = 0;
+    space->nodes[leaf].value = index + 1;
+    return index;
+}
+
+int pq_table_enter(pq_table_space* space, const uint32_t index, pq_table_status* status)
+{
+    pq_table* table = &space->tables[index];
+    switch(table->state)
+    {
+    case PQ_TABLE_COMPLETE:
+        *status = PQ_TABLE_RETURN;
+        return PQ_SUCCESS;
+    case PQ_TABLE_EVALUATING:
+    {   //the table that is evaluated on top of the stack depends on this one, it cannot complete before it.
+        pq_table* top = &space->tables[space->stack[space->stack_sz - 1]];
+        if(top->leader > table->depth) top->leader = table->depth;
+        table->consumed = PQ_TRUE;
+        *status = PQ_TABLE_CONSUME;
+        return PQ_SUCCESS;
+    }
+    default:
+        //every table on the stack is pending at most once after it is popped, so pq_table_again never allocates.
+        if(space->stack_sz >= UINT32_MAX
+            || pq_array_reserve((void**)&space->stack, &space->stack_cap, space->stack_sz + 1, sizeof(uint32_t)) != PQ_SUCCESS
+            || pq_array_reserve((void**)&space->pending, &space->pending_cap, space->pending_sz + space->stack_sz + 1, sizeof(uint32_t)) != PQ_SUCCESS)
+            return PQ_FAILURE;
+        table->state = PQ_TABLE_EVALUATING;
+        table->depth = (uint32_t)space->stack_sz;
+        table->leader = table->depth;
+        space->stack[space->stack_sz++] = index;
+        *status = PQ_TABLE_EVALUATE;
+        return PQ_SUCCESS;
+    }
+}
+
+PQbool pq_table_again(pq_table_space* space, const uint32_t index)
+{
+    pq_table* table = &space->tables[index];
+    if(table->leader == table->depth)
+    {   //a leader that was not consumed found every answer in one evaluation.
+        if(table->consumed && space->answers != table->iteration) return PQ_TRUE;
+
+        //the incomplete tables above the leader are its component.
+        table->state = PQ_TABLE_COMPLETE;
+        while(space->pending_sz && space->tables[space->pending[space->pending_sz - 1]].depth > table->depth)
+            space->tables[space->pending[--space->pending_sz]].state = PQ_TABLE_COMPLETE;
+    }
+    else
+    {   //the leader evaluates the table again, the table below depends on the leader too.
+        table->state = PQ_TABLE_INCOMPLETE;
+        space->pending[space->pending_sz++] = index;
+        pq_table* below = &space->tables[space->stack[table->depth - 1]];
+        if(below->leader > table->leader) below->leader = table->leader;
+    }
+    space->stack_sz--;
+    return PQ_FALSE;
+}
+
+int pq_table_add_answer(pq_table_space* space, const uint32_t index, const pq_term answer)
+{
+    pq_table* table = &space->tables[index];
+    uint32_t leaf;
+    PQbool added;
+    if(pq_array_reserve((void**)&table->answers, &table->answers_cap, table->answers_sz + 1, sizeof(uint32_t)) != PQ_SUCCESS
+        || pq_table_tokenize(space, answer) != PQ_SUCCESS
+        || pq_table_insert(space, table->root, &leaf, &added) != PQ_SUCCESS)
+        return PQ_FAILURE;
+
+    if(added)
+    {
+        table->answers[table->answers_sz++] = leaf;
+        space->answers++;
+    }
+    return PQ_SUCCESS;
+}
+
+int pq_table_get_answer(pq_table_space* space, const uint32_t index, const size_t answer)
+{
+    //the path from the leaf to the root is the reverse of the tokens.
+    const pq_table* table = &space->tables[index];
+    space->tokens_sz = 0;
+    for(uint32_t node = table->answers[answer]; node != table->root; node = space->nodes[node].parent)
+        if(pq_table_push_token(space, space->nodes[node].token) != PQ_SUCCESS) return PQ_FAILURE;
+    for(size_t i = 0, j = space->tokens_sz; i + 1 < j; ++i, --j)
+    {
+        const pq_term token = space->tokens[i];
+        space->tokens[i] = space->tokens[j - 1];
+        space->tokens[j - 1] = token;
+    }
+    return PQ_SUCCESS;
+}
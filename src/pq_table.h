@@ -0,0 +1,224 @@
+/**
+ * @file pq_table.h
+ * @author Brandon Foster
+ * @brief poqer-lang answer tables header.
+ * a tabled predicate stores the answers of each call, so a left recursive or redundant predicate terminates and is evaluated once.
+ * the pq_table_space struct holds the tables: the calls and the answers are stored in tries of term tokens,
+ * a call finds its table by variant (the same term up to the names of its variables), and an answer is only stored once.
+ * create/destroy the space with the pq_new_* and pq_del_* functions.
+ *
+ * the evaluation is linear tabling: a call that is already being evaluated consumes the answers found so far,
+ * and the oldest table of a strongly connected component (its leader) evaluates its clauses again until no answer is added,
+ * then every table of the component is complete (see pq_table_enter and pq_table_again functions).
+ *
+ * @version 0.001
+ * @date 10-16-2026
+ * @copyright Brandon Foster (c) 2020-2021
+ */
+
+#ifndef _PQ_TABLE_H
+#define _PQ_TABLE_H
+#include "pq_globals.h"
+#include "pq_term.h"
+#include <stdlib.h>
+
+/**
+ * @brief A node of a trie, its edge from the parent is a token of a term in pre-order.
+ */
+typedef struct pq_trie_node
+{
+    pq_term token; //a constant, a functor or box header, a raw box cell, a list (PQ_TAG_LIST) or a numbered variable.
+    uint32_t parent; //the parent node, 0 for a root.
+    uint32_t value; //the table of a call plus 1 at the leaf of the call trie, else 0.
+} pq_trie_node;
+
+/**
+ * @brief The states of a table.
+ */
+typedef enum pq_table_state
+{
+    PQ_TABLE_NEW, //the clauses were never evaluated, or the evaluation was abandoned.
+    PQ_TABLE_EVALUATING, //the clauses are being evaluated, the table is on the evaluation stack.
+    PQ_TABLE_INCOMPLETE, //the clauses were evaluated, but the leader of the component is still evaluating.
+    PQ_TABLE_COMPLETE //every answer is in the table.
+} pq_table_state;
+
+/**
+ * @brief The answers of a call.
+ */
+typedef struct pq_table
+{
+    uint32_t root; //the root of the answer trie.
+    pq_table_state state;
+    uint32_t depth; //the position on the evaluation stack while the table is evaluated.
+    uint32_t leader; //the depth of the oldest table that the evaluation consumed from, the table is the leader if it is its own depth.
+    uint64_t iteration; //the number of answers of the space when the current evaluation of the clauses started.
+    PQbool consumed; //whether a call consumed the table during the current evaluation, else one evaluation finds every answer.
+    uint32_t* answers; //the leaves of the answers, in the order they were found.
+    size_t answers_sz;
+    size_t answers_cap;
+} pq_table;
+
+/**
+ * @brief The results of pq_table_enter function.
+ */
+typedef enum pq_table_status
+{
+    PQ_TABLE_RETURN, //the table is complete, its answers are returned.
+    PQ_TABLE_CONSUME, //the table is being evaluated, the answers found so far are returned.
+    PQ_TABLE_EVALUATE //the caller evaluates the clauses until pq_table_again returns PQ_FALSE, then returns the answers.
+} pq_table_status;
+
+/**
+ * @brief The structure of the tables.
+ */
+typedef struct pq_table_space
+{   //these variables should only be read externally, not modified.
+
+    //the nodes of every trie, node 0 is not used so it marks an empty slot.
+    pq_trie_node* nodes;
+    size_t nodes_sz;
+    size_t nodes_cap;
+    uint32_t* slots; //open addressing hash table that finds the child of a node by its token.
+    size_t slot_mask;
+    uint32_t call_root; //the root of the call trie.
+
+    pq_table* tables;
+    size_t tables_sz;
+    size_t tables_cap;
+    uint32_t* stack; //the tables that are being evaluated, the oldest first.
+    size_t stack_sz;
+    size_t stack_cap;
+    uint32_t* pending; //the incomplete tables, they are completed with their leader.
+    size_t pending_sz;
+    size_t pending_cap;
+    uint64_t answers; //the number of answers that were added.
+
+    //the scratch memory, the tokens of a term and the walk of a term.
+    pq_term* tokens;
+    size_t tokens_sz;
+    size_t tokens_cap;
+    pq_term* pdl;
+    size_t pdl_cap;
+    pq_term** marked;
+    size_t marked_cap;
+} pq_table_space;
+
+/**
+ * @brief Safe allocation for a pq_table_space struct, initializes the space without tables, then returns the pointer.
+ *
+ * @return A pointer to the allocated pq_table_space struct.
+ */
+pq_table_space* pq_new_table_space(void);
+
+/**
+ * @brief Safe deallocation of a pq_table_space struct.
+ *
+ * @param space The space that will be deallocated.
+ */
+void pq_del_table_space(pq_table_space* space);
+
+/**
+ * @brief Removes every table (e.g. the clauses of a tabled predicate changed).
+ *
+ * @param space The space that will be modified, no table is being evaluated.
+ */
+void pq_table_space_clear(pq_table_space* space);
+
+/**
+ * @brief Abandons the evaluations that did not finish (e.g. a query raised an error), their tables are evaluated again by the next call.
+ * The answers that were found are kept, since they are answers of the call.
+ *
+ * @param space The space that will be modified.
+ * @param stack_sz The number of tables on the evaluation stack that are kept, the evaluations that started before the query.
+ */
+void pq_table_space_reset(pq_table_space* space, const size_t stack_sz);
+
+/**
+ * @brief Finds the table of a call, it is created if no variant of the call was called before.
+ *
+ * @param space The space that will be modified.
+ * @param goal The call.
+ * @return The index of the table, UINT32_MAX if there is not enough memory.
+ */
+uint32_t pq_table_get(pq_table_space* space, const pq_term goal);
+
+/**
+ * @brief Starts a call of a table.
+ * A new or incomplete table is pushed on the evaluation stack, a table that is being evaluated is consumed,
+ * so every table above it is in its component and cannot complete before it.
+ *
+ * @param space The space that will be modified.
+ * @param table The index of the table.
+ * @param status Receives the pq_table_status, PQ_TABLE_EVALUATE starts an evaluation of the clauses.
+ * @return PQ_SUCCESS if the call started else PQ_FAILURE, there is not enough memory.
+ */
+int pq_table_enter(pq_table_space* space, const uint32_t table, pq_table_status* status);
+
+/**
+ * @brief Starts an evaluation of the clauses of a table, the table is on top of the evaluation stack.
+ *
+ * @param space The space that will be modified.
+ * @param table The index of the table.
+ */
+static inline void pq_table_iterate(pq_table_space* space, const uint32_t table)
+{
+    space->tables[table].iteration = space->answers;
+    space->tables[table].consumed = PQ_FALSE;
+}
+
+/**
+ * @brief Ends an evaluation of the clauses of a table, the table is on top of the evaluation stack.
+ * A leader evaluates again if an answer was added, else its component is complete.
+ * A table that is not a leader is incomplete, its leader is propagated to the table below it.
+ *
+ * @param space The space that will be modified.
+ * @param table The index of the table.
+ * @return PQ_TRUE if the clauses must be evaluated again, else the table is popped from the evaluation stack.
+ */
+PQbool pq_table_again(pq_table_space* space, const uint32_t table);
+
+/**
+ * @brief Adds an answer to a table, unless it is a variant of an answer of the table.
+ *
+ * @param space The space that will be modified.
+ * @param table The index of the table.
+ * @param answer The instance of the call.
+ * @return PQ_SUCCESS if the answer is in the table else PQ_FAILURE.
+ */
+int pq_table_add_answer(pq_table_space* space, const uint32_t table, const pq_term answer);
+
+/**
+ * @brief Gets the tokens of an answer of a table, in pre-order.
+ * The variables are the cells (i << PQ_TERM_TAG_BITS | PQ_TAG_FUNCTOR) with the atom PQ_ATOM_NONE, they are numbered in order.
+ *
+ * @param space The space that will be modified, the tokens are stored here.
+ * @param table The index of the table.
+ * @param index The index of the answer.
+ * @return PQ_SUCCESS if the tokens are stored in space->tokens else PQ_FAILURE.
+ */
+int pq_table_get_answer(pq_table_space* space, const uint32_t table, const size_t index);
+
+/**
+ * @brief Gets whether a token of an answer is a variable.
+ *
+ * @param token The token.
+ * @return PQ_TRUE if it is a variable.
+ */
+static inline PQbool pq_table_is_var_token(const pq_term token)
+{
+    return pq_term_get_tag(token) == PQ_TAG_FUNCTOR && pq_term_get_atom(token) == PQ_ATOM_NONE;
+}
+
+/**
+ * @brief Gets the number of a variable token.
+ *
+ * @param token The variable token.
+ * @return The number of the variable, from 0 in order of appearance.
+ */
+static inline uint32_t pq_table_get_var_number(const pq_term token)
+{
+    return (uint32_t)(token & 0xFFFFFFFFu) >> PQ_TERM_TAG_BITS;
+}
+
+#endif
@@ -2,10 +2,13 @@
  * @file pq_term.h
  * @author Brandon Foster
  * @brief poqer-lang term header.
- * the pq_term struct is used to represent the term construct in a poqer program.
- * create/destroy the term with the pq_new_* and pq_del_* functions.
- * 
- * @version 0.001
+ * the pq_term type is used to represent the term construct in a poqer program.
+ * a term is a 64-bit tagged cell, atoms and small integers are stored in the cell itself,
+ * other terms point to cells (e.g. a compound term is a functor cell followed by its argument cells).
+ * create the term with the pq_new_* functions, the cells are allocated from an arena and deallocated with it.
+ * read the term with the pq_term_* functions.
+ *
+ * @version 0.002
  * @date 11-6-2020
  * @copyright Brandon Foster (c) 2020-2021
  */
@@ -13,133 +16,275 @@
 #ifndef _PQ_TERM_H
 #define _PQ_TERM_H
 #include "pq_globals.h"
-#include "pq_list.h"
+#include "pq_atom.h"
+#include "pq_arena.h"
 #include <stdlib.h>
+#include <string.h>
 #include <inttypes.h>
 
-const uint16_t PQ_TERM_NUMERIC_TYPE = 1 << 0;
-const uint16_t PQ_TERM_INTEGER_TYPE = 1 << 1;
-const uint16_t PQ_TERM_FLOAT_TYPE = 1 << 2;
-const uint16_t PQ_TERM_ATOM_TYPE = 1 << 3;
-const uint16_t PQ_TERM_OPERATOR_TYPE = 1 << 4;
-const uint16_t PQ_TERM_VARIABLE_TYPE = 1 << 5;
-const uint16_t PQ_TERM_FUNCTOR_TYPE = 1 << 6;
-const uint16_t PQ_TERM_LIST_TYPE = 1 << 7;
-const uint16_t PQ_TERM_EXPR_ARG_TYPE = 1 << 8;
-
-typedef enum pq_op_specifier
-{
-    //infix
-    PQ_OP_XFX,
-    PQ_OP_XFY,
-    PQ_OP_YFX,
-
-    //prefix
-    PQ_OP_FX,
-    PQ_OP_FY,
-
-    //postfix
-    PQ_OP_XF,
-    PQ_OP_YF
-} pq_op_specifier;
-
-typedef struct pq_operator_term {
-    PQstr id;
-    pq_op_specifier specifier;
-} pq_operator_term;
-
-typedef struct pq_functor_term {
-    PQstr id;
-    pq_list* args;
-} pq_functor_term;
-
-typedef union pq_term_data {
-    pq_operator_term* op_data;
-    pq_functor_term* fun_data;
-    pq_list* list_items;
-    PQstr var_id;
-    PQstr atom_id;
-    PQflt float_val;
-    PQint int_val;
-} pq_term_data;
-
-typedef struct pq_term {
-    pq_term_data data;
-    pq_priority priority;
-    uint16_t types;
-} pq_term;
-
-static inline pq_term* pq_new_term()
-{
-    pq_term* term = (pq_term*)malloc(sizeof(pq_term));
-    return term;
+typedef uint64_t pq_term;
+
+/**
+ * @brief The tags in the lowest 3 bits of a cell.
+ * The cells are aligned to 8 bytes, so a pointer is recovered by clearing the tag.
+ */
+typedef enum pq_term_tag
+{
+    PQ_TAG_REF = 0, //points to the cell of a variable, an unbound variable points to itself.
+    PQ_TAG_ATOM = 1, //the atom id is stored in the upper 32 bits.
+    PQ_TAG_INT = 2, //the small integer is stored in the upper 61 bits.
+    PQ_TAG_STR = 3, //points to a functor cell that is followed by the argument cells.
+    PQ_TAG_LIST = 4, //points to the head cell that is followed by the tail cell, a '.'/2 compound without its functor cell.
+    PQ_TAG_BOX = 5, //points to a box cell that is followed by raw data (e.g. a float).
+    PQ_TAG_FUNCTOR = 6, //the header of a compound, the atom id is stored in the upper 32 bits and the arity in bits 3 to 31.
+    PQ_TAG_BOX_HEADER = 7 //the header of a box, the kind is stored in bits 3 to 7 and the number of data cells in the upper 32 bits.
+} pq_term_tag;
+
+/**
+ * @brief The kinds of raw data in a box.
+ */
+typedef enum pq_box_kind
+{
+    PQ_BOX_FLOAT, //a PQflt.
+    PQ_BOX_INT, //a PQint that does not fit in a small integer.
+    PQ_BOX_BIGINT //an integer that does not fit in a PQint, see pq_bigint.h.
+} pq_box_kind;
+
+#define PQ_TERM_TAG_BITS 3
+#define PQ_TERM_TAG_MASK ((pq_term)7)
+
+//not a term, it is used for a missing term (e.g. after the last clause).
+#define PQ_TERM_NONE ((pq_term)0)
+
+//the range of a small integer.
+#define PQ_TERM_INT_MAX (INT64_MAX >> PQ_TERM_TAG_BITS)
+#define PQ_TERM_INT_MIN (-PQ_TERM_INT_MAX - 1)
+
+//the highest arity of a compound.
+#define PQ_TERM_ARITY_MAX ((1u << 29) - 1)
+
+static inline pq_term_tag pq_term_get_tag(const pq_term term)
+{
+    return (pq_term_tag)(term & PQ_TERM_TAG_MASK);
 }
 
-static inline pq_term* pq_new_integer_term(PQint val)
+static inline pq_term* pq_term_get_ptr(const pq_term term)
 {
-    pq_term* term = (pq_term*)malloc(sizeof(pq_term));
-    term->priority = 0;
-    term->types = PQ_TERM_NUMERIC_TYPE | PQ_TERM_INTEGER_TYPE;
-    term->data.int_val = val;
-    return term;
+    return (pq_term*)(uintptr_t)(term & ~PQ_TERM_TAG_MASK);
 }
 
-static inline pq_term* pq_new_float_term(PQflt val)
+static inline pq_term pq_make_ptr_term(const pq_term* cell, const pq_term_tag tag)
 {
-    pq_term* term = (pq_term*)malloc(sizeof(pq_term));
-    term->priority = 0;
-    term->types = PQ_TERM_NUMERIC_TYPE | PQ_TERM_FLOAT_TYPE;
-    term->data.float_val = val;
-    return term;
+    return (pq_term)(uintptr_t)cell | tag;
 }
 
-static inline pq_term* pq_new_variable_term(PQstr val)
+static inline pq_term pq_make_functor_cell(const pq_atom name, const uint32_t arity)
 {
-    pq_term* term = (pq_term*)malloc(sizeof(pq_term));
-    term->priority = 0;
-    term->types = PQ_TERM_VARIABLE_TYPE;
-    term->data.var_id = val;
-    return term;
+    return (pq_term)name << 32 | (pq_term)arity << PQ_TERM_TAG_BITS | PQ_TAG_FUNCTOR;
 }
 
-static inline pq_term* pq_new_atom_term(PQstr val, const pq_priority priority)
+static inline pq_term pq_make_box_cell(const pq_box_kind kind, const uint32_t size)
 {
-    pq_term* term = (pq_term*)malloc(sizeof(pq_term));
-    term->priority = priority;
-    term->types = PQ_TERM_ATOM_TYPE;
-    term->data.atom_id = val;
-    return term;
+    return (pq_term)size << 32 | (pq_term)kind << PQ_TERM_TAG_BITS | PQ_TAG_BOX_HEADER;
 }
 
-static inline pq_term* pq_new_operator_term(PQstr val, const pq_priority priority, const pq_op_specifier specifier)
+static inline PQbool pq_int_fits_small(const PQint val)
 {
-    pq_term* term = (pq_term*)malloc(sizeof(pq_term));
-    term->priority = priority;
-    term->types = PQ_TERM_ATOM_TYPE | PQ_TERM_OPERATOR_TYPE;
-    term->data.op_data = (pq_operator_term*)malloc(sizeof(pq_operator_term));
-    term->data.op_data->specifier = specifier;
-    term->data.op_data->id = val;
-    return term;
+    return val >= PQ_TERM_INT_MIN && val <= PQ_TERM_INT_MAX;
 }
 
-static inline pq_term* pq_new_functor_term(PQstr val, const pq_priority priority, pq_list* args)
+static inline pq_term pq_new_atom_term(const pq_atom val)
 {
-    pq_term* term = (pq_term*)malloc(sizeof(pq_term));
-    term->priority = priority;
-    term->types = PQ_TERM_ATOM_TYPE | PQ_TERM_FUNCTOR_TYPE;
-    term->data.fun_data = (pq_functor_term*)malloc(sizeof(pq_functor_term));
-    term->data.fun_data->args = args;
-    term->data.fun_data->id = val;
-    return term;
+    return (pq_term)val << 32 | PQ_TAG_ATOM;
+}
+
+static inline pq_term pq_new_integer_term(pq_arena* arena, const PQint val)
+{
+    if(pq_int_fits_small(val)) return (pq_term)val << PQ_TERM_TAG_BITS | PQ_TAG_INT;
+
+    pq_term* cells = (pq_term*)pq_arena_alloc(arena, 2 * sizeof(pq_term));
+    cells[0] = pq_make_box_cell(PQ_BOX_INT, 1);
+    memcpy(&cells[1], &val, sizeof(PQint));
+    return pq_make_ptr_term(cells, PQ_TAG_BOX);
+}
+
+static inline pq_term pq_new_float_term(pq_arena* arena, const PQflt val)
+{
+    pq_term* cells = (pq_term*)pq_arena_alloc(arena, 2 * sizeof(pq_term));
+    cells[0] = pq_make_box_cell(PQ_BOX_FLOAT, 1);
+    memcpy(&cells[1], &val, sizeof(PQflt));
+    return pq_make_ptr_term(cells, PQ_TAG_BOX);
+}
+
+static inline pq_term pq_new_variable_term(pq_arena* arena)
+{
+    pq_term* cell = (pq_term*)pq_arena_alloc(arena, sizeof(pq_term));
+    *cell = pq_make_ptr_term(cell, PQ_TAG_REF);
+    return *cell;
+}
+
+/**
+ * @brief Creates a compound term, its functor cell and argument cells are allocated together.
+ *
+ * @param arena The arena that will be used.
+ * @param name The name of the compound.
+ * @param arity The number of arguments, 0 creates the atom of the name.
+ * @param args The arguments that are copied into the compound.
+ * @return The compound term.
+ */
+static inline pq_term pq_new_functor_term(pq_arena* arena, const pq_atom name, const uint32_t arity, const pq_term* args)
+{
+    if(!arity) return pq_new_atom_term(name);
+
+    pq_term* cells = (pq_term*)pq_arena_alloc(arena, (1 + (size_t)arity) * sizeof(pq_term));
+    cells[0] = pq_make_functor_cell(name, arity);
+    memcpy(&cells[1], args, arity * sizeof(pq_term));
+    return pq_make_ptr_term(cells, PQ_TAG_STR);
+}
+
+/**
+ * @brief Creates a list cell, which is the compound '.'(head, tail).
+ *
+ * @param arena The arena that will be used.
+ * @param head The first item of the list.
+ * @param tail The rest of the list, the atom '[]' ends the list.
+ * @return The list term.
+ */
+static inline pq_term pq_new_list_term(pq_arena* arena, const pq_term head, const pq_term tail)
+{
+    pq_term* cells = (pq_term*)pq_arena_alloc(arena, 2 * sizeof(pq_term));
+    cells[0] = head;
+    cells[1] = tail;
+    return pq_make_ptr_term(cells, PQ_TAG_LIST);
 }
 
-static inline pq_term* pq_new_list_term(pq_list* items)
+/**
+ * @brief Follows the references of bound variables.
+ *
+ * @param term The term that will be dereferenced.
+ * @return The term that is not a bound variable, an unbound variable refers to itself.
+ */
+static inline pq_term pq_term_deref(pq_term term)
 {
-    pq_term* term = (pq_term*)malloc(sizeof(pq_term));
-    term->priority = 0;
-    term->types = PQ_TERM_ATOM_TYPE | PQ_TERM_LIST_TYPE;
-    term->data.list_items = items;
+    while(pq_term_get_tag(term) == PQ_TAG_REF)
+    {
+        const pq_term next = *pq_term_get_ptr(term);
+        if(next == term) break;
+        term = next;
+    }
     return term;
 }
 
-#endif
\ No newline at end of file
+static inline PQbool pq_term_is_var(const pq_term term)
+{
+    return pq_term_get_tag(term) == PQ_TAG_REF;
+}
+
+static inline PQbool pq_term_is_atom(const pq_term term)
+{
+    return pq_term_get_tag(term) == PQ_TAG_ATOM;
+}
+
+static inline PQbool pq_term_is_compound(const pq_term term)
+{
+    return pq_term_get_tag(term) == PQ_TAG_STR || pq_term_get_tag(term) == PQ_TAG_LIST;
+}
+
+static inline PQbool pq_term_is_box(const pq_term term, const pq_box_kind kind)
+{
+    return pq_term_get_tag(term) == PQ_TAG_BOX && ((*pq_term_get_ptr(term) >> PQ_TERM_TAG_BITS) & 31) == (pq_term)kind;
+}
+
+static inline PQbool pq_term_is_bigint(const pq_term term)
+{
+    return pq_term_is_box(term, PQ_BOX_BIGINT);
+}
+
+static inline PQbool pq_term_is_integer(const pq_term term)
+{
+    return pq_term_get_tag(term) == PQ_TAG_INT || pq_term_is_box(term, PQ_BOX_INT) || pq_term_is_bigint(term);
+}
+
+static inline PQbool pq_term_is_float(const pq_term term)
+{
+    return pq_term_is_box(term, PQ_BOX_FLOAT);
+}
+
+static inline pq_atom pq_term_get_atom(const pq_term term)
+{
+    return (pq_atom)(term >> 32);
+}
+
+//the integer is not a bignum.
+static inline PQint pq_term_get_int(const pq_term term)
+{
+    if(pq_term_get_tag(term) == PQ_TAG_INT) return (PQint)term >> PQ_TERM_TAG_BITS;
+
+    PQint val;
+    memcpy(&val, pq_term_get_ptr(term) + 1, sizeof(PQint));
+    return val;
+}
+
+static inline PQflt pq_term_get_float(const pq_term term)
+{
+    PQflt val;
+    memcpy(&val, pq_term_get_ptr(term) + 1, sizeof(PQflt));
+    return val;
+}
+
+/**
+ * @brief Gets the name of an atom or a compound.
+ *
+ * @param term The atom or compound term.
+ * @return The name, '.' for a list cell.
+ */
+static inline pq_atom pq_term_get_name(const pq_term term)
+{
+    switch(pq_term_get_tag(term))
+    {
+    case PQ_TAG_STR: return pq_term_get_atom(*pq_term_get_ptr(term));
+    case PQ_TAG_LIST: return PQ_ATOM_DOT;
+    default: return pq_term_get_atom(term);
+    }
+}
+
+/**
+ * @brief Gets the number of arguments of a term.
+ *
+ * @param term The term.
+ * @return The arity of a compound, 0 for the other terms.
+ */
+static inline uint32_t pq_term_get_arity(const pq_term term)
+{
+    switch(pq_term_get_tag(term))
+    {
+    case PQ_TAG_STR: return (uint32_t)(*pq_term_get_ptr(term) & 0xFFFFFFFFu) >> PQ_TERM_TAG_BITS;
+    case PQ_TAG_LIST: return 2;
+    default: return 0;
+    }
+}
+
+/**
+ * @brief Gets the cells of the arguments of a compound, they are contiguous.
+ *
+ * @param term The compound term.
+ * @return The cell of the first argument.
+ */
+static inline pq_term* pq_term_get_args(const pq_term term)
+{
+    return pq_term_get_tag(term) == PQ_TAG_STR ? pq_term_get_ptr(term) + 1 : pq_term_get_ptr(term);
+}
+
+/**
+ * @brief Gets an argument of a compound in constant time.
+ *
+ * @param term The compound term.
+ * @param index The index of the argument, starting at 0.
+ * @return The argument.
+ */
+static inline pq_term pq_term_get_arg(const pq_term term, const uint32_t index)
+{
+    return pq_term_get_args(term)[index];
+}
+
+#endif
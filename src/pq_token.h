@@ -13,16 +13,19 @@
 #ifndef _PQ_TOKEN_H
 #define _PQ_TOKEN_H
 #include "pq_globals.h"
+#include "pq_atom.h"
 #include <stdlib.h>
 
 typedef enum pq_tag
 {
     PQ_NAME_TOK,   //Ex: myatom123, my_atom123, my_Atom123
     PQ_INT_TOK,    //Ex: Dec 16, Oct 020, Hex 0x10
+    PQ_BIGINT_TOK, //Ex: 18446744073709551616, an integer that does not fit in a PQint, its lexeme is kept.
     PQ_FLT_TOK,    //Ex: 3.14, 1.23e-2
     PQ_VAR_TOK,    //Ex: _, MyVar123, _MyVar123
 
     PQ_LPAR_TOK,   //(
+    PQ_OPEN_CT_TOK, //( right after the previous token without layout, only it opens the arguments of a compound (e.g. foo(a) but not foo (a))
     PQ_RPAR_TOK,   //)
     PQ_LLIST_TOK,  //[
     PQ_RLIST_TOK,  //]
@@ -34,11 +37,22 @@ typedef enum pq_tag
     PQ_END_TOK     //.
 } pq_tag;
 
+/**
+ * @brief A lexeme that is referenced by its position in the scanner's buffer instead of being copied.
+ */
+typedef struct pq_slice
+{
+    size_t off; //the lexeme's beginning position in the buffer.
+    size_t len; //the number of bytes in the lexeme.
+} pq_slice;
+
 typedef union pq_val
 {
     PQstr s;
     PQflt f;
     PQint i;
+    pq_slice slice;
+    pq_atom atom; //used by the name, comma, and head-tail separator tokens.
 } pq_val;
 
 typedef struct pq_tok
@@ -48,62 +62,138 @@ typedef struct pq_tok
     int8_t pri; //Token Priority
 
     int8_t _dealloc_str;
+    int8_t _is_slice; //whether val.slice is used instead of val.s.
 } pq_tok;
 
-static inline pq_tok* pq_new_str_token(const pq_tag tag, const PQstr val, const int8_t pri)
-{
-    pq_tok* tok = malloc(sizeof(pq_tok));
-    if(NULL == tok) return NULL;
+/*
+    the pq_set_* functions initialize a token that is owned by the caller (e.g. a token on the stack).
+    the pq_new_* functions allocate the token, deallocate it with pq_del_token.
+*/
 
+static inline pq_tok* pq_set_str_token(pq_tok* tok, const pq_tag tag, const PQstr val, const int8_t pri)
+{
     tok->tag = tag;
     tok->val.s = val;
     tok->pri = pri;
     tok->_dealloc_str = 1;
+    tok->_is_slice = 0;
     return tok;
 }
 
-static inline pq_tok* pq_new_str_literal_token(const pq_tag tag, const PQstr val, const int8_t pri)
+static inline pq_tok* pq_set_str_literal_token(pq_tok* tok, const pq_tag tag, const PQstr val, const int8_t pri)
 {
-    pq_tok* tok = malloc(sizeof(pq_tok));
-    if(NULL == tok) return NULL;
-
     tok->tag = tag;
     tok->val.s = val;
     tok->pri = pri;
     tok->_dealloc_str = 0;
+    tok->_is_slice = 0;
     return tok;
 }
 
-static inline pq_tok* pq_new_flt_token(const pq_tag tag, const PQflt val, const int8_t pri)
+static inline pq_tok* pq_set_slice_token(pq_tok* tok, const pq_tag tag, const size_t off, const size_t len, const int8_t pri)
 {
-    pq_tok* tok = malloc(sizeof(pq_tok));
-    if(NULL == tok) return NULL;
+    tok->tag = tag;
+    tok->val.slice.off = off;
+    tok->val.slice.len = len;
+    tok->pri = pri;
+    tok->_dealloc_str = 0;
+    tok->_is_slice = 1;
+    return tok;
+}
 
+static inline pq_tok* pq_set_atom_token(pq_tok* tok, const pq_tag tag, const pq_atom val, const int8_t pri)
+{
     tok->tag = tag;
-    tok->val.f = val;
+    tok->val.atom = val;
     tok->pri = pri;
     tok->_dealloc_str = 0;
+    tok->_is_slice = 0;
     return tok;
 }
 
-static inline pq_tok* pq_new_int_token(const pq_tag tag, const PQint val, const int8_t pri)
+static inline pq_tok* pq_set_flt_token(pq_tok* tok, const pq_tag tag, const PQflt val, const int8_t pri)
 {
-    pq_tok* tok = malloc(sizeof(pq_tok));
-    if(NULL == tok) return NULL;
+    tok->tag = tag;
+    tok->val.f = val;
+    tok->pri = pri;
+    tok->_dealloc_str = 0;
+    tok->_is_slice = 0;
+    return tok;
+}
 
+static inline pq_tok* pq_set_int_token(pq_tok* tok, const pq_tag tag, const PQint val, const int8_t pri)
+{
     tok->tag = tag;
     tok->val.i = val;
     tok->pri = pri;
     tok->_dealloc_str = 0;
+    tok->_is_slice = 0;
     return tok;
 }
 
-static inline void pq_del_token(pq_tok* tok)
+/**
+ * @brief Checks if the value of a token is an interned atom.
+ * 
+ * @param tok The token that will be checked.
+ * @return true for name, comma, and head-tail separator tokens else false.
+ */
+static inline PQbool pq_token_has_atom(const pq_tok* tok)
+{
+    return tok->tag == PQ_NAME_TOK || tok->tag == PQ_COMMA_TOK || tok->tag == PQ_HT_SEP_TOK;
+}
+
+/**
+ * @brief Deallocates the string owned by a token that is owned by the caller.
+ * 
+ * @param tok The token that will be cleared.
+ */
+static inline void pq_clear_token(pq_tok* tok)
 {
-    if(tok != NULL && tok->_dealloc_str)
+    if(tok->_dealloc_str)
     {
         free((char*)tok->val.s);
+        tok->_dealloc_str = 0;
     }
+}
+
+static inline pq_tok* pq_new_str_token(const pq_tag tag, const PQstr val, const int8_t pri)
+{
+    pq_tok* tok = malloc(sizeof(pq_tok));
+    if(NULL == tok) return NULL;
+    return pq_set_str_token(tok, tag, val, pri);
+}
+
+static inline pq_tok* pq_new_str_literal_token(const pq_tag tag, const PQstr val, const int8_t pri)
+{
+    pq_tok* tok = malloc(sizeof(pq_tok));
+    if(NULL == tok) return NULL;
+    return pq_set_str_literal_token(tok, tag, val, pri);
+}
+
+static inline pq_tok* pq_new_atom_token(const pq_tag tag, const pq_atom val, const int8_t pri)
+{
+    pq_tok* tok = malloc(sizeof(pq_tok));
+    if(NULL == tok) return NULL;
+    return pq_set_atom_token(tok, tag, val, pri);
+}
+
+static inline pq_tok* pq_new_flt_token(const pq_tag tag, const PQflt val, const int8_t pri)
+{
+    pq_tok* tok = malloc(sizeof(pq_tok));
+    if(NULL == tok) return NULL;
+    return pq_set_flt_token(tok, tag, val, pri);
+}
+
+static inline pq_tok* pq_new_int_token(const pq_tag tag, const PQint val, const int8_t pri)
+{
+    pq_tok* tok = malloc(sizeof(pq_tok));
+    if(NULL == tok) return NULL;
+    return pq_set_int_token(tok, tag, val, pri);
+}
+
+static inline void pq_del_token(pq_tok* tok)
+{
+    if(tok != NULL) pq_clear_token(tok);
     free(tok);
 }
 
@@ -352,23 +352,140 @@ static inline const wchar_t* pq_utf8s_to_new_wcs(const char* src)
 }
 
 //Prolog token character classifications that conforms to the ISO/IEC 13211-1 tokens with the inclusion of utf-8 characters.
+//a codepoint can belong to several classes, so each class is stored as a single bit of a class set.
 
-const int pq_is_unicode_solo_char(const uint32_t cp);
-const int pq_is_unicode_single_quoted_token_char(const uint32_t cp);
-const int pq_is_unicode_single_quoted_token_esc_char(const uint32_t cp);
-const int pq_is_unicode_control_esc_char(const uint32_t cp);
-const int pq_is_unicode_meta_esc_char(const uint32_t cp);
-const int pq_is_unicode_graphic_token_char(const uint32_t cp);
-const int pq_is_unicode_graphic_char(const uint32_t cp);
-const int pq_is_unicode_newline_char(const uint32_t cp);
-const int pq_is_unicode_layout_char(const uint32_t cp);
-const int pq_is_unicode_alnum_char(const uint32_t cp);
-const int pq_is_unicode_upper_char(const uint32_t cp);
-const int pq_is_unicode_lower_char(const uint32_t cp);
-const int pq_is_unicode_bin_char(const uint32_t cp);
-const int pq_is_unicode_oct_char(const uint32_t cp);
-const int pq_is_unicode_dec_char(const uint32_t cp);
-const int pq_is_unicode_hex_char(const uint32_t cp);
-const int pq_is_unicode_other_char(const uint32_t cp);
+#define PQ_UNICODE_SOLO_CLASS                    0x0001
+#define PQ_UNICODE_SINGLE_QUOTED_TOKEN_CLASS     0x0002
+#define PQ_UNICODE_CONTROL_ESC_CLASS             0x0004
+#define PQ_UNICODE_META_ESC_CLASS                0x0008
+#define PQ_UNICODE_GRAPHIC_TOKEN_CLASS           0x0010
+#define PQ_UNICODE_GRAPHIC_CLASS                 0x0020
+#define PQ_UNICODE_NEWLINE_CLASS                 0x0040
+#define PQ_UNICODE_LAYOUT_CLASS                  0x0080
+#define PQ_UNICODE_ALNUM_CLASS                   0x0100
+#define PQ_UNICODE_UPPER_CLASS                   0x0200
+#define PQ_UNICODE_LOWER_CLASS                   0x0400
+#define PQ_UNICODE_BIN_CLASS                     0x0800
+#define PQ_UNICODE_OCT_CLASS                     0x1000
+#define PQ_UNICODE_DEC_CLASS                     0x2000
+#define PQ_UNICODE_HEX_CLASS                     0x4000
+#define PQ_UNICODE_OTHER_CLASS                   0x8000
+
+//number of bits of a codepoint used as the offset within a page of the class tables.
+#define PQ_UNICODE_PAGE_SHIFT 7
+
+//the first codepoint after the unicode range.
+#define PQ_UNICODE_CP_LIMIT 0x110000
+
+/*
+    the class tables are generated from the Unicode Character Database by tools/pq_gen_unicode_tables.py,
+    so every codepoint is classified the same way regardless of the current locale.
+    the codepoints are split into pages of (1 << PQ_UNICODE_PAGE_SHIFT) codepoints, equal pages are stored once.
+*/
+extern const uint16_t pq_unicode_char_class_table[0x80]; //the class set of every ascii codepoint.
+extern const uint16_t pq_unicode_char_class_sets[];    //the distinct class sets.
+extern const uint8_t pq_unicode_char_class_pages[];    //the page of every block of codepoints.
+extern const uint8_t pq_unicode_char_class_offsets[];  //the class set index of every codepoint within its page.
+
+/**
+ * @brief Gets the class set of a codepoint, an ascii codepoint takes a single load from its own table.
+ * The other codepoints take a two-level page/offset table lookup, codepoints outside of the unicode range belong to no class.
+ * 
+ * @param cp The codepoint to be checked.
+ * @return The class set of the codepoint, test it against the PQ_UNICODE_*_CLASS bits.
+ */
+static inline const uint16_t pq_unicode_get_char_class(const uint32_t cp)
+{
+    if(cp < 0x80) return pq_unicode_char_class_table[cp];
+    const uint32_t in_range_cp = cp < PQ_UNICODE_CP_LIMIT ? cp : PQ_UNICODE_CP_LIMIT;
+    const uint32_t page = pq_unicode_char_class_pages[in_range_cp >> PQ_UNICODE_PAGE_SHIFT];
+    const uint32_t offset = in_range_cp & ((1 << PQ_UNICODE_PAGE_SHIFT) - 1);
+    return pq_unicode_char_class_sets[pq_unicode_char_class_offsets[(page << PQ_UNICODE_PAGE_SHIFT) | offset]];
+}
+
+static inline const int pq_is_unicode_solo_char(const uint32_t cp)
+{
+    return (pq_unicode_get_char_class(cp) & PQ_UNICODE_SOLO_CLASS) != 0;
+}
+
+static inline const int pq_is_unicode_single_quoted_token_char(const uint32_t cp)
+{
+    return (pq_unicode_get_char_class(cp) & PQ_UNICODE_SINGLE_QUOTED_TOKEN_CLASS) != 0;
+}
+
+static inline const int pq_is_unicode_single_quoted_token_esc_char(const uint32_t cp)
+{
+    return (pq_unicode_get_char_class(cp) & (PQ_UNICODE_CONTROL_ESC_CLASS | PQ_UNICODE_META_ESC_CLASS)) != 0;
+}
+
+static inline const int pq_is_unicode_control_esc_char(const uint32_t cp)
+{
+    return (pq_unicode_get_char_class(cp) & PQ_UNICODE_CONTROL_ESC_CLASS) != 0;
+}
+
+static inline const int pq_is_unicode_meta_esc_char(const uint32_t cp)
+{
+    return (pq_unicode_get_char_class(cp) & PQ_UNICODE_META_ESC_CLASS) != 0;
+}
+
+static inline const int pq_is_unicode_graphic_token_char(const uint32_t cp)
+{
+    return (pq_unicode_get_char_class(cp) & PQ_UNICODE_GRAPHIC_TOKEN_CLASS) != 0;
+}
+
+static inline const int pq_is_unicode_graphic_char(const uint32_t cp)
+{
+    return (pq_unicode_get_char_class(cp) & PQ_UNICODE_GRAPHIC_CLASS) != 0;
+}
+
+static inline const int pq_is_unicode_newline_char(const uint32_t cp)
+{
+    return (pq_unicode_get_char_class(cp) & PQ_UNICODE_NEWLINE_CLASS) != 0;
+}
+
+static inline const int pq_is_unicode_layout_char(const uint32_t cp)
+{
+    return (pq_unicode_get_char_class(cp) & PQ_UNICODE_LAYOUT_CLASS) != 0;
+}
+
+static inline const int pq_is_unicode_alnum_char(const uint32_t cp)
+{
+    return (pq_unicode_get_char_class(cp) & PQ_UNICODE_ALNUM_CLASS) != 0;
+}
+
+static inline const int pq_is_unicode_upper_char(const uint32_t cp)
+{
+    return (pq_unicode_get_char_class(cp) & PQ_UNICODE_UPPER_CLASS) != 0;
+}
+
+static inline const int pq_is_unicode_lower_char(const uint32_t cp)
+{
+    return (pq_unicode_get_char_class(cp) & PQ_UNICODE_LOWER_CLASS) != 0;
+}
+
+static inline const int pq_is_unicode_bin_char(const uint32_t cp)
+{
+    return (pq_unicode_get_char_class(cp) & PQ_UNICODE_BIN_CLASS) != 0;
+}
+
+static inline const int pq_is_unicode_oct_char(const uint32_t cp)
+{
+    return (pq_unicode_get_char_class(cp) & PQ_UNICODE_OCT_CLASS) != 0;
+}
+
+static inline const int pq_is_unicode_dec_char(const uint32_t cp)
+{
+    return (pq_unicode_get_char_class(cp) & PQ_UNICODE_DEC_CLASS) != 0;
+}
+
+static inline const int pq_is_unicode_hex_char(const uint32_t cp)
+{
+    return (pq_unicode_get_char_class(cp) & PQ_UNICODE_HEX_CLASS) != 0;
+}
+
+static inline const int pq_is_unicode_other_char(const uint32_t cp)
+{
+    return (pq_unicode_get_char_class(cp) & PQ_UNICODE_OTHER_CLASS) != 0;
+}
 
 #endif
\ No newline at end of file
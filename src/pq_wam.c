@@ -0,0 +1,67 @@
+/**
+ * @file pq_wam.c
+ * @author Brandon Foster
+ * @brief poqer-lang abstract machine instruction set implementation.
+ *
+ * @version 0.001
+ * @date 10-16-2026
+ * @copyright Brandon Foster (c) 2020-2021
+ */
+
+#include "pq_wam.h"
+
+const uint8_t pq_wam_sizes[PQ_WAM_OPCODE_COUNT] = {
+#define PQ_WAM_SIZE(id, name, size) size,
+    PQ_WAM_INSTRUCTIONS(PQ_WAM_SIZE)
+#undef PQ_WAM_SIZE
+};
+
+const char* const pq_wam_names[PQ_WAM_OPCODE_COUNT] = {
+#define PQ_WAM_NAME(id, name, size) name,
+    PQ_WAM_INSTRUCTIONS(PQ_WAM_NAME)
+#undef PQ_WAM_NAME
+};
+
+size_t pq_wam_fuse(pq_code* code, const size_t size)
+{
+    size_t in = 0;
+    size_t out = 0;
+    while(in < size)
+    {
+        const pq_code word = code[in];
+        const pq_wam_opcode op = pq_wam_get_op(word);
+        const size_t op_sz = pq_wam_sizes[op];
+        const pq_wam_opcode next = in + op_sz < size ? pq_wam_get_op(code[in + op_sz]) : PQ_WAM_OPCODE_COUNT;
+        const pq_wam_opcode after = next == PQ_WAM_UNIFY_VARIABLE_X && in + 2 < size ? pq_wam_get_op(code[in + 2]) : PQ_WAM_OPCODE_COUNT;
+
+        if(op == PQ_WAM_GET_LIST && next == PQ_WAM_UNIFY_VARIABLE_X && after == PQ_WAM_UNIFY_VARIABLE_X)
+        {   //the registers are below PQ_WAM_REGISTERS, so both fit in b.
+            const uint32_t regs = pq_wam_get_a(code[in + 1]) | pq_wam_get_a(code[in + 2]) << 16;
+            code[out++] = pq_wam_make(PQ_WAM_GET_LIST_X_X, pq_wam_get_a(word), regs);
+            in += 3;
+        }
+        else if(op == PQ_WAM_UNIFY_VARIABLE_X && next == PQ_WAM_UNIFY_VARIABLE_X)
+        {
+            code[out++] = pq_wam_make(PQ_WAM_UNIFY_VARIABLE_X_X, pq_wam_get_a(word), pq_wam_get_a(code[in + 1]));
+            in += 2;
+        }
+        else if(op == PQ_WAM_UNIFY_VALUE_X && next == PQ_WAM_UNIFY_VARIABLE_X)
+        {
+            code[out++] = pq_wam_make(PQ_WAM_UNIFY_VALUE_VARIABLE_X, pq_wam_get_a(word), pq_wam_get_a(code[in + 1]));
+            in += 2;
+        }
+        else if(op == PQ_WAM_PUT_VALUE_X && next == PQ_WAM_PUT_VALUE_X)
+        {
+            const pq_code second = code[in + 1];
+            code[out++] = pq_wam_make(PQ_WAM_PUT_VALUE_X_X, pq_wam_get_a(word), pq_wam_get_b(word));
+            code[out++] = (pq_code)pq_wam_get_a(second) | (pq_code)pq_wam_get_b(second) << 32;
+            in += 2;
+        }
+        else
+        {
+            for(size_t i = 0; i < op_sz; i++) code[out++] = code[in + i];
+            in += op_sz;
+        }
+    }
+    return out;
+}
@@ -0,0 +1,185 @@
+/**
+ * @file pq_wam.h
+ * @author Brandon Foster
+ * @brief poqer-lang abstract machine instruction set header.
+ * the clauses are compiled into instructions of a Warren Abstract Machine (WAM).
+ * an instruction is a pq_code word with the opcode in the lowest 8 bits and up to 2 register operands,
+ * some instructions are followed by an operand word (a constant or functor cell, a predicate, or a code address).
+ * create the words with pq_wam_make function, read them with the pq_wam_get_* functions.
+ *
+ * the registers are X0, X1, ..., the arguments of a call are passed in the first ones (also named A0, A1, ...).
+ * the permanent variables Y0, Y1, ... are stored in the environment of the clause.
+ *
+ * @version 0.001
+ * @date 10-16-2026
+ * @copyright Brandon Foster (c) 2020-2021
+ */
+
+#ifndef _PQ_WAM_H
+#define _PQ_WAM_H
+#include "pq_globals.h"
+#include "pq_term.h"
+#include <inttypes.h>
+
+typedef uint64_t pq_code;
+
+//the number of X registers, the registers above the arguments hold the temporary variables.
+#define PQ_WAM_REGISTERS 65536
+
+//the instructions, each with its name and the number of words it takes.
+//the operands are written after the name: a and b are the register operands of the first word, w is the operand word.
+#define PQ_WAM_INSTRUCTIONS(X) \
+    /* head arguments */ \
+    X(PQ_WAM_GET_VARIABLE_X, "get_variable_x", 1) /* a=Xn b=Ai */ \
+    X(PQ_WAM_GET_VARIABLE_Y, "get_variable_y", 1) /* a=Yn b=Ai */ \
+    X(PQ_WAM_GET_VALUE_X, "get_value_x", 1) /* a=Xn b=Ai */ \
+    X(PQ_WAM_GET_VALUE_Y, "get_value_y", 1) /* a=Yn b=Ai */ \
+    X(PQ_WAM_GET_CONSTANT, "get_constant", 2) /* a=Ai w=constant */ \
+    X(PQ_WAM_GET_NIL, "get_nil", 1) /* a=Ai */ \
+    X(PQ_WAM_GET_STRUCTURE, "get_structure", 2) /* a=Ai w=functor */ \
+    X(PQ_WAM_GET_LIST, "get_list", 1) /* a=Ai */ \
+    /* call arguments */ \
+    X(PQ_WAM_PUT_VARIABLE_X, "put_variable_x", 1) /* a=Xn b=Ai */ \
+    X(PQ_WAM_PUT_VARIABLE_Y, "put_variable_y", 1) /* a=Yn b=Ai */ \
+    X(PQ_WAM_PUT_VALUE_X, "put_value_x", 1) /* a=Xn b=Ai */ \
+    X(PQ_WAM_PUT_VALUE_Y, "put_value_y", 1) /* a=Yn b=Ai */ \
+    X(PQ_WAM_PUT_CONSTANT, "put_constant", 2) /* a=Ai w=constant */ \
+    X(PQ_WAM_PUT_NIL, "put_nil", 1) /* a=Ai */ \
+    X(PQ_WAM_PUT_STRUCTURE, "put_structure", 2) /* a=Ai w=functor */ \
+    X(PQ_WAM_PUT_LIST, "put_list", 1) /* a=Ai */ \
+    /* arguments of a structure, they read it after a get or build it after a put */ \
+    X(PQ_WAM_UNIFY_VARIABLE_X, "unify_variable_x", 1) /* a=Xn */ \
+    X(PQ_WAM_UNIFY_VARIABLE_Y, "unify_variable_y", 1) /* a=Yn */ \
+    X(PQ_WAM_UNIFY_VALUE_X, "unify_value_x", 1) /* a=Xn */ \
+    X(PQ_WAM_UNIFY_VALUE_Y, "unify_value_y", 1) /* a=Yn */ \
+    X(PQ_WAM_UNIFY_CONSTANT, "unify_constant", 2) /* w=constant */ \
+    X(PQ_WAM_UNIFY_NIL, "unify_nil", 1) \
+    X(PQ_WAM_UNIFY_VOID, "unify_void", 1) /* a=the number of arguments */ \
+    /* control */ \
+    X(PQ_WAM_ALLOCATE, "allocate", 1) /* a=the number of permanent variables */ \
+    X(PQ_WAM_DEALLOCATE, "deallocate", 1) \
+    X(PQ_WAM_CALL, "call", 2) /* a=the number of permanent variables that are still used, w=predicate */ \
+    X(PQ_WAM_EXECUTE, "execute", 2) /* w=predicate */ \
+    X(PQ_WAM_PROCEED, "proceed", 1) \
+    X(PQ_WAM_FAIL, "fail", 1) \
+    X(PQ_WAM_HALT, "halt", 1) \
+    /* clause selection */ \
+    X(PQ_WAM_TRY, "try", 2) /* a=arity w=clause code */ \
+    X(PQ_WAM_RETRY, "retry", 2) /* a=arity w=clause code */ \
+    X(PQ_WAM_TRUST, "trust", 2) /* a=arity w=clause code */ \
+    X(PQ_WAM_SWITCH_ON_TERM, "switch_on_term", 5) /* w=the code for a variable, constant, list and structure A0, NULL fails */ \
+    X(PQ_WAM_SWITCH_ON_CONSTANT, "switch_on_constant", 2) /* w=switch table keyed by the atom or small integer A0 */ \
+    X(PQ_WAM_SWITCH_ON_STRUCTURE, "switch_on_structure", 2) /* w=switch table keyed by the functor of A0 */ \
+    X(PQ_WAM_SWITCH_ON_ARGS, "switch_on_args", 2) /* a=whether the first argument index is selective, w=predicate */ \
+    /* cut */ \
+    X(PQ_WAM_NECK_CUT, "neck_cut", 1) \
+    X(PQ_WAM_GET_LEVEL_X, "get_level_x", 1) /* a=Xn */ \
+    X(PQ_WAM_GET_LEVEL_Y, "get_level_y", 1) /* a=Yn */ \
+    X(PQ_WAM_CUT_X, "cut_x", 1) /* a=Xn */ \
+    X(PQ_WAM_CUT_Y, "cut_y", 1) /* a=Yn */ \
+    /* superinstructions, the most common sequences fused by pq_wam_fuse */ \
+    X(PQ_WAM_GET_LIST_X_X, "get_list_x_x", 1) /* get_list, unify_variable_x, unify_variable_x. a=Ai b=Xn|Xm<<16 */ \
+    X(PQ_WAM_UNIFY_VARIABLE_X_X, "unify_variable_x_x", 1) /* a=Xn b=Xm */ \
+    X(PQ_WAM_UNIFY_VALUE_VARIABLE_X, "unify_value_variable_x", 1) /* unify_value_x, unify_variable_x. a=Xn b=Xm */ \
+    X(PQ_WAM_PUT_VALUE_X_X, "put_value_x_x", 2) /* a=Xn b=Ai w=Xm|Aj<<32 */
+
+typedef enum pq_wam_opcode
+{
+#define PQ_WAM_ENUM(id, name, size) id,
+    PQ_WAM_INSTRUCTIONS(PQ_WAM_ENUM)
+#undef PQ_WAM_ENUM
+    PQ_WAM_OPCODE_COUNT
+} pq_wam_opcode;
+
+//the number of words of each instruction, indexed by opcode.
+extern const uint8_t pq_wam_sizes[PQ_WAM_OPCODE_COUNT];
+
+//the names of the instructions, indexed by opcode.
+extern const char* const pq_wam_names[PQ_WAM_OPCODE_COUNT];
+
+/**
+ * @brief Creates the first word of an instruction.
+ *
+ * @param op The opcode.
+ * @param a The first register operand, below 2^24.
+ * @param b The second register operand.
+ * @return The instruction word.
+ */
+static inline pq_code pq_wam_make(const pq_wam_opcode op, const uint32_t a, const uint32_t b)
+{
+    return (pq_code)op | (pq_code)a << 8 | (pq_code)b << 32;
+}
+
+static inline pq_wam_opcode pq_wam_get_op(const pq_code word)
+{
+    return (pq_wam_opcode)(word & 0xFF);
+}
+
+static inline uint32_t pq_wam_get_a(const pq_code word)
+{
+    return (uint32_t)(word >> 8) & 0xFFFFFF;
+}
+
+static inline uint32_t pq_wam_get_b(const pq_code word)
+{
+    return (uint32_t)(word >> 32);
+}
+
+/**
+ * @brief Creates an operand word that holds a pointer (a predicate or a code address).
+ *
+ * @param ptr The pointer.
+ * @return The operand word.
+ */
+static inline pq_code pq_wam_make_ptr(const void* ptr)
+{
+    return (pq_code)(uintptr_t)ptr;
+}
+
+static inline void* pq_wam_get_ptr(const pq_code word)
+{
+    return (void*)(uintptr_t)word;
+}
+
+/**
+ * @brief Hashes the key of a switch table.
+ *
+ * @param key The constant or functor cell.
+ * @return The hash, the slot index is taken from it with the mask of the table.
+ */
+static inline pq_code pq_wam_switch_hash(const pq_term key)
+{
+    //the ids are in the upper bits of the cells, fibonacci hashing folds them into the low bits.
+    return (key * UINT64_C(11400714819323198485)) >> 32;
+}
+
+/**
+ * @brief Finds the code of a key in the switch table of switch_on_constant or switch_on_structure.
+ * The table is open addressing: the slot mask, the default code, then a key word and a code word per slot, an empty slot has the key 0.
+ *
+ * @param table The switch table.
+ * @param key The constant or functor cell.
+ * @return The code of the key, the default code if the key is not in the table (NULL fails).
+ */
+static inline pq_code* pq_wam_switch_lookup(const pq_code* table, const pq_term key)
+{
+    const pq_code mask = table[0];
+    for(pq_code i = pq_wam_switch_hash(key) & mask;; i = (i + 1) & mask)
+    {
+        const pq_code* slot = table + 2 + 2 * i;
+        if(slot[0] == key) return (pq_code*)pq_wam_get_ptr(slot[1]);
+        if(!slot[0]) return (pq_code*)pq_wam_get_ptr(table[1]);
+    }
+}
+
+/**
+ * @brief Replaces the most common instruction sequences of a clause with superinstructions, so the engine dispatches less often.
+ * The code of a clause has no jumps, so any sequence can be fused.
+ *
+ * @param code The code of the clause that will be modified.
+ * @param size The number of words in code.
+ * @return The number of words in the fused code.
+ */
+size_t pq_wam_fuse(pq_code* code, const size_t size);
+
+#endif
@@ -0,0 +1,397 @@
+/**
+ * @file pq_writer.c
+ * @author Brandon Foster
+ * @brief poqer-lang term writer implementation.
+ * the internal implementation of the pq_writer_* functions are documented below.
+ *
+ * @version 0.001
+ * @date 10-16-2026
+ * @copyright Brandon Foster (c) 2020-2021
+ */
+
+#include "pq_writer.h"
+#include "pq_bigint.h"
+#include "pq_unicode.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+//the priority of an argument of a compound or an item of a list, so a ',' operator in it is parenthesized.
+#define PQ_WRITE_ARG_PRIORITY 999
+
+pq_writer* pq_new_writer(const pq_op_table* ops, const pq_term* heap)
+{
+    pq_writer* writer = (pq_writer*)calloc(1, sizeof(pq_writer));
+    if(!writer) return NULL;
+
+    writer->str = (char*)malloc(64);
+    if(!writer->str)
+    {
+        free(writer);
+        return NULL;
+    }
+    writer->str[0] = '\0';
+    writer->cap = 64;
+    writer->ops = ops;
+    writer->heap = heap;
+    return writer;
+}
+
+void pq_del_writer(pq_writer* writer)
+{
+    if(!writer) return;
+    free(writer->str);
+    free(writer->stack);
+    free(writer);
+}
+
+/**
+ * @brief Appends bytes to the text.
+ *
+ * @param writer The writer that will be modified.
+ * @param str The bytes.
+ * @param len The number of bytes.
+ * @return PQ_SUCCESS if the bytes were appended else PQ_FAILURE.
+ */
+static int pq_writer_append_bytes(pq_writer* writer, const char* str, const size_t len)
+{
+    if(pq_array_reserve((void**)&writer->str, &writer->cap, writer->len + len + 1, 1) != PQ_SUCCESS) return PQ_FAILURE;
+    memcpy(writer->str + writer->len, str, len);
+    writer->len += len;
+    writer->str[writer->len] = '\0';
+    return PQ_SUCCESS;
+}
+
+int pq_writer_append(pq_writer* writer, const char* str)
+{
+    return pq_writer_append_bytes(writer, str, strlen(str));
+}
+
+/**
+ * @brief Checks if the text of an atom is a graphic token (e.g. '+' or '=..').
+ *
+ * @param name The name of the atom.
+ * @return true if every character is a graphic token character else false.
+ */
+static PQbool pq_writer_is_graphic(const pq_lexeme name)
+{
+    if(!name.len) return PQ_FALSE;
+    size_t i = 0;
+    while(i < name.len)
+    {
+        uint32_t cp;
+        const int8_t bytes = pq_utf8_to_cp(&cp, name.str + i);
+        if(bytes <= 0 || !pq_is_unicode_graphic_token_char(cp)) return PQ_FALSE;
+        i += bytes;
+    }
+    return PQ_TRUE;
+}
+
+/**
+ * @brief Checks if an atom must be quoted to be read back as the same atom.
+ *
+ * @param atom The atom.
+ * @return true if the atom needs quotes else false.
+ */
+static PQbool pq_writer_needs_quotes(const pq_atom atom)
+{
+    switch(atom)
+    {
+    case PQ_ATOM_NIL:
+    case PQ_ATOM_CURLY:
+    case PQ_ATOM_CUT:
+    case PQ_ATOM_SEMICOLON:
+        return PQ_FALSE;
+    case PQ_ATOM_COMMA:
+    case PQ_ATOM_BAR:
+    case PQ_ATOM_EMPTY:
+        return PQ_TRUE;
+    default:
+        break;
+    }
+
+    const pq_lexeme name = pq_atom_get_name(atom);
+    uint32_t cp;
+    int8_t bytes = pq_utf8_to_cp(&cp, name.str);
+    if(bytes <= 0) return PQ_TRUE;
+    if(pq_is_unicode_lower_char(cp))
+    {   //a letter digit token.
+        for(size_t i = bytes; i < name.len; i += bytes)
+        {
+            bytes = pq_utf8_to_cp(&cp, name.str + i);
+            if(bytes <= 0 || !pq_is_unicode_alnum_char(cp)) return PQ_TRUE;
+        }
+        return PQ_FALSE;
+    }
+    //a single '.' would end the clause.
+    return !pq_writer_is_graphic(name) || (name.len == 1 && name.str[0] == '.');
+}
+
+/**
+ * @brief Appends an atom, quoted if needed.
+ *
+ * @param writer The writer that will be modified.
+ * @param atom The atom.
+ * @param quoted Whether the atom is quoted if needed.
+ * @return PQ_SUCCESS if the atom was appended else PQ_FAILURE.
+ */
+static int pq_writer_append_atom(pq_writer* writer, const pq_atom atom, const PQbool quoted)
+{
+    const pq_lexeme name = pq_atom_get_name(atom);
+    if(!quoted || !pq_writer_needs_quotes(atom)) return pq_writer_append_bytes(writer, name.str, name.len);
+
+    if(pq_writer_append_bytes(writer, "'", 1) != PQ_SUCCESS) return PQ_FAILURE;
+    for(size_t i = 0; i < name.len; i++)
+    {
+        const char ch = name.str[i];
+        const char* esc = NULL;
+        switch(ch)
+        {
+        case '\'': esc = "\\'"; break;
+        case '\\': esc = "\\\\"; break;
+        case '\n': esc = "\\n"; break;
+        case '\t': esc = "\\t"; break;
+        default: break;
+        }
+        const int result = esc ? pq_writer_append(writer, esc) : pq_writer_append_bytes(writer, &ch, 1);
+        if(result != PQ_SUCCESS) return PQ_FAILURE;
+    }
+    return pq_writer_append_bytes(writer, "'", 1);
+}
+
+/**
+ * @brief Appends a number.
+ *
+ * @param writer The writer that will be modified.
+ * @param term The integer or float term.
+ * @return PQ_SUCCESS if the number was appended else PQ_FAILURE.
+ */
+static int pq_writer_append_number(pq_writer* writer, const pq_term term)
+{
+    char buffer[40];
+    if(pq_term_is_bigint(term))
+    {
+        char* digits = pq_bigint_to_cstr(term);
+        const int result = digits ? pq_writer_append(writer, digits) : PQ_FAILURE;
+        free(digits);
+        return result;
+    }
+    if(pq_term_is_float(term))
+    {   //the shortest of the two precisions that reads back as the same float, with a '.' so it reads back as a float.
+        const PQflt val = pq_term_get_float(term);
+        if(isnan(val)) return pq_writer_append(writer, "1.5NaN");
+        if(isinf(val)) return pq_writer_append(writer, val < 0 ? "-1.0Inf" : "1.0Inf");
+        snprintf(buffer, sizeof(buffer), "%.15g", val);
+        if(strtod(buffer, NULL) != val) snprintf(buffer, sizeof(buffer), "%.17g", val);
+        if(!strchr(buffer, '.'))
+        {   //the fraction goes before the exponent (e.g. 1e+20 is written as 1.0e+20).
+            char* exp = strchr(buffer, 'e');
+            const size_t exp_sz = exp ? strlen(exp) : 0;
+            if(!exp) exp = buffer + strlen(buffer);
+            memmove(exp + 2, exp, exp_sz + 1);
+            exp[0] = '.';
+            exp[1] = '0';
+        }
+    }
+    else snprintf(buffer, sizeof(buffer), "%" PRId64, (int64_t)pq_term_get_int(term));
+    return pq_writer_append(writer, buffer);
+}
+
+/**
+ * @brief Checks if the text of a term starts with a character that would join a graphic operator before it (e.g. 1- -1).
+ *
+ * @param term The dereferenced term.
+ * @return true if a space is needed before the term else false.
+ */
+static PQbool pq_writer_starts_graphic(const pq_writer* writer, const pq_term term)
+{
+    if(pq_term_is_bigint(term)) return pq_bigint_is_negative(pq_term_get_ptr(term));
+    if(pq_term_is_integer(term)) return pq_term_get_int(term) < 0;
+    if(pq_term_is_float(term)) return pq_term_get_float(term) < 0;
+    if(pq_term_get_tag(term) != PQ_TAG_ATOM && pq_term_get_tag(term) != PQ_TAG_STR) return PQ_FALSE;
+
+    const pq_atom name = pq_term_get_name(term);
+    if(pq_term_get_tag(term) == PQ_TAG_STR && !writer->ops) return PQ_FALSE;
+    return pq_writer_is_graphic(pq_atom_get_name(name));
+}
+
+/**
+ * @brief Pushes an item on the work stack.
+ *
+ * @param writer The writer that will be modified.
+ * @param sz The number of items on the stack, it is incremented.
+ * @param kind The pq_write_kind of the item.
+ * @param term The term of the item.
+ * @param text The text of the item.
+ * @param max_priority The maximum priority of the term.
+ * @return PQ_SUCCESS if the item was pushed else PQ_FAILURE.
+ */
+static inline int pq_writer_push(pq_writer* writer, size_t* sz, const pq_write_kind kind, const pq_term term, const char* text, const pq_priority max_priority)
+{
+    if(pq_array_reserve((void**)&writer->stack, &writer->stack_cap, *sz + 1, sizeof(pq_write_item)) != PQ_SUCCESS) return PQ_FAILURE;
+    pq_write_item* item = &writer->stack[(*sz)++];
+    item->kind = (uint8_t)kind;
+    item->term = term;
+    item->text = text;
+    item->max_priority = max_priority;
+    return PQ_SUCCESS;
+}
+
+int pq_writer_write(pq_writer* writer, const pq_term term, const int flags)
+{
+    const PQbool quoted = (flags & PQ_WRITE_QUOTED) != 0;
+    const pq_op_table* ops = flags & PQ_WRITE_IGNORE_OPS ? NULL : writer->ops;
+    size_t sz = 0;
+    int result = pq_writer_push(writer, &sz, PQ_WRITE_TERM, term, NULL, PQ_OP_MAX_PRIORITY);
+    if(result == PQ_SUCCESS)
+    {
+        writer->stack[0].mark = PQ_TERM_NONE;
+        writer->stack[0].depth = 0;
+    }
+
+    //the items are pushed in reverse, so the first piece of text is on top of the stack.
+    while(sz && result == PQ_SUCCESS)
+    {
+        const pq_write_item item = writer->stack[--sz];
+        if(item.kind == PQ_WRITE_TEXT)
+        {
+            result = pq_writer_append(writer, item.text);
+            continue;
+        }
+
+        //a cyclic term is found with brent's algorithm along the path of compounds from the root (a tail of a list is on the path),
+        //the mark moves to the compound at every power of 2 depth, so a cycle comes back to it within twice its length.
+        const pq_term curr = pq_term_deref(item.term);
+        const size_t depth = pq_term_is_compound(curr) ? item.depth + 1 : item.depth;
+        const pq_term mark = pq_term_is_compound(curr) && !(depth & (depth - 1)) ? curr : item.mark;
+        const size_t pushed = sz;
+        if(pq_term_is_compound(curr) && curr == item.mark)
+        {
+            writer->err = "representation error: the term is cyclic, it has no finite text.";
+            return PQ_FAILURE;
+        }
+
+        if(item.kind == PQ_WRITE_TAIL)
+        {
+            if(pq_term_get_tag(curr) == PQ_TAG_LIST)
+            {
+                result = pq_writer_push(writer, &sz, PQ_WRITE_TAIL, pq_term_get_arg(curr, 1), NULL, 0);
+                if(result == PQ_SUCCESS) result = pq_writer_push(writer, &sz, PQ_WRITE_TERM, pq_term_get_arg(curr, 0), NULL, PQ_WRITE_ARG_PRIORITY);
+                if(result == PQ_SUCCESS) result = pq_writer_append(writer, ",");
+            }
+            else if(curr == pq_new_atom_term(PQ_ATOM_NIL)) result = pq_writer_append(writer, "]");
+            else
+            {
+                result = pq_writer_push(writer, &sz, PQ_WRITE_TEXT, PQ_TERM_NONE, "]", 0);
+                if(result == PQ_SUCCESS) result = pq_writer_push(writer, &sz, PQ_WRITE_TERM, curr, NULL, PQ_WRITE_ARG_PRIORITY);
+                if(result == PQ_SUCCESS) result = pq_writer_append(writer, "|");
+            }
+        }
+        else switch(pq_term_get_tag(curr))
+        {
+        case PQ_TAG_REF:
+        {   //an unbound variable is named by its cell.
+            char buffer[32];
+            const pq_term* cell = pq_term_get_ptr(curr);
+            snprintf(buffer, sizeof(buffer), "_G%" PRIuPTR, writer->heap ? (uintptr_t)(cell - writer->heap) : (uintptr_t)cell >> PQ_TERM_TAG_BITS);
+            result = pq_writer_append(writer, buffer);
+            break;
+        }
+
+        case PQ_TAG_ATOM:
+            result = pq_writer_append_atom(writer, pq_term_get_atom(curr), quoted);
+            break;
+
+        case PQ_TAG_LIST:
+            result = pq_writer_push(writer, &sz, PQ_WRITE_TAIL, pq_term_get_arg(curr, 1), NULL, 0);
+            if(result == PQ_SUCCESS) result = pq_writer_push(writer, &sz, PQ_WRITE_TERM, pq_term_get_arg(curr, 0), NULL, PQ_WRITE_ARG_PRIORITY);
+            if(result == PQ_SUCCESS) result = pq_writer_append(writer, "[");
+            break;
+
+        case PQ_TAG_STR:
+        {
+            const pq_atom name = pq_term_get_name(curr);
+            const uint32_t arity = pq_term_get_arity(curr);
+            if(ops && name == PQ_ATOM_CURLY && arity == 1)
+            {   //{Goal}
+                result = pq_writer_push(writer, &sz, PQ_WRITE_TEXT, PQ_TERM_NONE, "}", 0);
+                if(result == PQ_SUCCESS) result = pq_writer_push(writer, &sz, PQ_WRITE_TERM, pq_term_get_arg(curr, 0), NULL, PQ_OP_MAX_PRIORITY);
+                if(result == PQ_SUCCESS) result = pq_writer_append(writer, "{");
+                break;
+            }
+
+            const pq_op_def* infix = ops && arity == 2 ? pq_op_table_get(ops, name, PQ_OP_INFIX) : NULL;
+            const pq_op_def* prefix = ops && arity == 1 ? pq_op_table_get(ops, name, PQ_OP_PREFIX) : NULL;
+            const pq_op_def* postfix = ops && arity == 1 && !prefix ? pq_op_table_get(ops, name, PQ_OP_POSTFIX) : NULL;
+            const pq_op_def* op = infix ? infix : prefix ? prefix : postfix;
+            if(!op)
+            {   //functional notation, name(Arg1, ..., ArgN).
+                result = pq_writer_push(writer, &sz, PQ_WRITE_TEXT, PQ_TERM_NONE, ")", 0);
+                for(uint32_t i = arity; i > 0 && result == PQ_SUCCESS; i--)
+                {
+                    result = pq_writer_push(writer, &sz, PQ_WRITE_TERM, pq_term_get_arg(curr, i - 1), NULL, PQ_WRITE_ARG_PRIORITY);
+                    if(i > 1 && result == PQ_SUCCESS) result = pq_writer_push(writer, &sz, PQ_WRITE_TEXT, PQ_TERM_NONE, ",", 0);
+                }
+                if(result == PQ_SUCCESS) result = pq_writer_append_atom(writer, name, quoted);
+                if(result == PQ_SUCCESS) result = pq_writer_append(writer, "(");
+                break;
+            }
+
+            //the operands of an x side have a lower priority than the operator, the operands of a y side can have the same priority.
+            const pq_priority priority = op->priority;
+            const PQbool parens = priority > item.max_priority;
+            const pq_priority left = op->specifier == PQ_OP_YFX || op->specifier == PQ_OP_YF ? priority : priority - 1;
+            const pq_priority right = op->specifier == PQ_OP_XFY || op->specifier == PQ_OP_FY ? priority : priority - 1;
+            const PQbool alpha = !pq_writer_is_graphic(pq_atom_get_name(name)) && name != PQ_ATOM_COMMA && name != PQ_ATOM_SEMICOLON
+                && name != PQ_ATOM_CUT && name != PQ_ATOM_BAR;
+
+            if(parens) result = pq_writer_push(writer, &sz, PQ_WRITE_TEXT, PQ_TERM_NONE, ")", 0);
+            if(infix)
+            {
+                const pq_term right_term = pq_term_deref(pq_term_get_arg(curr, 1));
+                if(result == PQ_SUCCESS) result = pq_writer_push(writer, &sz, PQ_WRITE_TERM, right_term, NULL, right);
+                if(alpha || pq_writer_starts_graphic(writer, right_term))
+                {
+                    if(result == PQ_SUCCESS) result = pq_writer_push(writer, &sz, PQ_WRITE_TEXT, PQ_TERM_NONE, " ", 0);
+                }
+                if(result == PQ_SUCCESS) result = pq_writer_push(writer, &sz, PQ_WRITE_TEXT, PQ_TERM_NONE, pq_atom_get_cstr(name), 0);
+                if(alpha && result == PQ_SUCCESS) result = pq_writer_push(writer, &sz, PQ_WRITE_TEXT, PQ_TERM_NONE, " ", 0);
+                if(result == PQ_SUCCESS) result = pq_writer_push(writer, &sz, PQ_WRITE_TERM, pq_term_get_arg(curr, 0), NULL, left);
+            }
+            else if(prefix)
+            {   //a space keeps a number operand from being read as a signed number, and a parenthesized operand from being read as arguments.
+                const pq_term arg = pq_term_deref(pq_term_get_arg(curr, 0));
+                const pq_op_def* arg_op = pq_term_get_tag(arg) == PQ_TAG_STR && pq_term_get_arity(arg) <= 2 ?
+                    pq_op_table_get(ops, pq_term_get_name(arg), pq_term_get_arity(arg) == 2 ? PQ_OP_INFIX : PQ_OP_PREFIX) : NULL;
+                const PQbool arg_parens = arg_op && arg_op->priority > right;
+                if(result == PQ_SUCCESS) result = pq_writer_push(writer, &sz, PQ_WRITE_TERM, arg, NULL, right);
+                if(alpha || arg_parens || pq_term_is_integer(arg) || pq_term_is_float(arg) || pq_writer_starts_graphic(writer, arg))
+                {
+                    if(result == PQ_SUCCESS) result = pq_writer_push(writer, &sz, PQ_WRITE_TEXT, PQ_TERM_NONE, " ", 0);
+                }
+                if(result == PQ_SUCCESS) result = pq_writer_push(writer, &sz, PQ_WRITE_TEXT, PQ_TERM_NONE, pq_atom_get_cstr(name), 0);
+            }
+            else
+            {
+                if(result == PQ_SUCCESS) result = pq_writer_push(writer, &sz, PQ_WRITE_TEXT, PQ_TERM_NONE, pq_atom_get_cstr(name), 0);
+                if(alpha && result == PQ_SUCCESS) result = pq_writer_push(writer, &sz, PQ_WRITE_TEXT, PQ_TERM_NONE, " ", 0);
+                if(result == PQ_SUCCESS) result = pq_writer_push(writer, &sz, PQ_WRITE_TERM, pq_term_get_arg(curr, 0), NULL, left);
+            }
+            if(parens && result == PQ_SUCCESS) result = pq_writer_append(writer, "(");
+            break;
+        }
+
+        default:
+            result = pq_writer_append_number(writer, curr);
+            break;
+        }
+
+        for(size_t i = pushed; i < sz; ++i)
+        {   //the items of the subterms are below the current one.
+            writer->stack[i].mark = mark;
+            writer->stack[i].depth = depth;
+        }
+    }
+    if(result != PQ_SUCCESS) writer->err = "resource error: not enough memory for the text.";
+    return result;
+}
@@ -0,0 +1,112 @@
+/**
+ * @file pq_writer.h
+ * @author Brandon Foster
+ * @brief poqer-lang term writer header.
+ * the pq_writer struct converts terms into text (e.g. write/1, writeq/1, and the answers of a query).
+ * create/destroy the writer with the pq_new_* and pq_del_* functions.
+ * append a term to the text with pq_writer_write function, read the text from str and clear it with pq_writer_clear function.
+ *
+ * @version 0.001
+ * @date 10-16-2026
+ * @copyright Brandon Foster (c) 2020-2021
+ */
+
+#ifndef _PQ_WRITER_H
+#define _PQ_WRITER_H
+#include "pq_globals.h"
+#include "pq_term.h"
+#include "pq_op_table.h"
+
+//the atoms are quoted where needed, so the text can be read back.
+#define PQ_WRITE_QUOTED 1
+//the operators are written in functional notation.
+#define PQ_WRITE_IGNORE_OPS 2
+
+/**
+ * @brief The kinds of items on the work stack of the writer.
+ */
+typedef enum pq_write_kind
+{
+    PQ_WRITE_TERM, //a term that is written with a maximum priority.
+    PQ_WRITE_TEXT, //a piece of text (e.g. a parenthesis).
+    PQ_WRITE_TAIL //the tail of a list, after its first item.
+} pq_write_kind;
+
+/**
+ * @brief An item on the work stack of the writer.
+ */
+typedef struct pq_write_item
+{
+    pq_term term;
+    const char* text;
+    pq_priority max_priority;
+    uint8_t kind; //the pq_write_kind of the item.
+
+    //the compound that the compounds below the item are compared with to find a cycle, and the number of compounds above the item.
+    pq_term mark;
+    size_t depth;
+} pq_write_item;
+
+/**
+ * @brief The structure of a poqer-lang term writer.
+ */
+typedef struct pq_writer
+{   //these variables should only be read externally, not modified.
+
+    //the text that was written, always null-terminated.
+    char* str;
+    size_t len;
+    size_t cap;
+
+    //the work stack, terms are written without recursion so their nesting is not limited by the c stack.
+    pq_write_item* stack;
+    size_t stack_cap;
+
+    const pq_op_table* ops; //the operators, NULL to write every term in functional notation.
+    const pq_term* heap; //the variables are named by their offset from it, NULL to name them by address.
+    char* err; //the reason the last write failed.
+} pq_writer;
+
+/**
+ * @brief Safe allocation for a pq_writer struct, initializes the writer with an empty text, then returns the pointer.
+ *
+ * @param ops The operators, NULL to write every term in functional notation.
+ * @param heap The variables are named by their offset from it, NULL to name them by address.
+ * @return A pointer to the allocated pq_writer struct.
+ */
+pq_writer* pq_new_writer(const pq_op_table* ops, const pq_term* heap);
+
+/**
+ * @brief Safe deallocation of a pq_writer struct.
+ *
+ * @param writer The writer that will be deallocated.
+ */
+void pq_del_writer(pq_writer* writer);
+
+/**
+ * @brief Appends the text of a term.
+ * A cyclic term has no finite text, it fails instead of writing until the memory runs out.
+ *
+ * @param writer The writer that will be modified.
+ * @param term The term.
+ * @param flags The PQ_WRITE_* flags.
+ * @return PQ_SUCCESS if the text was appended else PQ_FAILURE, the reason is stored in err (not enough memory or a cyclic term).
+ */
+int pq_writer_write(pq_writer* writer, const pq_term term, const int flags);
+
+/**
+ * @brief Appends a null-terminated string.
+ *
+ * @param writer The writer that will be modified.
+ * @param str The string.
+ * @return PQ_SUCCESS if the text was appended else PQ_FAILURE (not enough memory).
+ */
+int pq_writer_append(pq_writer* writer, const char* str);
+
+static inline void pq_writer_clear(pq_writer* writer)
+{
+    writer->len = 0;
+    writer->str[0] = '\0';
+}
+
+#endif
@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+"""
+@file pq_gen_float_tables.py
+@author Brandon Foster
+@brief generates the power of five table of the poqer-lang float parser.
+the table is written as a c source file (src/pq_float_tables.c by default).
+every power 5^q from 5^PQ_FLOAT_POW5_MIN to 5^PQ_FLOAT_POW5_MAX is stored as its 128 most significant bits, the high 64 bits first.
+the positive powers are truncated, the negative powers are rounded up (see the Eisel-Lemire algorithm in pq_float.c).
+
+usage: pq_gen_float_tables.py [-o output.c]
+
+@version 0.001
+@date 10-16-2026
+@copyright Brandon Foster (c) 2020-2021
+"""
+
+import argparse
+
+#these must match the PQ_FLOAT_POW5_MIN and PQ_FLOAT_POW5_MAX macros in pq_float.h.
+POW5_MIN = -342
+POW5_MAX = 308
+
+
+def power_of_five_128(q):
+    """gets the 128 most significant bits of 5^q."""
+    if q >= 0:
+        power = 5 ** q
+        while power < (1 << 127):
+            power <<= 1
+        while power >= (1 << 128):
+            power >>= 1
+        return power
+
+    #the reciprocal is scaled so that its top bit is bit 127, then rounded up.
+    power = 5 ** -q
+    z = power.bit_length()
+    if q >= -27:
+        return (1 << (z + 127)) // power + 1
+    reciprocal = (1 << (2 * z + 128)) // power + 1
+    while reciprocal >= (1 << 128):
+        reciprocal >>= 1
+    return reciprocal
+
+
+def write_table(out):
+    out.write("/**\n")
+    out.write(" * @file pq_float_tables.c\n")
+    out.write(" * @author Brandon Foster\n")
+    out.write(" * @brief the power of five table of the float parser.\n")
+    out.write(" * this file is generated by tools/pq_gen_float_tables.py, do not edit it by hand.\n")
+    out.write(" * regenerate it with: make float-tables\n")
+    out.write(" * \n")
+    out.write(" * @copyright Brandon Foster (c) 2020-2021\n")
+    out.write(" */\n\n")
+    out.write("#include \"pq_float.h\"\n\n")
+    out.write("#if PQ_FLOAT_POW5_MIN != %d || PQ_FLOAT_POW5_MAX != %d\n" % (POW5_MIN, POW5_MAX))
+    out.write("#error \"pq_float_tables.c was generated with a different range of powers, please regenerate it.\"\n")
+    out.write("#endif\n\n")
+    out.write("//the 128 most significant bits of 5^q for q from %d to %d, the high 64 bits first.\n" % (POW5_MIN, POW5_MAX))
+    out.write("const uint64_t pq_float_pow5_128[%d] =\n{\n" % (2 * (POW5_MAX - POW5_MIN + 1)))
+    for q in range(POW5_MIN, POW5_MAX + 1):
+        power = power_of_five_128(q)
+        out.write("    0x%016XULL, 0x%016XULL, //5^%d\n" % (power >> 64, power & ((1 << 64) - 1), q))
+    out.write("};\n")
+
+
+def main():
+    arg_parser = argparse.ArgumentParser(description="generates the power of five table of the poqer-lang float parser.")
+    arg_parser.add_argument("-o", "--output", default="src/pq_float_tables.c")
+    args = arg_parser.parse_args()
+
+    with open(args.output, "w", encoding="utf-8", newline="\n") as out:
+        write_table(out)
+
+
+if __name__ == "__main__":
+    main()
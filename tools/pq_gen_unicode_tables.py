@@ -0,0 +1,255 @@
+#!/usr/bin/env python3
+"""
+@file pq_gen_unicode_tables.py
+@author Brandon Foster
+@brief generates the unicode character class tables of poqer-lang.
+the tables are written as a c source file (src/pq_unicode_tables.c by default).
+the classes are derived from the Unicode Character Database (UnicodeData.txt and PropList.txt).
+if the database files are not given, the database bundled with python's unicodedata module is used.
+
+usage: pq_gen_unicode_tables.py [-o output.c] [--ucd UnicodeData.txt] [--proplist PropList.txt]
+
+@version 0.001
+@date 10-16-2026
+@copyright Brandon Foster (c) 2020-2021
+"""
+
+import argparse
+import sys
+
+CP_LIMIT = 0x110000
+ASCII_LIMIT = 0x80
+
+#number of bits of a codepoint used as the offset within a page.
+PAGE_SHIFT = 7
+PAGE_SIZE = 1 << PAGE_SHIFT
+
+#class bits, these must match the PQ_UNICODE_*_CLASS macros in pq_unicode.h.
+SOLO                = 0x0001
+SINGLE_QUOTED_TOKEN = 0x0002
+CONTROL_ESC         = 0x0004
+META_ESC            = 0x0008
+GRAPHIC_TOKEN       = 0x0010
+GRAPHIC             = 0x0020
+NEWLINE             = 0x0040
+LAYOUT              = 0x0080
+ALNUM               = 0x0100
+UPPER               = 0x0200
+LOWER               = 0x0400
+BIN                 = 0x0800
+OCT                 = 0x1000
+DEC                 = 0x2000
+HEX                 = 0x4000
+OTHER               = 0x8000
+
+#the White_Space property, used when PropList.txt is not given.
+WHITE_SPACE = set([0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x20, 0x85, 0xA0, 0x1680,
+                   0x2028, 0x2029, 0x202F, 0x205F, 0x3000] + list(range(0x2000, 0x200B)))
+
+#poqer-defined newlines, the layout characters that end a single-line comment.
+NEWLINES = set([0x0A, 0x0B, 0x0C, 0x0D, 0x85, 0x2028, 0x2029])
+
+#the ascii-only classes of the ISO/IEC 13211-1 tokens.
+SOLO_CHARS = "!(),;[]{}|."
+CONTROL_ESC_CHARS = "abfnrtv"
+META_ESC_CHARS = "\\'\"`"
+OTHER_CHARS = "()[]{}|,."
+
+
+def read_categories_from_ucd(path):
+    """reads the general category of every codepoint from UnicodeData.txt."""
+    categories = ["Cn"] * CP_LIMIT
+    first = None
+    with open(path, encoding="utf-8") as ucd:
+        for line in ucd:
+            fields = line.split(";")
+            if len(fields) < 3:
+                continue
+            cp = int(fields[0], 16)
+            if fields[1].endswith(", First>"):
+                first = cp
+                continue
+            if fields[1].endswith(", Last>"):
+                for range_cp in range(first, cp + 1):
+                    categories[range_cp] = fields[2]
+                first = None
+                continue
+            categories[cp] = fields[2]
+    return categories
+
+
+def read_categories_from_python():
+    """reads the general category of every codepoint from python's bundled database."""
+    import unicodedata
+    return [unicodedata.category(chr(cp)) for cp in range(CP_LIMIT)]
+
+
+def read_white_space_from_proplist(path):
+    """reads the codepoints with the White_Space property from PropList.txt."""
+    white_space = set()
+    with open(path, encoding="utf-8") as proplist:
+        for line in proplist:
+            line = line.split("#")[0].strip()
+            if not line:
+                continue
+            cps, prop = [field.strip() for field in line.split(";")]
+            if prop != "White_Space":
+                continue
+            if ".." in cps:
+                beg, end = cps.split("..")
+                white_space.update(range(int(beg, 16), int(end, 16) + 1))
+            else:
+                white_space.add(int(cps, 16))
+    return white_space
+
+
+def char_class(cp, category, white_space):
+    """computes the class set of a single codepoint."""
+    major = category[0]
+    cls = 0
+
+    #classes derived from the general category and the White_Space property.
+    if cp in white_space:
+        cls |= LAYOUT
+        if cp in NEWLINES:
+            cls |= NEWLINE
+    if category in ("Lu", "Lt"):
+        cls |= UPPER
+    elif major == "L":
+        cls |= LOWER
+    if major in "LMN" or cp == ord("_"):
+        cls |= ALNUM
+    if major in "LMNPS" or category == "Zs":
+        cls |= SINGLE_QUOTED_TOKEN
+    if major in "PS" and cp != ord("_"):
+        cls |= GRAPHIC | GRAPHIC_TOKEN
+
+    #classes that only contain ascii characters.
+    if cp < 0x80:
+        ch = chr(cp)
+        if ch in SOLO_CHARS:
+            #solo characters are not graphic, except for the period that can start a graphic token.
+            cls |= SOLO
+            if ch != ".":
+                cls &= ~(GRAPHIC | GRAPHIC_TOKEN)
+        if ch in CONTROL_ESC_CHARS:
+            cls |= CONTROL_ESC
+        if ch in META_ESC_CHARS:
+            cls |= META_ESC
+        if ch in OTHER_CHARS:
+            cls |= OTHER
+        if ch in "01":
+            cls |= BIN
+        if ch in "01234567":
+            cls |= OCT
+        if ch in "0123456789":
+            cls |= DEC
+        if ch in "0123456789abcdefABCDEF":
+            cls |= HEX
+    return cls
+
+
+def build_tables(categories, white_space):
+    """splits the class sets into deduplicated pages of class set indices."""
+    sets = [0]
+    set_index = {0: 0}
+    pages = []
+    page_index = {}
+    page_of = []
+
+    for page_beg in range(0, CP_LIMIT + PAGE_SIZE, PAGE_SIZE):
+        #the extra page after the unicode range is used for out of range codepoints.
+        page = []
+        for cp in range(page_beg, page_beg + PAGE_SIZE):
+            cls = char_class(cp, categories[cp], white_space) if cp < CP_LIMIT else 0
+            if cls not in set_index:
+                set_index[cls] = len(sets)
+                sets.append(cls)
+            page.append(set_index[cls])
+        page = tuple(page)
+        if page not in page_index:
+            page_index[page] = len(pages)
+            pages.append(page)
+        page_of.append(page_index[page])
+        if page_beg >= CP_LIMIT:
+            break
+
+    if len(sets) > 256 or len(pages) > 256:
+        sys.exit("error: the class sets or pages do not fit into 8-bit indices")
+    return sets, pages, page_of
+
+
+def format_array(values, fmt, per_line):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(fmt % v for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def write_tables(out, sets, pages, page_of, source):
+    out.write("""/**
+ * @file pq_unicode_tables.c
+ * @author Brandon Foster
+ * @brief unicode character class tables.
+ * this file is generated by tools/pq_gen_unicode_tables.py from %s, do not edit it by hand.
+ * regenerate it with: make unicode-tables
+ * 
+ * @copyright Brandon Foster (c) 2020-2021
+ */
+
+#include "pq_unicode.h"
+
+#if PQ_UNICODE_PAGE_SHIFT != %d
+#error "pq_unicode_tables.c was generated with a different page size, please regenerate it."
+#endif
+
+""" % (source, PAGE_SHIFT))
+
+    #the ascii codepoints are the first page, their class sets are also stored directly for the scanner's fast path.
+    out.write("//the class set of every ascii codepoint, indexed by the codepoint itself.\n")
+    out.write("const uint16_t pq_unicode_char_class_table[%d] =\n{\n" % ASCII_LIMIT)
+    out.write(format_array([sets[i] for i in pages[page_of[0]][:ASCII_LIMIT]], "0x%04X", 8))
+    out.write("\n};\n\n")
+
+    out.write("//the distinct class sets, indexed by the entries of pq_unicode_char_class_offsets.\n")
+    out.write("const uint16_t pq_unicode_char_class_sets[%d] =\n{\n" % len(sets))
+    out.write(format_array(sets, "0x%04X", 8))
+    out.write("\n};\n\n")
+
+    out.write("//the page of every block of %d codepoints, the last entry is used for out of range codepoints.\n" % PAGE_SIZE)
+    out.write("const uint8_t pq_unicode_char_class_pages[%d] =\n{\n" % len(page_of))
+    out.write(format_array(page_of, "%3d", 16))
+    out.write("\n};\n\n")
+
+    out.write("//the class set index of every codepoint within its page.\n")
+    out.write("const uint8_t pq_unicode_char_class_offsets[%d] =\n{\n" % (len(pages) * PAGE_SIZE))
+    for i, page in enumerate(pages):
+        out.write("    //page %d\n" % i)
+        out.write(format_array(page, "%2d", 32))
+        out.write("\n")
+    out.write("};\n")
+
+
+def main():
+    arg_parser = argparse.ArgumentParser(description="generates the unicode character class tables of poqer-lang.")
+    arg_parser.add_argument("-o", "--output", default="src/pq_unicode_tables.c")
+    arg_parser.add_argument("--ucd", help="path to UnicodeData.txt")
+    arg_parser.add_argument("--proplist", help="path to PropList.txt")
+    args = arg_parser.parse_args()
+
+    if args.ucd:
+        categories = read_categories_from_ucd(args.ucd)
+        source = "UnicodeData.txt"
+    else:
+        import unicodedata
+        categories = read_categories_from_python()
+        source = "the Unicode Character Database %s" % unicodedata.unidata_version
+    white_space = read_white_space_from_proplist(args.proplist) if args.proplist else WHITE_SPACE
+
+    sets, pages, page_of = build_tables(categories, white_space)
+    with open(args.output, "w", encoding="utf-8", newline="\n") as out:
+        write_tables(out, sets, pages, page_of, source)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+"""
+@file pq_test_float.py
+@author Brandon Foster
+@brief checks that the poqer-lang float parser rounds float literals like python's float().
+random float literals are written as facts to a temporary file, which is consulted by the interpreter and written back.
+the writer's output reads back as the same float, so every value is compared bit for bit with python's float() of the literal.
+the literals are the shortest and 17 digit forms of random floats, long digit strings, the exact halfway points
+between two floats (with and without a digit after them), integers times small powers of 10, and a few hard cases.
+
+usage: pq_test_float.py [--program ./program] [--seed 1] [--count 20000]
+
+@version 0.001
+@date 10-16-2026
+@copyright Brandon Foster (c) 2020-2021
+"""
+
+import argparse
+import decimal
+import os
+import random
+import struct
+import subprocess
+import sys
+import tempfile
+
+#the literals that the fast paths are most likely to round wrong.
+HARD_CASES = [
+    "2.2250738585072011e-308", "2.2250738585072012e-308", "2.2250738585072014e-308",
+    "4.9406564584124654e-324", "2.4703282292062327e-324", "2.4703282292062328e-324",
+    "1.7976931348623157e308", "1.7976931348623158e308", "1.7976931348623159e308",
+    "9007199254740993.0", "9007199254740992.5", "9007199254740993.0000000000000000000001",
+    "0.1", "0.30000000000000004", "123456789012345678901234567890.0",
+    "1.0e-400", "1.0e400", "0.0", "0.000000000000000000000000000000000000000001e42",
+]
+
+
+def float_from_bits(bits):
+    return struct.unpack("<d", struct.pack("<Q", bits))[0]
+
+
+def float_to_hex(val):
+    return struct.pack("<d", val).hex()
+
+
+def random_float(rng):
+    """gets a random finite positive float."""
+    while True:
+        val = float_from_bits(rng.getrandbits(63))
+        if val == val and val != float("inf"):
+            return val
+
+
+def as_literal(text):
+    """rewrites a python float text into a poqer-lang float literal, which has a fraction."""
+    mantissa, _, exp = text.partition("e")
+    if "." not in mantissa:
+        mantissa += ".0"
+    return mantissa + ("e" + exp if exp else "")
+
+
+def random_literal(rng):
+    kind = rng.random()
+    if kind < 0.25:
+        return as_literal(repr(random_float(rng)))
+    if kind < 0.45:
+        return as_literal("%.17e" % random_float(rng))
+    if kind < 0.65:
+        digits = "".join(rng.choice("0123456789") for _ in range(rng.randint(1, 60))).lstrip("0") or "0"
+        fraction_len = rng.randint(1, 900 if rng.random() < 0.05 else 40)
+        fraction = "".join(rng.choice("0123456789") for _ in range(fraction_len))
+        return "%s.%se%d" % (digits, fraction, rng.randint(-360, 330))
+    if kind < 0.9:
+        #the exact decimal halfway point between two neighbouring floats.
+        bits = rng.getrandbits(62)
+        low = float_from_bits(bits)
+        high = float_from_bits(bits + 1)
+        text = format((decimal.Decimal(low) + decimal.Decimal(high)) / 2, "e")
+        if rng.random() < 0.3:
+            mantissa, _, exp = text.partition("e")
+            text = mantissa + rng.choice(["0000001", "9", "000000000000000000000000000000001"]) + "e" + exp
+        return as_literal(text)
+    return "%d.0e%d" % (rng.randint(1, 10 ** rng.randint(1, 19)), rng.randint(-30, 30))
+
+
+def main():
+    arg_parser = argparse.ArgumentParser(description="checks the poqer-lang float parser against python's float().")
+    arg_parser.add_argument("--program", default="./program")
+    arg_parser.add_argument("--seed", type=int, default=1)
+    arg_parser.add_argument("--count", type=int, default=20000)
+    args = arg_parser.parse_args()
+
+    decimal.getcontext().prec = 2000
+    rng = random.Random(args.seed)
+    literals = HARD_CASES + [random_literal(rng) for _ in range(args.count)]
+
+    fd, path = tempfile.mkstemp(suffix=".pl")
+    try:
+        with os.fdopen(fd, "w", encoding="utf-8", newline="\n") as out:
+            for literal in literals:
+                out.write("f(%s).\n" % literal)
+        query = "consult('%s'), (f(X), write('V '), write(X), nl, fail ; true).\n" % path
+        output = subprocess.run([args.program], input=query.encode(), stdout=subprocess.PIPE, check=True).stdout.decode()
+    finally:
+        os.remove(path)
+
+    values = [line.split("V ", 1)[1].strip() for line in output.splitlines() if "V " in line]
+    if len(values) != len(literals):
+        print("expected %d floats, the interpreter wrote %d." % (len(literals), len(values)))
+        return 1
+
+    mismatches = 0
+    for literal, value in zip(literals, values):
+        got = float(value.replace("1.0Inf", "inf"))
+        if float_to_hex(got) != float_to_hex(float(literal)):
+            mismatches += 1
+            if mismatches <= 10:
+                print("mismatch: %s read as %s, expected %r" % (literal[:80], value, float(literal)))
+    print("checked %d float literals, %d mismatches." % (len(literals), mismatches))
+    return 1 if mismatches else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())